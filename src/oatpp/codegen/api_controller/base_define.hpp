@@ -260,13 +260,16 @@ if(getDefaultObjectMapper()) { \
 // BODY_DTO MACRO // ------------------------------------------------------
 
 #define OATPP_MACRO_API_CONTROLLER_BODY_DTO(TYPE, PARAM_LIST) \
-if(!getDefaultObjectMapper()) { \
+const auto& __bodyObjectMapper = getContentMappers()->selectMapperForContent( \
+  __request->getHeader(oatpp::web::protocol::http::Header::CONTENT_TYPE) \
+); \
+if(!__bodyObjectMapper) { \
   auto httpError = oatpp::web::protocol::http::HttpError(Status::CODE_500, "ObjectMapper was NOT set. Can't deserialize the request body."); \
   auto eptr = std::make_exception_ptr(httpError); \
   return ApiController::handleError(eptr); \
 } \
 const auto& OATPP_MACRO_FIRSTARG PARAM_LIST = \
-__request->readBodyToDto<TYPE>(getDefaultObjectMapper().get()); \
+__request->readBodyToDto<TYPE>(__bodyObjectMapper.get()); \
 if(!OATPP_MACRO_FIRSTARG PARAM_LIST) { \
   auto httpError = oatpp::web::protocol::http::HttpError(Status::CODE_400, "Missing valid body parameter '" OATPP_MACRO_FIRSTARG_STR PARAM_LIST "'"); \
   auto eptr = std::make_exception_ptr(httpError); \
@@ -74,7 +74,8 @@ static oatpp::data::mapping::type::BaseObject::Property* Z__PROPERTY_SINGLETON_#
   static oatpp::data::mapping::type::BaseObject::Property* property = \
       new oatpp::data::mapping::type::BaseObject::Property(Z__PROPERTY_OFFSET_##NAME(), \
                                                      #NAME, \
-                                                     TYPE::Class::getType()); \
+                                                     TYPE::Class::getType(), \
+                                                     oatpp::data::mapping::type::InlineTraits<TYPE>::getAccessor()); \
   return property; \
 } \
 \
@@ -105,7 +106,8 @@ static oatpp::data::mapping::type::BaseObject::Property* Z__PROPERTY_SINGLETON_#
   static oatpp::data::mapping::type::BaseObject::Property* property = \
       new oatpp::data::mapping::type::BaseObject::Property(Z__PROPERTY_OFFSET_##NAME(), \
                                                      QUALIFIER, \
-                                                     TYPE::Class::getType()); \
+                                                     TYPE::Class::getType(), \
+                                                     oatpp::data::mapping::type::InlineTraits<TYPE>::getAccessor()); \
   return property; \
 } \
 \
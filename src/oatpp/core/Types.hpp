@@ -26,6 +26,7 @@
 #define oatpp_Types_hpp
 
 #include "oatpp/core/data/mapping/type/Object.hpp"
+#include "oatpp/core/data/mapping/type/Inline.hpp"
 
 namespace oatpp {
 
@@ -117,6 +118,13 @@ namespace oatpp {
    */
   typedef oatpp::data::mapping::type::Boolean Boolean;
 
+  /**
+   * Primitive value stored inline - without heap allocation. Can hold nullptr value. &id:oatpp::data::mapping::type::Inline; <br>
+   * Ex.: `oatpp::Inline<oatpp::Int32>`.
+   */
+  template <class Wrapper>
+  using Inline = oatpp::data::mapping::type::Inline<Wrapper>;
+
   /**
    * Base class for all Object-like Mapping-enabled structures. &id:oatpp::data::mapping::type::BaseObject;
    */
@@ -29,6 +29,8 @@
 #include "./Error.hpp"
 
 #include "oatpp/core/async/utils/FastQueue.hpp"
+#include "oatpp/core/async/utils/FramePool.hpp"
+#include "oatpp/core/async/utils/MPSCQueue.hpp"
 
 #include "oatpp/core/IODefinitions.hpp"
 #include "oatpp/core/base/Environment.hpp"
@@ -420,6 +422,7 @@ public:
  */
 class CoroutineHandle : public oatpp::base::Countable {
   friend utils::FastQueue<CoroutineHandle>;
+  friend utils::MPSCQueue<CoroutineHandle>;
   friend Processor;
   friend worker::Worker;
   friend CoroutineWaitList;
@@ -433,6 +436,16 @@ private:
   FunctionPtr _FP;
   oatpp::async::Action _SCH_A;
   CoroutineHandle* _ref;
+public:
+
+  static void* operator new(std::size_t sz) {
+    return utils::FramePool::allocate(sz);
+  }
+
+  static void operator delete(void* ptr, std::size_t sz) {
+    utils::FramePool::deallocate(ptr, sz);
+  }
+
 public:
 
   CoroutineHandle(Processor* processor, AbstractCoroutine* rootCoroutine);
@@ -604,12 +617,11 @@ public:
 public:
 
   static void* operator new(std::size_t sz) {
-    return ::operator new(sz);
+    return utils::FramePool::allocate(sz);
   }
 
   static void operator delete(void* ptr, std::size_t sz) {
-    (void)sz;
-    ::operator delete(ptr);
+    utils::FramePool::deallocate(ptr, sz);
   }
 
 public:
@@ -760,12 +772,11 @@ public:
 public:
 
   static void* operator new(std::size_t sz) {
-    return ::operator new(sz);
+    return utils::FramePool::allocate(sz);
   }
 
   static void operator delete(void* ptr, std::size_t sz) {
-    (void)sz;
-    ::operator delete(ptr);
+    utils::FramePool::deallocate(ptr, sz);
   }
 public:
 
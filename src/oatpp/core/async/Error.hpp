@@ -25,6 +25,7 @@
 #ifndef oatpp_async_Error_hpp
 #define oatpp_async_Error_hpp
 
+#include "oatpp/core/async/utils/FramePool.hpp"
 #include "oatpp/core/base/Countable.hpp"
 #include <string>
 
@@ -34,6 +35,16 @@ namespace oatpp { namespace async {
  * Class to hold and communicate errors between Coroutines
  */
 class Error : public std::runtime_error, public oatpp::base::Countable {
+public:
+
+  static void* operator new(std::size_t sz) {
+    return utils::FramePool::allocate(sz);
+  }
+
+  static void operator delete(void* ptr, std::size_t sz) {
+    utils::FramePool::deallocate(ptr, sz);
+  }
+
 public:
 
   /**
@@ -24,17 +24,22 @@
 
 #include "Executor.hpp"
 #include "oatpp/core/async/worker/IOEventWorker.hpp"
+#include "oatpp/core/async/worker/IOUringWorker.hpp"
 #include "oatpp/core/async/worker/IOWorker.hpp"
 #include "oatpp/core/async/worker/TimerWorker.hpp"
 
 namespace oatpp { namespace async {
 
+constexpr const v_int64 Executor::WORK_STEALING_INTERVAL_MICROS;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Executor::SubmissionProcessor
 
 Executor::SubmissionProcessor::SubmissionProcessor()
   : worker::Worker(worker::Worker::Type::PROCESSOR)
   , m_isRunning(true)
+  , m_workStealing(false)
+  , m_stealBalancer(0)
 {
   m_thread = std::thread(&Executor::SubmissionProcessor::run, this);
 }
@@ -43,10 +48,30 @@ oatpp::async::Processor& Executor::SubmissionProcessor::getProcessor() {
   return m_processor;
 }
 
+void Executor::SubmissionProcessor::enableWorkStealing(const std::vector<SubmissionProcessor*>& victims) {
+  m_stealVictims = victims;
+  m_workStealing = true;
+}
+
+void Executor::SubmissionProcessor::stealTasks() {
+  for(size_t i = 0; i < m_stealVictims.size(); i ++) {
+    auto victim = m_stealVictims[(m_stealBalancer ++) % m_stealVictims.size()];
+    if(m_processor.stealTasks(victim->getProcessor()) > 0) {
+      break;
+    }
+  }
+}
+
 void Executor::SubmissionProcessor::run() {
   
   while(m_isRunning) {
-    m_processor.waitForTasks();
+    if(m_workStealing) {
+      if(!m_processor.waitForTasks(std::chrono::microseconds(WORK_STEALING_INTERVAL_MICROS))) {
+        stealTasks();
+      }
+    } else {
+      m_processor.waitForTasks();
+    }
     while (m_processor.iterate(100)) {}
   }
   
@@ -75,10 +100,18 @@ void Executor::SubmissionProcessor::detach() {
   m_thread.detach();
 }
 
+v_int32 Executor::SubmissionProcessor::setThreadAffinityToOneCpu(v_int32 cpuIndex) {
+  return oatpp::concurrency::setThreadAffinityToOneCpu(m_thread.native_handle(), cpuIndex);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Executor
 
-Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int32 timerWorkersCount, v_int32 ioWorkerType)
+Executor::Executor(v_int32 processorWorkersCount,
+                   v_int32 ioWorkersCount,
+                   v_int32 timerWorkersCount,
+                   v_int32 ioWorkerType,
+                   bool workStealing)
   : m_balancer(0)
 {
 
@@ -93,7 +126,17 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
 
   m_allWorkers.insert(m_allWorkers.end(), m_processorWorkers.begin(), m_processorWorkers.end());
 
-  std::vector<std::shared_ptr<worker::Worker>> ioWorkers;
+  if(workStealing && m_processorWorkers.size() > 1) {
+    for(size_t i = 0; i < m_processorWorkers.size(); i ++) {
+      std::vector<SubmissionProcessor*> victims;
+      for(size_t j = 1; j < m_processorWorkers.size(); j ++) {
+        victims.push_back(m_processorWorkers[(i + j) % m_processorWorkers.size()].get());
+      }
+      m_processorWorkers[i]->enableWorkStealing(victims);
+    }
+  }
+
+  auto& ioWorkers = m_ioWorkers;
   ioWorkers.reserve(ioWorkersCount);
   switch(ioWorkerType) {
 
@@ -111,6 +154,13 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
       break;
     }
 
+    case IO_WORKER_TYPE_URING: {
+      for (v_int32 i = 0; i < ioWorkersCount; i++) {
+        ioWorkers.push_back(std::make_shared<worker::IOUringWorker>());
+      }
+      break;
+    }
+
     default:
       throw std::runtime_error("[oatpp::async::Executor::Executor()]: Error. Unknown IO worker type.");
 
@@ -118,7 +168,7 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
 
   linkWorkers(ioWorkers);
 
-  std::vector<std::shared_ptr<worker::Worker>> timerWorkers;
+  auto& timerWorkers = m_timerWorkers;
   timerWorkers.reserve(timerWorkersCount);
   for(v_int32 i = 0; i < timerWorkersCount; i++) {
     timerWorkers.push_back(std::make_shared<worker::TimerWorker>());
@@ -128,6 +178,38 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
 
 }
 
+std::shared_ptr<Executor> Executor::createSharded(v_int32 shardsCount, v_int32 ioWorkerType) {
+  shardsCount = chooseProcessorWorkersCount(shardsCount);
+  /* Equal number of processor, I/O and timer workers are linked one-to-one. See linkWorkers() */
+  auto executor = std::make_shared<Executor>(shardsCount, shardsCount, shardsCount, ioWorkerType, false);
+  executor->pinShards();
+  return executor;
+}
+
+void Executor::pinShards() {
+
+  v_int32 cpuCount = oatpp::concurrency::getHardwareConcurrency();
+
+  for(size_t i = 0; i < m_processorWorkers.size(); i ++) {
+
+    v_int32 cpuIndex = (v_int32) i % cpuCount;
+
+    v_int32 res = m_processorWorkers[i]->setThreadAffinityToOneCpu(cpuIndex);
+    if(res == 0) {
+      res = m_ioWorkers[i]->setThreadAffinityToOneCpu(cpuIndex);
+    }
+    if(res == 0) {
+      res = m_timerWorkers[i]->setThreadAffinityToOneCpu(cpuIndex);
+    }
+
+    if(res != 0) {
+      OATPP_LOGW("[oatpp::async::Executor::pinShards()]", "Warning. Failed to pin shard %d to CPU %d.", (v_int32) i, cpuIndex);
+    }
+
+  }
+
+}
+
 v_int32 Executor::chooseProcessorWorkersCount(v_int32 processorWorkersCount) {
   if(processorWorkersCount >= 1) {
     return processorWorkersCount;
@@ -172,6 +254,11 @@ v_int32 Executor::chooseIOWorkerType(v_int32 ioWorkerType) {
 #endif
   }
 
+  if(ioWorkerType == IO_WORKER_TYPE_URING && !worker::IOUringWorker::isSupported()) {
+    OATPP_LOGW("[oatpp::async::Executor::chooseIOWorkerType()]", "Warning. io_uring is not supported. Falling back to other IO worker type.");
+    return chooseIOWorkerType(VALUE_SUGGESTED);
+  }
+
   return ioWorkerType;
 
 }
@@ -259,5 +346,21 @@ void Executor::waitTasksFinished(const std::chrono::duration<v_int64, std::micro
   }
 
 }
+
+v_uint64 Executor::getStealAttemptsCount() {
+  v_uint64 result = 0;
+  for(const auto& procWorker : m_processorWorkers) {
+    result += procWorker->getProcessor().getStealAttemptsCount();
+  }
+  return result;
+}
+
+v_uint64 Executor::getStealSuccessesCount() {
+  v_uint64 result = 0;
+  for(const auto& procWorker : m_processorWorkers) {
+    result += procWorker->getProcessor().getStealSuccessesCount();
+  }
+  return result;
+}
   
 }}
@@ -50,8 +50,14 @@ private:
     oatpp::async::Processor m_processor;
   private:
     std::atomic<bool> m_isRunning;
+  private:
+    std::vector<SubmissionProcessor*> m_stealVictims;
+    std::atomic<bool> m_workStealing;
+    v_uint32 m_stealBalancer;
   private:
     std::thread m_thread;
+  private:
+    void stealTasks();
   public:
     SubmissionProcessor();
   public:
@@ -63,6 +69,8 @@ private:
 
     oatpp::async::Processor& getProcessor();
 
+    void enableWorkStealing(const std::vector<SubmissionProcessor*>& victims);
+
     void pushTasks(utils::FastQueue<CoroutineHandle>& tasks) override;
 
     void pushOneTask(CoroutineHandle* task) override;
@@ -74,6 +82,8 @@ private:
     void join() override;
 
     void detach() override;
+
+    v_int32 setThreadAffinityToOneCpu(v_int32 cpuIndex) override;
     
   };
 
@@ -93,10 +103,26 @@ public:
    * IO Worker type event.
    */
   static constexpr const v_int32 IO_WORKER_TYPE_EVENT = 1;
+
+  /**
+   * IO Worker type io_uring. Linux only. <br>
+   * If `io_uring` is not supported by the running kernel, Executor falls back to &l:Executor::IO_WORKER_TYPE_EVENT;.
+   */
+  static constexpr const v_int32 IO_WORKER_TYPE_URING = 2;
+
+  /**
+   * How long an idle processor sleeps before it tries to steal tasks from other processors again. <br>
+   * With work stealing enabled an idle processor is no longer parked until a task arrives - it wakes up
+   * once per interval (~1000 wake-ups per second per processor) and checks its victims. The check costs a few atomic
+   * operations per victim, but it keeps idle CPUs out of deep sleep states.
+   */
+  static constexpr const v_int64 WORK_STEALING_INTERVAL_MICROS = 1000;
 private:
   std::atomic<v_uint32> m_balancer;
 private:
   std::vector<std::shared_ptr<SubmissionProcessor>> m_processorWorkers;
+  std::vector<std::shared_ptr<worker::Worker>> m_ioWorkers;
+  std::vector<std::shared_ptr<worker::Worker>> m_timerWorkers;
   std::vector<std::shared_ptr<worker::Worker>> m_allWorkers;
 private:
   static v_int32 chooseProcessorWorkersCount(v_int32 processorWorkersCount);
@@ -104,6 +130,7 @@ private:
   static v_int32 chooseTimerWorkersCount(v_int32 timerWorkersCount);
   static v_int32 chooseIOWorkerType(v_int32 ioWorkerType);
   void linkWorkers(const std::vector<std::shared_ptr<worker::Worker>>& workers);
+  void pinShards();
 public:
 
   /**
@@ -112,11 +139,27 @@ public:
    * @param ioWorkersCount - number of I/O processing workers.
    * @param timerWorkersCount - number of timer processing workers.
    * @param IOWorkerType
+   * @param workStealing - if `true`, idle processors will take runnable coroutines from busy processors.
+   * Idle processors then poll for work every &l:Executor::WORK_STEALING_INTERVAL_MICROS; instead of sleeping until
+   * a task is submitted, so enable it only when the load is uneven enough to pay for the idle wake-ups.
    */
   Executor(v_int32 processorWorkersCount = VALUE_SUGGESTED,
            v_int32 ioWorkersCount = VALUE_SUGGESTED,
            v_int32 timerWorkersCount = VALUE_SUGGESTED,
-           v_int32 ioWorkerType = VALUE_SUGGESTED);
+           v_int32 ioWorkerType = VALUE_SUGGESTED,
+           bool workStealing = false);
+
+  /**
+   * Create executor in shard-per-core mode. <br>
+   * Each shard consists of one processor worker, one I/O worker and one timer worker, all pinned to the same CPU.
+   * Processor workers are linked only to the I/O and timer workers of their own shard and work stealing is disabled,
+   * so a coroutine stays on the shard it was submitted to for its whole life.
+   * @param shardsCount - number of shards. Default - hardware concurrency.
+   * @param ioWorkerType - type of I/O workers.
+   * @return - `std::shared_ptr` to Executor.
+   */
+  static std::shared_ptr<Executor> createSharded(v_int32 shardsCount = VALUE_SUGGESTED,
+                                                 v_int32 ioWorkerType = VALUE_SUGGESTED);
 
   /**
    * Non-virtual Destructor.
@@ -162,6 +205,18 @@ public:
    * @param timeout
    */
   void waitTasksFinished(const std::chrono::duration<v_int64, std::micro>& timeout = std::chrono::minutes(1));
+
+  /**
+   * Get number of attempts made by idle processors to steal tasks from other processors.
+   * @return - number of steal attempts.
+   */
+  v_uint64 getStealAttemptsCount();
+
+  /**
+   * Get number of successful attempts made by idle processors to steal tasks from other processors.
+   * @return - number of successful steal attempts.
+   */
+  v_uint64 getStealSuccessesCount();
   
 };
   
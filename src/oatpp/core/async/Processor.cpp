@@ -147,28 +147,137 @@ void Processor::addCoroutine(CoroutineHandle* coroutine) {
 }
 
 void Processor::pushOneTask(CoroutineHandle* coroutine) {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    m_pushList.pushBack(coroutine);
-  }
-  m_taskCondition.notify_one();
+  m_pushList.pushBack(coroutine);
+  m_taskNotifier.notify();
 }
 
 void Processor::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    utils::FastQueue<CoroutineHandle>::moveAll(tasks, m_pushList);
-  }
-  m_taskCondition.notify_one();
+  m_pushList.pushAll(tasks);
+  m_taskNotifier.notify();
+}
+
+bool Processor::hasPendingTasks() {
+  return !m_pushList.empty() || !m_taskList.empty();
 }
 
 void Processor::waitForTasks() {
+  while (!hasPendingTasks() && m_running) {
+    m_taskNotifier.announceWait();
+    if(hasPendingTasks() || !m_running) {
+      m_taskNotifier.cancelWait();
+      break;
+    }
+    m_taskNotifier.wait();
+  }
+}
 
-  std::unique_lock<oatpp::concurrency::SpinLock> lock(m_taskLock);
-  while (m_pushList.first == nullptr && m_taskList.empty() && m_running) {
-    m_taskCondition.wait(lock);
+bool Processor::waitForTasks(const std::chrono::microseconds& timeout) {
+  if(!hasPendingTasks() && m_running) {
+    m_taskNotifier.announceWait();
+    if(hasPendingTasks() || !m_running) {
+      m_taskNotifier.cancelWait();
+    } else {
+      m_taskNotifier.wait(timeout);
+    }
   }
+  return hasPendingTasks();
+}
+
+v_int32 Processor::stealTasks(Processor& victim) {
 
+  if(&victim == this) {
+    return 0;
+  }
+
+  ++ m_stealAttempts;
+
+  utils::FastQueue<TaskSubmission> pendingSubmissions;
+  utils::FastQueue<CoroutineHandle> pendingCoroutines;
+
+  victim.m_taskList.popAll(pendingSubmissions);
+  victim.m_pushList.popAll(pendingCoroutines);
+
+  v_int32 pending = pendingSubmissions.count + pendingCoroutines.count;
+  if(pending == 0) {
+    Processor* expected = nullptr;
+    victim.m_stealRequester.compare_exchange_strong(expected, this);
+    return 0;
+  }
+
+  utils::FastQueue<TaskSubmission> stolenSubmissions;
+  utils::FastQueue<CoroutineHandle> stolenCoroutines;
+
+  v_int32 quota = (pending + 1) / 2;
+
+  while(quota > 0 && pendingSubmissions.first != nullptr) {
+    stolenSubmissions.pushBack(pendingSubmissions.popFront());
+    -- quota;
+  }
+
+  while(quota > 0 && pendingCoroutines.first != nullptr) {
+    stolenCoroutines.pushBack(pendingCoroutines.popFront());
+    -- quota;
+  }
+
+  if(pendingSubmissions.first != nullptr) {
+    victim.m_taskList.pushAll(pendingSubmissions);
+  }
+  if(pendingCoroutines.first != nullptr) {
+    victim.m_pushList.pushAll(pendingCoroutines);
+  }
+
+  v_int32 count = stolenCoroutines.count + stolenSubmissions.count;
+  m_tasksCounter += count;
+  victim.m_tasksCounter -= count;
+
+  for(auto curr = stolenCoroutines.first; curr != nullptr; curr = curr->_ref) {
+    curr->_PP = this;
+  }
+
+  m_taskList.pushAll(stolenSubmissions);
+  m_pushList.pushAll(stolenCoroutines);
+
+  ++ m_stealSuccesses;
+  return count;
+
+}
+
+void Processor::donateTasks() {
+
+  Processor* thief = m_stealRequester.exchange(nullptr);
+  if(thief == nullptr) {
+    return;
+  }
+
+  utils::FastQueue<CoroutineHandle> donation;
+  v_int32 quota = m_queue.count / 2;
+
+  for(v_int32 i = 0; i < quota; i ++) {
+    auto CP = m_queue.popFront();
+    if(CP->finished()) {
+      m_queue.pushBack(CP);
+    } else {
+      CP->_PP = thief;
+      CP->_SCH_A = Action::createActionByType(Action::TYPE_NONE);
+      donation.pushBack(CP);
+    }
+  }
+
+  if(donation.count > 0) {
+    thief->m_tasksCounter += donation.count;
+    m_tasksCounter -= donation.count;
+    ++ thief->m_stealSuccesses;
+    thief->pushTasks(donation);
+  }
+
+}
+
+v_uint64 Processor::getStealAttemptsCount() {
+  return m_stealAttempts.load();
+}
+
+v_uint64 Processor::getStealSuccessesCount() {
+  return m_stealSuccesses.load();
 }
 
 void Processor::popTasks() {
@@ -188,21 +297,20 @@ void Processor::popTasks() {
 }
 
 void Processor::consumeAllTasks() {
-  for(auto& submission : m_taskList) {
-    m_queue.pushBack(submission->createCoroutine(this));
+  utils::FastQueue<TaskSubmission> submissions;
+  m_taskList.popAll(submissions);
+  while(submissions.first != nullptr) {
+    m_queue.pushBack(submissions.first->createCoroutine(this));
+    submissions.popFrontNoData();
   }
-  m_taskList.clear();
 }
 
 void Processor::pushQueues() {
 
-  utils::FastQueue<CoroutineHandle> tmpList;
+  consumeAllTasks();
 
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    consumeAllTasks();
-    utils::FastQueue<CoroutineHandle>::moveAll(m_pushList, tmpList);
-  }
+  utils::FastQueue<CoroutineHandle> tmpList;
+  m_pushList.popAll(tmpList);
 
   while(tmpList.first != nullptr) {
     addCoroutine(tmpList.popFront());
@@ -261,19 +369,16 @@ bool Processor::iterate(v_int32 numIterations) {
 
   }
 
+  donateTasks();
   popTasks();
 
-  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-  return m_queue.first != nullptr || m_pushList.first != nullptr || !m_taskList.empty();
+  return m_queue.first != nullptr || hasPendingTasks();
   
 }
 
 void Processor::stop() {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    m_running = false;
-  }
-  m_taskCondition.notify_one();
+  m_running = false;
+  m_taskNotifier.notify();
 
   m_coroutineWaitListsWithTimeoutsCV.notify_one();
   m_coroutineWaitListTimeoutChecker.join();
@@ -29,9 +29,10 @@
 #include "./Coroutine.hpp"
 #include "./CoroutineWaitList.hpp"
 #include "oatpp/core/async/utils/FastQueue.hpp"
+#include "oatpp/core/async/utils/MPSCQueue.hpp"
+#include "oatpp/core/async/utils/Notifier.hpp"
 
 #include <condition_variable>
-#include <list>
 #include <mutex>
 #include <set>
 #include <vector>
@@ -48,6 +49,18 @@ class Processor {
 private:
 
   class TaskSubmission {
+  public:
+
+    static void* operator new(std::size_t sz) {
+      return utils::FramePool::allocate(sz);
+    }
+
+    static void operator delete(void* ptr, std::size_t sz) {
+      utils::FramePool::deallocate(ptr, sz);
+    }
+
+  public:
+    TaskSubmission* _ref = nullptr;
   public:
     virtual ~TaskSubmission() = default;
     virtual CoroutineHandle* createCoroutine(Processor* processor) = 0;
@@ -101,10 +114,9 @@ private:
 
 private:
 
-  oatpp::concurrency::SpinLock m_taskLock;
-  std::condition_variable_any m_taskCondition;
-  std::list<std::shared_ptr<TaskSubmission>> m_taskList;
-  utils::FastQueue<CoroutineHandle> m_pushList;
+  utils::Notifier m_taskNotifier;
+  utils::MPSCQueue<TaskSubmission> m_taskList;
+  utils::MPSCQueue<CoroutineHandle> m_pushList;
 
 private:
 
@@ -115,6 +127,12 @@ private:
   std::atomic_bool m_running{true};
   std::atomic<v_int32> m_tasksCounter{0};
 
+private:
+
+  std::atomic<Processor*> m_stealRequester{nullptr};
+  std::atomic<v_uint64> m_stealAttempts{0};
+  std::atomic<v_uint64> m_stealSuccesses{0};
+
 private:
 
   std::recursive_mutex m_coroutineWaitListsWithTimeoutsMutex;
@@ -135,6 +153,8 @@ private:
   void addCoroutine(CoroutineHandle* coroutine);
   void popTasks();
   void pushQueues();
+  void donateTasks();
+  bool hasPendingTasks();
 
 public:
 
@@ -166,13 +186,9 @@ public:
    */
   template<typename CoroutineType, typename ... Args>
   void execute(Args... params) {
-    auto submission = std::make_shared<SubmissionTemplate<CoroutineType, Args...>>(params...);
     ++ m_tasksCounter;
-    {
-      std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-      m_taskList.push_back(submission);
-    }
-    m_taskCondition.notify_one();
+    m_taskList.pushBack(new SubmissionTemplate<CoroutineType, Args...>(params...));
+    m_taskNotifier.notify();
   }
 
   /**
@@ -180,6 +196,35 @@ public:
    */
   void waitForTasks();
 
+  /**
+   * Sleep and wait for tasks, but not longer than the specified timeout.
+   * @param timeout - maximum time to wait.
+   * @return - `true` if there are tasks to process.
+   */
+  bool waitForTasks(const std::chrono::microseconds& timeout);
+
+  /**
+   * Take runnable tasks from other processor and reschedule them to this processor. <br>
+   * Tasks which are not yet picked up by the victim's thread (not-yet-created submissions and
+   * coroutines pushed back by co-workers) are taken immediately - half of them is kept and the rest is given back. If there are no such tasks,
+   * the victim is asked to donate half of its active coroutines on its next iteration.
+   * @param victim - processor to steal tasks from.
+   * @return - number of tasks stolen immediately.
+   */
+  v_int32 stealTasks(Processor& victim);
+
+  /**
+   * Get number of steal attempts made by this processor.
+   * @return - number of steal attempts.
+   */
+  v_uint64 getStealAttemptsCount();
+
+  /**
+   * Get number of successful steal attempts made by this processor.
+   * @return - number of steal attempts which brought at least one task.
+   */
+  v_uint64 getStealSuccessesCount();
+
   /**
    * Iterate Coroutines.
    * @param numIterations - number of iterations.
@@ -0,0 +1,360 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "FramePool.hpp"
+
+#include "oatpp/core/concurrency/SpinLock.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+
+namespace oatpp { namespace async { namespace utils {
+
+namespace {
+
+struct Block {
+  Block* next;
+};
+
+struct FreeList {
+  Block* head = nullptr;
+  v_int32 count = 0;
+};
+
+void incCounter(std::atomic<v_uint64>& counter, v_uint64 value = 1) {
+  /* only the owner thread writes the counter - no need for read-modify-write */
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+class ThreadCache; // FWD
+
+struct Depot {
+
+  oatpp::concurrency::SpinLock locks[FramePool::CLASSES_COUNT];
+  FreeList lists[FramePool::CLASSES_COUNT];
+
+  std::mutex registryMutex;
+  std::set<ThreadCache*> caches;
+  FramePool::Stats retiredStats;
+
+  std::atomic<v_uint64> allocations{0};
+  std::atomic<v_uint64> deallocations{0};
+  std::atomic<v_uint64> systemAllocations{0};
+  std::atomic<v_uint64> systemDeallocations{0};
+
+  /*
+   * Move up to `count` blocks from the depot list to `to`.
+   */
+  void take(v_buff_size classIndex, FreeList& to, v_int32 count) {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(locks[classIndex]);
+    FreeList& from = lists[classIndex];
+    while(count > 0 && from.head != nullptr) {
+      Block* block = from.head;
+      from.head = block->next;
+      from.count --;
+      block->next = to.head;
+      to.head = block;
+      to.count ++;
+      count --;
+    }
+  }
+
+  /*
+   * Move up to `count` blocks from `from` to the depot list.
+   * Blocks exceeding FramePool::MAX_DEPOT_BLOCKS are returned to the system allocator.
+   * Returns number of blocks returned to the system allocator.
+   */
+  v_int32 give(v_buff_size classIndex, FreeList& from, v_int32 count) {
+
+    if(from.head == nullptr || count <= 0) {
+      return 0;
+    }
+
+    Block* first = from.head;
+    Block* last = first;
+    v_int32 moved = 1;
+    while(moved < count && last->next != nullptr) {
+      last = last->next;
+      moved ++;
+    }
+
+    from.head = last->next;
+    from.count -= moved;
+
+    FreeList excess;
+
+    {
+      std::lock_guard<oatpp::concurrency::SpinLock> lock(locks[classIndex]);
+      FreeList& list = lists[classIndex];
+      last->next = list.head;
+      list.head = first;
+      list.count += moved;
+      while(list.count > FramePool::MAX_DEPOT_BLOCKS) {
+        Block* block = list.head;
+        list.head = block->next;
+        list.count --;
+        block->next = excess.head;
+        excess.head = block;
+        excess.count ++;
+      }
+    }
+
+    Block* block = excess.head;
+    while(block != nullptr) {
+      Block* next = block->next;
+      ::operator delete(block);
+      block = next;
+    }
+
+    return excess.count;
+
+  }
+
+};
+
+Depot& getDepot() {
+  /* never destroyed - blocks may be freed by threads outliving static destructors */
+  static Depot* depot = new Depot();
+  return *depot;
+}
+
+class ThreadCache {
+public:
+
+  FreeList lists[FramePool::CLASSES_COUNT];
+
+  std::atomic<v_uint64> allocations{0};
+  std::atomic<v_uint64> deallocations{0};
+  std::atomic<v_uint64> systemAllocations{0};
+  std::atomic<v_uint64> systemDeallocations{0};
+
+public:
+
+  ThreadCache() {
+    Depot& depot = getDepot();
+    std::lock_guard<std::mutex> lock(depot.registryMutex);
+    depot.caches.insert(this);
+  }
+
+  ~ThreadCache() {
+    Depot& depot = getDepot();
+    for(v_buff_size i = 0; i < FramePool::CLASSES_COUNT; i ++) {
+      depot.systemDeallocations += depot.give(i, lists[i], lists[i].count);
+    }
+    std::lock_guard<std::mutex> lock(depot.registryMutex);
+    depot.retiredStats.allocations += allocations.load(std::memory_order_relaxed);
+    depot.retiredStats.deallocations += deallocations.load(std::memory_order_relaxed);
+    depot.retiredStats.systemAllocations += systemAllocations.load(std::memory_order_relaxed);
+    depot.retiredStats.systemDeallocations += systemDeallocations.load(std::memory_order_relaxed);
+    depot.caches.erase(this);
+  }
+
+};
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+
+enum ThreadCacheState : v_int32 {
+  CACHE_STATE_NONE = 0,
+  CACHE_STATE_ALIVE = 1,
+  CACHE_STATE_DESTROYED = 2
+};
+
+thread_local ThreadCacheState threadCacheState = CACHE_STATE_NONE;
+
+class ThreadCacheHolder {
+public:
+  ThreadCache cache;
+public:
+  ThreadCacheHolder() {
+    threadCacheState = CACHE_STATE_ALIVE;
+  }
+  ~ThreadCacheHolder() {
+    threadCacheState = CACHE_STATE_DESTROYED;
+  }
+};
+
+ThreadCache* getThreadCache() {
+  /* blocks freed by other thread_local destructors after the cache is gone go straight to the depot */
+  if(threadCacheState == CACHE_STATE_DESTROYED) {
+    return nullptr;
+  }
+  static thread_local ThreadCacheHolder holder;
+  return &holder.cache;
+}
+
+#else
+
+ThreadCache* getThreadCache() {
+  return nullptr;
+}
+
+#endif
+
+}
+
+void* FramePool::allocate(v_buff_size size) {
+
+#ifdef OATPP_DISABLE_POOL_ALLOCATIONS
+  return ::operator new(size);
+#else
+
+  if(size <= 0 || size > MAX_BLOCK_SIZE) {
+    ThreadCache* cache = getThreadCache();
+    if(cache) {
+      incCounter(cache->allocations);
+      incCounter(cache->systemAllocations);
+    } else {
+      getDepot().allocations ++;
+      getDepot().systemAllocations ++;
+    }
+    return ::operator new(size);
+  }
+
+  v_buff_size classIndex = (size - 1) / GRANULARITY;
+  ThreadCache* cache = getThreadCache();
+
+  if(cache) {
+
+    incCounter(cache->allocations);
+
+    FreeList& list = cache->lists[classIndex];
+    if(list.head == nullptr) {
+      getDepot().take(classIndex, list, MAX_THREAD_CACHED_BLOCKS / 2);
+    }
+
+    if(list.head != nullptr) {
+      Block* block = list.head;
+      list.head = block->next;
+      list.count --;
+      return block;
+    }
+
+    incCounter(cache->systemAllocations);
+
+  } else {
+
+    Depot& depot = getDepot();
+    depot.allocations ++;
+
+    FreeList list;
+    depot.take(classIndex, list, 1);
+    if(list.head != nullptr) {
+      return list.head;
+    }
+
+    depot.systemAllocations ++;
+
+  }
+
+  return ::operator new((classIndex + 1) * GRANULARITY);
+
+#endif
+
+}
+
+void FramePool::deallocate(void* ptr, v_buff_size size) {
+
+  if(ptr == nullptr) {
+    return;
+  }
+
+#ifdef OATPP_DISABLE_POOL_ALLOCATIONS
+  (void)size;
+  ::operator delete(ptr);
+#else
+
+  ThreadCache* cache = getThreadCache();
+
+  if(size <= 0 || size > MAX_BLOCK_SIZE) {
+    if(cache) {
+      incCounter(cache->deallocations);
+      incCounter(cache->systemDeallocations);
+    } else {
+      getDepot().deallocations ++;
+      getDepot().systemDeallocations ++;
+    }
+    ::operator delete(ptr);
+    return;
+  }
+
+  v_buff_size classIndex = (size - 1) / GRANULARITY;
+  Block* block = static_cast<Block*>(ptr);
+
+  if(cache) {
+
+    incCounter(cache->deallocations);
+
+    FreeList& list = cache->lists[classIndex];
+    block->next = list.head;
+    list.head = block;
+    list.count ++;
+
+    if(list.count > MAX_THREAD_CACHED_BLOCKS) {
+      incCounter(cache->systemDeallocations, getDepot().give(classIndex, list, MAX_THREAD_CACHED_BLOCKS / 2));
+    }
+
+  } else {
+
+    Depot& depot = getDepot();
+    depot.deallocations ++;
+
+    FreeList list;
+    block->next = nullptr;
+    list.head = block;
+    list.count = 1;
+    depot.systemDeallocations += depot.give(classIndex, list, 1);
+
+  }
+
+#endif
+
+}
+
+FramePool::Stats FramePool::getStats() {
+
+  Depot& depot = getDepot();
+  Stats result;
+
+  std::lock_guard<std::mutex> lock(depot.registryMutex);
+
+  result = depot.retiredStats;
+
+  result.allocations += depot.allocations.load();
+  result.deallocations += depot.deallocations.load();
+  result.systemAllocations += depot.systemAllocations.load();
+  result.systemDeallocations += depot.systemDeallocations.load();
+
+  for(ThreadCache* cache : depot.caches) {
+    result.allocations += cache->allocations.load(std::memory_order_relaxed);
+    result.deallocations += cache->deallocations.load(std::memory_order_relaxed);
+    result.systemAllocations += cache->systemAllocations.load(std::memory_order_relaxed);
+    result.systemDeallocations += cache->systemDeallocations.load(std::memory_order_relaxed);
+  }
+
+  return result;
+
+}
+
+}}}
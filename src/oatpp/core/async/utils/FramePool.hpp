@@ -0,0 +1,164 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_FramePool_hpp
+#define oatpp_async_utils_FramePool_hpp
+
+#include "oatpp/core/base/Environment.hpp"
+
+#include <new>
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Size-class memory pool for objects living on the async path - coroutine frames,
+ * &id:oatpp::async::CoroutineHandle;, &id:oatpp::async::Error; and task submissions. <br>
+ * Each thread keeps its own free lists (one list per size class), so a Processor thread allocating and
+ * freeing coroutines does not touch the system allocator nor take any lock.
+ * Threads exchange blocks in batches through a shared depot when their lists grow too long or run empty. <br>
+ * Free memory kept by the pool is bounded - see &l:FramePool::MAX_THREAD_CACHED_BLOCKS; and &l:FramePool::MAX_DEPOT_BLOCKS;. <br>
+ * Allocations bigger than &l:FramePool::MAX_BLOCK_SIZE; are forwarded to `::operator new`. <br>
+ * Define `OATPP_DISABLE_POOL_ALLOCATIONS` to forward all allocations to `::operator new`.
+ */
+class FramePool {
+public:
+
+  /**
+   * Size-class granularity.
+   */
+  static constexpr v_buff_size GRANULARITY = 16;
+
+  /**
+   * Max size of a pooled block.
+   */
+  static constexpr v_buff_size MAX_BLOCK_SIZE = 1024;
+
+  /**
+   * Number of size classes.
+   */
+  static constexpr v_buff_size CLASSES_COUNT = MAX_BLOCK_SIZE / GRANULARITY;
+
+  /**
+   * Max number of free blocks of one size class kept by a thread.
+   * When exceeded, half of the blocks are moved to the shared depot.
+   */
+  static constexpr v_int32 MAX_THREAD_CACHED_BLOCKS = 256;
+
+  /**
+   * Max number of free blocks of one size class kept in the shared depot.
+   * Blocks exceeding the limit are returned to the system allocator,
+   * so memory taken during a load spike is given back once the spike is over.
+   */
+  static constexpr v_int32 MAX_DEPOT_BLOCKS = 1024;
+
+  /**
+   * Allocation statistics.
+   */
+  struct Stats {
+
+    /**
+     * Total number of allocations.
+     */
+    v_uint64 allocations = 0;
+
+    /**
+     * Total number of deallocations.
+     */
+    v_uint64 deallocations = 0;
+
+    /**
+     * Number of allocations served by the system allocator (pool miss or oversized block).
+     */
+    v_uint64 systemAllocations = 0;
+
+    /**
+     * Number of deallocations returned to the system allocator.
+     */
+    v_uint64 systemDeallocations = 0;
+
+  };
+
+public:
+
+  /**
+   * Allocate memory block.
+   * @param size - size of the block.
+   * @return - pointer to allocated memory.
+   */
+  static void* allocate(v_buff_size size);
+
+  /**
+   * Free memory block previously allocated with &l:FramePool::allocate ();.
+   * @param ptr - pointer to memory block.
+   * @param size - size of the block. Must be the same as passed to &l:FramePool::allocate ();.
+   */
+  static void deallocate(void* ptr, v_buff_size size);
+
+  /**
+   * Get allocation statistics summed over all threads.
+   * @return - &l:FramePool::Stats;.
+   */
+  static Stats getStats();
+
+};
+
+/**
+ * STL-compatible allocator backed by &l:FramePool;. <br>
+ * Use it with `std::allocate_shared` and with node-based containers on the async path.
+ * @tparam T - type of allocated objects.
+ */
+template<typename T>
+class FramePoolAllocator {
+public:
+  typedef T value_type;
+public:
+
+  FramePoolAllocator() = default;
+
+  template<typename U>
+  FramePoolAllocator(const FramePoolAllocator<U>&) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(FramePool::allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) {
+    FramePool::deallocate(ptr, n * sizeof(T));
+  }
+
+  template<typename U>
+  bool operator==(const FramePoolAllocator<U>&) const {
+    return true;
+  }
+
+  template<typename U>
+  bool operator!=(const FramePoolAllocator<U>&) const {
+    return false;
+  }
+
+};
+
+}}}
+
+#endif // oatpp_async_utils_FramePool_hpp
@@ -0,0 +1,153 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_MPSCQueue_hpp
+#define oatpp_async_utils_MPSCQueue_hpp
+
+#include "./FastQueue.hpp"
+
+#include <atomic>
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Intrusive lock-free multi-producer queue. Entries are linked through their `_ref` field - same as in &l:FastQueue;. <br>
+ * Producers push entries with a single CAS. Consumers take all pending entries at once with a single exchange,
+ * so there is no ABA problem and more than one thread may take entries (used for work stealing). <br>
+ * The order of entries pushed by one producer is preserved.
+ * @tparam T - entry type.
+ */
+template<typename T>
+class MPSCQueue {
+private:
+
+  /*
+   * Newest entry first.
+   */
+  std::atomic<T*> m_head;
+
+public:
+
+  MPSCQueue()
+    : m_head(nullptr)
+  {}
+
+  ~MPSCQueue() {
+    FastQueue<T> remaining;
+    popAll(remaining);
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  /**
+   * Push one entry. Thread-safe.
+   * @param entry - entry to push.
+   */
+  void pushBack(T* entry) {
+    T* head = m_head.load(std::memory_order_relaxed);
+    do {
+      entry->_ref = head;
+    } while(!m_head.compare_exchange_weak(head, entry));
+  }
+
+  /**
+   * Move all entries from &l:FastQueue; to this queue. Thread-safe.
+   * @param queue - source queue. Empty after the call.
+   */
+  void pushAll(FastQueue<T>& queue) {
+
+    if(queue.first == nullptr) {
+      return;
+    }
+
+    T* newest = nullptr;
+    T* curr = queue.first;
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      curr->_ref = newest;
+      newest = curr;
+      curr = next;
+    }
+
+    T* oldest = queue.first;
+    queue.first = nullptr;
+    queue.last = nullptr;
+    queue.count = 0;
+
+    T* head = m_head.load(std::memory_order_relaxed);
+    do {
+      oldest->_ref = head;
+    } while(!m_head.compare_exchange_weak(head, newest));
+
+  }
+
+  /**
+   * Take all entries and append them to the back of &l:FastQueue; in the push order. Thread-safe.
+   * @param queue - destination queue.
+   * @return - number of entries taken.
+   */
+  v_int32 popAll(FastQueue<T>& queue) {
+
+    T* curr = m_head.exchange(nullptr);
+    if(curr == nullptr) {
+      return 0;
+    }
+
+    T* last = curr;
+    T* oldest = nullptr;
+    v_int32 count = 0;
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      curr->_ref = oldest;
+      oldest = curr;
+      curr = next;
+      count ++;
+    }
+
+    if(queue.last == nullptr) {
+      queue.first = oldest;
+    } else {
+      queue.last->_ref = oldest;
+    }
+    queue.last = last;
+    queue.count += count;
+
+    return count;
+
+  }
+
+  /**
+   * Check if queue has no entries.
+   * @return - `true` if queue is empty.
+   */
+  bool empty() const {
+    return m_head.load() == nullptr;
+  }
+
+};
+
+}}}
+
+#endif // oatpp_async_utils_MPSCQueue_hpp
@@ -0,0 +1,95 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Notifier.hpp"
+
+#if defined(__linux__)
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+  #include <ctime>
+#endif
+
+namespace oatpp { namespace async { namespace utils {
+
+Notifier::Notifier()
+  : m_waiting(0)
+{}
+
+void Notifier::announceWait() {
+  m_waiting.store(1);
+}
+
+void Notifier::cancelWait() {
+  m_waiting.store(0);
+}
+
+#if defined(__linux__)
+
+void Notifier::wait(const std::chrono::microseconds& timeout) {
+
+  if(timeout.count() < 0) {
+    syscall(SYS_futex, reinterpret_cast<v_int32*>(&m_waiting), FUTEX_WAIT_PRIVATE, 1, nullptr, nullptr, 0);
+  } else {
+    struct timespec ts;
+    ts.tv_sec = (time_t) (timeout.count() / 1000000);
+    ts.tv_nsec = (long) ((timeout.count() % 1000000) * 1000);
+    syscall(SYS_futex, reinterpret_cast<v_int32*>(&m_waiting), FUTEX_WAIT_PRIVATE, 1, &ts, nullptr, 0);
+  }
+
+  m_waiting.store(0);
+
+}
+
+void Notifier::notify() {
+  if(m_waiting.exchange(0) == 1) {
+    syscall(SYS_futex, reinterpret_cast<v_int32*>(&m_waiting), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+  }
+}
+
+#else
+
+void Notifier::wait(const std::chrono::microseconds& timeout) {
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if(timeout.count() < 0) {
+    m_condition.wait(lock, [this]{ return m_waiting.load() == 0; });
+  } else {
+    m_condition.wait_for(lock, timeout, [this]{ return m_waiting.load() == 0; });
+  }
+
+  m_waiting.store(0);
+
+}
+
+void Notifier::notify() {
+  if(m_waiting.exchange(0) == 1) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_condition.notify_one();
+  }
+}
+
+#endif
+
+}}}
@@ -0,0 +1,87 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_utils_Notifier_hpp
+#define oatpp_async_utils_Notifier_hpp
+
+#include "oatpp/core/base/Environment.hpp"
+
+#include <atomic>
+#include <chrono>
+
+#if !defined(__linux__)
+  #include <condition_variable>
+  #include <mutex>
+#endif
+
+namespace oatpp { namespace async { namespace utils {
+
+/**
+ * Single-waiter wakeup primitive for lock-free queues. <br>
+ * Waiter: &l:Notifier::announceWait ();, re-check the queue, then &l:Notifier::wait (); or &l:Notifier::cancelWait ();. <br>
+ * Producer: push to the queue, then &l:Notifier::notify ();. <br>
+ * `notify()` costs one atomic exchange when there is no sleeping waiter. On Linux the waiter sleeps on a futex,
+ * on other platforms - on a condition variable.
+ */
+class Notifier {
+private:
+  std::atomic<v_int32> m_waiting;
+#if !defined(__linux__)
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+#endif
+public:
+
+  /**
+   * Constructor.
+   */
+  Notifier();
+
+  /**
+   * Announce that the waiter is about to sleep. Must be followed by the re-check of the wait condition.
+   */
+  void announceWait();
+
+  /**
+   * Cancel announced wait.
+   */
+  void cancelWait();
+
+  /**
+   * Sleep until &l:Notifier::notify (); is called after the &l:Notifier::announceWait ();, or timeout expires.
+   * May return spuriously.
+   * @param timeout - max time to sleep. Negative value - no timeout.
+   */
+  void wait(const std::chrono::microseconds& timeout = std::chrono::microseconds(-1));
+
+  /**
+   * Wake the waiter if it's sleeping or has announced the wait.
+   */
+  void notify();
+
+};
+
+}}}
+
+#endif // oatpp_async_utils_Notifier_hpp
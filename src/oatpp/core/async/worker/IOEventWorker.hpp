@@ -138,6 +138,13 @@ public:
    */
   void detach() override;
 
+  /**
+   * Pin worker-thread to one CPU.
+   * @param cpuIndex - index of CPU.
+   * @return - zero on success. Negative value on failure.
+   */
+  v_int32 setThreadAffinityToOneCpu(v_int32 cpuIndex) override;
+
 };
 
 /**
@@ -187,6 +194,13 @@ public:
    */
   void detach() override;
 
+  /**
+   * Pin reader and writer worker-threads to one CPU.
+   * @param cpuIndex - index of CPU.
+   * @return - zero on success. Negative value on failure.
+   */
+  v_int32 setThreadAffinityToOneCpu(v_int32 cpuIndex) override;
+
 };
 
 }}}
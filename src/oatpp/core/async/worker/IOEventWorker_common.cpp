@@ -24,6 +24,8 @@
 
 #include "IOEventWorker.hpp"
 
+#include "oatpp/core/concurrency/Thread.hpp"
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #else
@@ -109,6 +111,10 @@ void IOEventWorker::detach() {
   m_thread.detach();
 }
 
+v_int32 IOEventWorker::setThreadAffinityToOneCpu(v_int32 cpuIndex) {
+  return oatpp::concurrency::setThreadAffinityToOneCpu(m_thread.native_handle(), cpuIndex);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // IOEventWorkerForeman
 
@@ -194,4 +200,12 @@ void IOEventWorkerForeman::detach() {
   m_writer.detach();
 }
 
+v_int32 IOEventWorkerForeman::setThreadAffinityToOneCpu(v_int32 cpuIndex) {
+  v_int32 res = m_reader.setThreadAffinityToOneCpu(cpuIndex);
+  if(res == 0) {
+    res = m_writer.setThreadAffinityToOneCpu(cpuIndex);
+  }
+  return res;
+}
+
 }}}
@@ -0,0 +1,551 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOUringWorker.hpp"
+#include "oatpp/core/concurrency/Thread.hpp"
+
+#ifdef OATPP_IO_URING_INTERFACE_SUPPORTED
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// io_uring based implementation
+
+#include "oatpp/core/async/Processor.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+namespace oatpp { namespace async { namespace worker {
+
+namespace {
+
+/* user_data of the wakeup poll. Coroutine polls carry index of their slot */
+const __u64 WAKEUP_POLL_DATA = ~((__u64) 0);
+
+int sys_io_uring_setup(unsigned entries, struct io_uring_params* params) {
+  return (int) ::syscall(__NR_io_uring_setup, entries, params);
+}
+
+int sys_io_uring_enter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+  return (int) ::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0);
+}
+
+}
+
+struct IOUringWorker::Ring {
+
+  int fd = -1;
+
+  void* sqPtr = MAP_FAILED;
+  size_t sqSize = 0;
+  void* cqPtr = MAP_FAILED;
+  size_t cqSize = 0;
+  struct io_uring_sqe* sqes = (struct io_uring_sqe*) MAP_FAILED;
+  size_t sqesSize = 0;
+
+  unsigned* sqHead = nullptr;
+  unsigned* sqTail = nullptr;
+  unsigned* sqMask = nullptr;
+  unsigned* sqEntries = nullptr;
+  unsigned* sqArray = nullptr;
+
+  unsigned* cqHead = nullptr;
+  unsigned* cqTail = nullptr;
+  unsigned* cqMask = nullptr;
+  struct io_uring_cqe* cqes = nullptr;
+
+  unsigned cqCapacity = 0;
+
+  unsigned sqeTail = 0;
+  unsigned sqeSubmitted = 0;
+
+  ~Ring() {
+    if(sqes != MAP_FAILED) {
+      ::munmap(sqes, sqesSize);
+    }
+    if(cqPtr != MAP_FAILED && cqPtr != sqPtr) {
+      ::munmap(cqPtr, cqSize);
+    }
+    if(sqPtr != MAP_FAILED) {
+      ::munmap(sqPtr, sqSize);
+    }
+    if(fd >= 0) {
+      ::close(fd);
+    }
+  }
+
+  bool init(unsigned entries) {
+
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(struct io_uring_params));
+
+    fd = sys_io_uring_setup(entries, &params);
+    if(fd < 0) {
+      return false;
+    }
+
+    sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if(singleMmap && cqSize > sqSize) {
+      sqSize = cqSize;
+    }
+
+    sqPtr = ::mmap(nullptr, sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if(sqPtr == MAP_FAILED) {
+      return false;
+    }
+
+    if(singleMmap) {
+      cqPtr = sqPtr;
+    } else {
+      cqPtr = ::mmap(nullptr, cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+      if(cqPtr == MAP_FAILED) {
+        return false;
+      }
+    }
+
+    sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    sqes = (struct io_uring_sqe*) ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if(sqes == MAP_FAILED) {
+      return false;
+    }
+
+    p_char8 sq = (p_char8) sqPtr;
+    sqHead = (unsigned*) (sq + params.sq_off.head);
+    sqTail = (unsigned*) (sq + params.sq_off.tail);
+    sqMask = (unsigned*) (sq + params.sq_off.ring_mask);
+    sqEntries = (unsigned*) (sq + params.sq_off.ring_entries);
+    sqArray = (unsigned*) (sq + params.sq_off.array);
+
+    p_char8 cq = (p_char8) cqPtr;
+    cqHead = (unsigned*) (cq + params.cq_off.head);
+    cqTail = (unsigned*) (cq + params.cq_off.tail);
+    cqMask = (unsigned*) (cq + params.cq_off.ring_mask);
+    cqes = (struct io_uring_cqe*) (cq + params.cq_off.cqes);
+
+    cqCapacity = params.cq_entries;
+
+    sqeTail = *sqTail;
+    sqeSubmitted = sqeTail;
+
+    return true;
+
+  }
+
+  /*
+   * Publish prepared submissions and enter the kernel.
+   * Returns -errno on failure.
+   */
+  int enter(unsigned minComplete, unsigned flags) {
+    __atomic_store_n(sqTail, sqeTail, __ATOMIC_RELEASE);
+    unsigned toSubmit = sqeTail - sqeSubmitted;
+    int res = sys_io_uring_enter(fd, toSubmit, minComplete, flags);
+    if(res < 0) {
+      return -errno;
+    }
+    sqeSubmitted += (unsigned) res;
+    return res;
+  }
+
+  struct io_uring_sqe* getSqe() {
+    unsigned head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+    if(sqeTail - head >= *sqEntries) {
+      int res = enter(0, 0);
+      if(res < 0 && res != -EINTR && res != -EAGAIN && res != -EBUSY) {
+        return nullptr;
+      }
+      head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+      if(sqeTail - head >= *sqEntries) {
+        return nullptr;
+      }
+    }
+    unsigned index = sqeTail & *sqMask;
+    struct io_uring_sqe* sqe = &sqes[index];
+    std::memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqArray[index] = index;
+    ++ sqeTail;
+    return sqe;
+  }
+
+};
+
+bool IOUringWorker::isSupported() {
+  Ring ring;
+  return ring.init(4);
+}
+
+void IOUringWorker::initRing(v_uint32 ringEntries) {
+
+  m_ring.reset(new Ring());
+
+  if(!m_ring->init(ringEntries)) {
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::initRing()]", "Error. Failed to setup io_uring. errno=%d", errno);
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Failed to setup io_uring.");
+  }
+
+  m_wakeupTrigger = ::eventfd(0, EFD_NONBLOCK);
+
+  if(m_wakeupTrigger == -1) {
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::initRing()]", "Error. Call to ::eventfd() failed. errno=%d", errno);
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Call to ::eventfd() failed.");
+  }
+
+  /*
+   * Each poll produces exactly one completion. Polls in flight are limited by the completion queue size
+   * (one entry is reserved for the wakeup poll), so the completion queue can't overflow.
+   */
+  v_uint32 slotsCount = m_ring->cqCapacity - 1;
+  m_polls.resize(slotsCount, nullptr);
+  m_freePolls.reserve(slotsCount);
+  for(v_uint32 i = slotsCount; i > 0; i --) {
+    m_freePolls.push_back(i - 1);
+  }
+
+  m_wakeupPollArmed = submitWakeupPoll();
+
+}
+
+void IOUringWorker::triggerWakeup() {
+  if(m_wakeupTrigger >= 0) {
+    eventfd_write(m_wakeupTrigger, 1);
+  }
+}
+
+bool IOUringWorker::submitWakeupPoll() {
+
+  auto sqe = m_ring->getSqe();
+  if(sqe == nullptr) {
+    return false;
+  }
+
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = m_wakeupTrigger;
+  sqe->poll_events = POLLIN;
+  sqe->user_data = WAKEUP_POLL_DATA;
+
+  return true;
+
+}
+
+bool IOUringWorker::submitCoroutinePoll(CoroutineHandle* coroutine) {
+
+  auto& action = getCoroutineScheduledAction(coroutine);
+
+  switch(action.getType()) {
+
+    case Action::TYPE_IO_WAIT: break;
+    case Action::TYPE_IO_REPEAT: break;
+
+    default:
+      OATPP_LOGE("[oatpp::async::worker::IOUringWorker::submitCoroutinePoll()]", "Error. Unknown Action. action.getType()==%d", action.getType());
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::submitCoroutinePoll()]: Error. Unknown Action.");
+
+  }
+
+  if(m_freePolls.empty()) {
+    return false;
+  }
+
+  auto sqe = m_ring->getSqe();
+  if(sqe == nullptr) {
+    return false;
+  }
+
+  v_uint32 slot = m_freePolls.back();
+  m_freePolls.pop_back();
+  m_polls[slot] = coroutine;
+
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = action.getIOHandle();
+  sqe->user_data = (__u64) slot;
+
+  switch(action.getIOEventType()) {
+
+    case Action::IOEventType::IO_EVENT_READ:
+      sqe->poll_events = POLLIN;
+      break;
+
+    case Action::IOEventType::IO_EVENT_WRITE:
+      sqe->poll_events = POLLOUT;
+      break;
+
+    default:
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::submitCoroutinePoll()]: Error. Unknown Action Event Type.");
+
+  }
+
+  return true;
+
+}
+
+void IOUringWorker::schedulePoll(CoroutineHandle* coroutine) {
+  /* keep the order - coroutine waits behind the deferred ones */
+  if(m_deferred.first != nullptr || !submitCoroutinePoll(coroutine)) {
+    m_deferred.pushBack(coroutine);
+  }
+}
+
+void IOUringWorker::consumeBacklog() {
+
+  if(!m_wakeupPollArmed) {
+    m_wakeupPollArmed = submitWakeupPoll();
+  }
+
+  /* coroutines which didn't fit into the rings before */
+  while(m_deferred.first != nullptr && submitCoroutinePoll(m_deferred.first)) {
+    m_deferred.popFront();
+  }
+
+  utils::FastQueue<CoroutineHandle> backlog;
+
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    utils::FastQueue<CoroutineHandle>::moveAll(m_backlog, backlog);
+  }
+
+  while(backlog.first != nullptr) {
+    schedulePoll(backlog.popFront());
+  }
+
+}
+
+void IOUringWorker::waitEvents() {
+
+  /*
+   * Don't block if the worker can't be woken up, or if deferred coroutines wait for free submission entries
+   * rather than for completions of the polls in flight.
+   */
+  unsigned minComplete = 1;
+  if(!m_wakeupPollArmed || (m_deferred.first != nullptr && !m_freePolls.empty())) {
+    minComplete = 0;
+  }
+
+  auto res = m_ring->enter(minComplete, IORING_ENTER_GETEVENTS);
+
+  if(res < 0 && res != -EINTR && res != -EAGAIN && res != -EBUSY) {
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::waitEvents()]", "Error. Call to io_uring_enter failed. errno=%d", -res);
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::waitEvents()]: Error. Event loop failed.");
+  }
+
+  unsigned head = *m_ring->cqHead;
+  unsigned tail = __atomic_load_n(m_ring->cqTail, __ATOMIC_ACQUIRE);
+
+  while(head != tail) {
+
+    __u64 data = m_ring->cqes[head & *m_ring->cqMask].user_data;
+    ++ head;
+
+    if(data == WAKEUP_POLL_DATA) {
+
+      eventfd_t value;
+      eventfd_read(m_wakeupTrigger, &value);
+      m_wakeupPollArmed = submitWakeupPoll();
+
+    } else if(data < m_polls.size() && m_polls[data] != nullptr) {
+
+      auto coroutine = m_polls[data];
+      m_polls[data] = nullptr;
+      m_freePolls.push_back((v_uint32) data);
+
+      Action action = coroutine->iterate();
+
+      switch(action.getType()) {
+
+        case Action::TYPE_IO_WAIT:
+          setCoroutineScheduledAction(coroutine, std::move(action));
+          schedulePoll(coroutine);
+          break;
+
+        case Action::TYPE_IO_REPEAT:
+          setCoroutineScheduledAction(coroutine, std::move(action));
+          schedulePoll(coroutine);
+          break;
+
+        default:
+          setCoroutineScheduledAction(coroutine, std::move(action));
+          getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+
+      }
+
+    }
+
+  }
+
+  __atomic_store_n(m_ring->cqHead, head, __ATOMIC_RELEASE);
+
+}
+
+IOUringWorker::IOUringWorker(v_uint32 ringEntries)
+  : Worker(Type::IO)
+  , m_running(true)
+  , m_wakeupTrigger(INVALID_IO_HANDLE)
+  , m_wakeupPollArmed(false)
+{
+  initRing(ringEntries);
+  m_thread = std::thread(&IOUringWorker::run, this);
+}
+
+IOUringWorker::~IOUringWorker() {
+
+  /* closing the ring cancels polls still in flight - coroutines waiting on them are never resumed */
+  m_ring.reset();
+
+  for(auto coroutine : m_polls) {
+    delete coroutine;
+  }
+
+  if(m_wakeupTrigger >= 0) {
+    ::close(m_wakeupTrigger);
+  }
+
+}
+
+void IOUringWorker::run() {
+  while (m_running) {
+    consumeBacklog();
+    waitEvents();
+  }
+}
+
+}}}
+
+#else
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// io_uring is not available
+
+namespace oatpp { namespace async { namespace worker {
+
+struct IOUringWorker::Ring {};
+
+bool IOUringWorker::isSupported() {
+  return false;
+}
+
+void IOUringWorker::initRing(v_uint32 ringEntries) {
+  (void) ringEntries;
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Not implemented.");
+}
+
+void IOUringWorker::triggerWakeup() {
+  // DO NOTHING
+}
+
+bool IOUringWorker::submitWakeupPoll() {
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::submitWakeupPoll()]: Error. Not implemented.");
+}
+
+bool IOUringWorker::submitCoroutinePoll(CoroutineHandle* coroutine) {
+  (void) coroutine;
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::submitCoroutinePoll()]: Error. Not implemented.");
+}
+
+void IOUringWorker::schedulePoll(CoroutineHandle* coroutine) {
+  (void) coroutine;
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::schedulePoll()]: Error. Not implemented.");
+}
+
+void IOUringWorker::consumeBacklog() {
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::consumeBacklog()]: Error. Not implemented.");
+}
+
+void IOUringWorker::waitEvents() {
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::waitEvents()]: Error. Not implemented.");
+}
+
+IOUringWorker::IOUringWorker(v_uint32 ringEntries)
+  : Worker(Type::IO)
+  , m_running(false)
+  , m_wakeupTrigger(INVALID_IO_HANDLE)
+  , m_wakeupPollArmed(false)
+{
+  initRing(ringEntries);
+}
+
+IOUringWorker::~IOUringWorker() {}
+
+void IOUringWorker::run() {
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::run()]: Error. Not implemented.");
+}
+
+}}}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// common
+
+namespace oatpp { namespace async { namespace worker {
+
+void IOUringWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
+  if (tasks.first != nullptr) {
+    {
+      std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
+      utils::FastQueue<CoroutineHandle>::moveAll(tasks, m_backlog);
+    }
+    triggerWakeup();
+  }
+}
+
+void IOUringWorker::pushOneTask(CoroutineHandle* task) {
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
+    m_backlog.pushBack(task);
+  }
+  triggerWakeup();
+}
+
+void IOUringWorker::stop() {
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    m_running = false;
+  }
+  triggerWakeup();
+}
+
+void IOUringWorker::join() {
+  if(m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void IOUringWorker::detach() {
+  if(m_thread.joinable()) {
+    m_thread.detach();
+  }
+}
+
+v_int32 IOUringWorker::setThreadAffinityToOneCpu(v_int32 cpuIndex) {
+  return oatpp::concurrency::setThreadAffinityToOneCpu(m_thread.native_handle(), cpuIndex);
+}
+
+}}}
@@ -0,0 +1,158 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_worker_IOUringWorker_hpp
+#define oatpp_async_worker_IOUringWorker_hpp
+
+#include "./Worker.hpp"
+#include "oatpp/core/concurrency/SpinLock.hpp"
+
+#include <thread>
+#include <mutex>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(OATPP_IO_URING_INTERFACE_SUPPORTED) && !defined(OATPP_IO_URING_INTERFACE_DISABLED)
+
+  #if defined(__linux__) || defined(linux) || defined(__linux)
+    #if defined(__has_include)
+      #if __has_include(<linux/io_uring.h>)
+        #define OATPP_IO_URING_INTERFACE_SUPPORTED
+      #endif
+    #endif
+  #endif
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace oatpp { namespace async { namespace worker {
+
+/**
+ * `io_uring` based implementation of I/O worker. Linux only. <br>
+ * Readiness of each I/O-waiting coroutine is requested with one-shot `IORING_OP_POLL_ADD` submission.
+ * Submissions are batched and sent to the kernel together with the wait for completions,
+ * so re-arming a coroutine doesn't cost a separate syscall. <br>
+ * Read and write waits are handled by the same worker since `io_uring` allows multiple polls on the same file-descriptor. <br>
+ * Polls in flight are limited by the size of the completion queue. Coroutines which don't fit into the rings wait
+ * inside the worker until completions free up space. Coroutines still waiting for I/O are destroyed together with the worker. <br>
+ * Use &l:IOUringWorker::isSupported (); to check if `io_uring` is available in the running kernel.
+ */
+class IOUringWorker : public Worker {
+private:
+  struct Ring; // FWD
+public:
+  /**
+   * Default number of submission queue entries.
+   */
+  static constexpr const v_uint32 DEFAULT_RING_ENTRIES = 4096;
+private:
+  std::atomic<bool> m_running;
+  utils::FastQueue<CoroutineHandle> m_backlog;
+  oatpp::concurrency::SpinLock m_backlogLock;
+private:
+  std::unique_ptr<Ring> m_ring;
+  oatpp::v_io_handle m_wakeupTrigger;
+  bool m_wakeupPollArmed;
+private:
+  /* worker-thread only */
+  std::vector<CoroutineHandle*> m_polls;
+  std::vector<v_uint32> m_freePolls;
+  utils::FastQueue<CoroutineHandle> m_deferred;
+private:
+  std::thread m_thread;
+private:
+  void initRing(v_uint32 ringEntries);
+  void triggerWakeup();
+  bool submitWakeupPoll();
+  bool submitCoroutinePoll(CoroutineHandle* coroutine);
+  void schedulePoll(CoroutineHandle* coroutine);
+  void consumeBacklog();
+  void waitEvents();
+public:
+
+  /**
+   * Check if `io_uring` is supported by the OS and by the running kernel.
+   * @return - `true` if supported.
+   */
+  static bool isSupported();
+
+public:
+
+  /**
+   * Constructor.
+   * @param ringEntries - number of submission queue entries. Kernel rounds it up to the power of two.
+   */
+  IOUringWorker(v_uint32 ringEntries = DEFAULT_RING_ENTRIES);
+
+  /**
+   * Virtual destructor.
+   */
+  ~IOUringWorker();
+
+  /**
+   * Push list of tasks to worker.
+   * @param tasks - &id:oatpp::async::utils::FastQueue; of &id:oatpp::async::CoroutineHandle;.
+   */
+  void pushTasks(utils::FastQueue<CoroutineHandle>& tasks) override;
+
+  /**
+   * Push one task to worker.
+   * @param task - &id:CoroutineHandle;.
+   */
+  void pushOneTask(CoroutineHandle* task) override;
+
+  /**
+   * Run worker.
+   */
+  void run();
+
+  /**
+   * Break run loop.
+   */
+  void stop() override;
+
+  /**
+   * Join all worker-threads.
+   */
+  void join() override;
+
+  /**
+   * Detach all worker-threads.
+   */
+  void detach() override;
+
+  /**
+   * Pin worker-thread to one CPU.
+   * @param cpuIndex - index of CPU.
+   * @return - zero on success. Negative value on failure.
+   */
+  v_int32 setThreadAffinityToOneCpu(v_int32 cpuIndex) override;
+
+};
+
+}}}
+
+#endif //oatpp_async_worker_IOUringWorker_hpp
@@ -25,6 +25,7 @@
 #include "IOWorker.hpp"
 
 #include "oatpp/core/async/Processor.hpp"
+#include "oatpp/core/concurrency/Thread.hpp"
 
 #include <chrono>
 
@@ -172,4 +173,8 @@ void IOWorker::detach() {
   m_thread.detach();
 }
 
+v_int32 IOWorker::setThreadAffinityToOneCpu(v_int32 cpuIndex) {
+  return oatpp::concurrency::setThreadAffinityToOneCpu(m_thread.native_handle(), cpuIndex);
+}
+
 }}}
\ No newline at end of file
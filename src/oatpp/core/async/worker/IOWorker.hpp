@@ -88,6 +88,13 @@ public:
   */
   void detach() override;
 
+  /**
+   * Pin worker-thread to one CPU.
+   * @param cpuIndex - index of CPU.
+   * @return - zero on success. Negative value on failure.
+   */
+  v_int32 setThreadAffinityToOneCpu(v_int32 cpuIndex) override;
+
 };
 
 }}}
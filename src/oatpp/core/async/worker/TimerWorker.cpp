@@ -25,7 +25,9 @@
 #include "TimerWorker.hpp"
 
 #include "oatpp/core/async/Processor.hpp"
+#include "oatpp/core/concurrency/Thread.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 namespace oatpp { namespace async { namespace worker {
@@ -38,6 +40,23 @@ TimerWorker::TimerWorker(const std::chrono::duration<v_int64, std::micro>& granu
   m_thread = std::thread(&TimerWorker::run, this);
 }
 
+TimerWorker::~TimerWorker() {
+  for(auto& timer : m_timers) {
+    delete timer.coroutine;
+  }
+}
+
+v_int64 TimerWorker::getMicroTickCount() {
+  std::chrono::microseconds ms = std::chrono::duration_cast<std::chrono::microseconds>
+    (std::chrono::system_clock::now().time_since_epoch());
+  return ms.count();
+}
+
+void TimerWorker::scheduleTimer(CoroutineHandle* coroutine) {
+  m_timers.push_back({getCoroutineScheduledAction(coroutine).getTimePointMicroseconds(), coroutine});
+  std::push_heap(m_timers.begin(), m_timers.end(), TimerComparator());
+}
+
 void TimerWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
   {
     std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
@@ -48,11 +67,33 @@ void TimerWorker::pushTasks(utils::FastQueue<CoroutineHandle>& tasks) {
 
 void TimerWorker::consumeBacklog() {
 
-  std::unique_lock<oatpp::concurrency::SpinLock> lock(m_backlogLock);
-  while (m_backlog.first == nullptr && m_queue.first == nullptr && m_running) {
-    m_backlogCondition.wait(lock);
+  utils::FastQueue<CoroutineHandle> backlog;
+
+  {
+
+    std::unique_lock<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+
+    while (m_backlog.first == nullptr && m_running) {
+
+      if(m_timers.empty()) {
+        m_backlogCondition.wait(lock);
+      } else {
+        v_int64 timeLeft = m_timers.front().timePointMicroseconds - getMicroTickCount();
+        if(timeLeft <= 0) {
+          break;
+        }
+        m_backlogCondition.wait_for(lock, std::chrono::microseconds(timeLeft));
+      }
+
+    }
+
+    utils::FastQueue<CoroutineHandle>::moveAll(m_backlog, backlog);
+
+  }
+
+  while(backlog.first != nullptr) {
+    scheduleTimer(backlog.popFront());
   }
-  utils::FastQueue<CoroutineHandle>::moveAll(m_backlog, m_queue);
 
 }
 
@@ -69,51 +110,46 @@ void TimerWorker::run() {
   while(m_running) {
 
     consumeBacklog();
-    auto curr = m_queue.first;
-    CoroutineHandle* prev = nullptr;
-
-    auto startTime = std::chrono::system_clock::now();
-    std::chrono::microseconds ms = std::chrono::duration_cast<std::chrono::microseconds>(startTime.time_since_epoch());
-    v_int64 tick = ms.count();
-
-    while(curr != nullptr) {
 
-      auto next = nextCoroutine(curr);
+    v_int64 tick = getMicroTickCount();
 
-      const Action& schA = getCoroutineScheduledAction(curr);
+    /*
+     * Timers re-scheduled during this pass go to the heap only after the pass.
+     * Otherwise a coroutine returning a time point in the past is popped again and again, and the backlog is never consumed.
+     */
+    utils::FastQueue<CoroutineHandle> rescheduled;
 
-      if(schA.getTimePointMicroseconds() < tick) {
+    while(!m_timers.empty() && m_timers.front().timePointMicroseconds < tick) {
 
-        Action action = curr->iterate();
+      std::pop_heap(m_timers.begin(), m_timers.end(), TimerComparator());
+      CoroutineHandle* curr = m_timers.back().coroutine;
+      m_timers.pop_back();
 
-        switch(action.getType()) {
+      Action action = curr->iterate();
 
-          case Action::TYPE_WAIT_REPEAT:
-            setCoroutineScheduledAction(curr, std::move(action));
-            break;
+      switch(action.getType()) {
 
-          case Action::TYPE_IO_WAIT:
-            setCoroutineScheduledAction(curr, oatpp::async::Action::createWaitRepeatAction(0));
-            break;
+        case Action::TYPE_WAIT_REPEAT:
+          setCoroutineScheduledAction(curr, std::move(action));
+          rescheduled.pushBack(curr);
+          break;
 
-          default:
-            m_queue.cutEntry(curr, prev);
-            setCoroutineScheduledAction(curr, std::move(action));
-            getCoroutineProcessor(curr)->pushOneTask(curr);
-            curr = prev;
-            break;
+        case Action::TYPE_IO_WAIT:
+          setCoroutineScheduledAction(curr, oatpp::async::Action::createWaitRepeatAction(tick + m_granularity.count()));
+          rescheduled.pushBack(curr);
+          break;
 
-        }
+        default:
+          setCoroutineScheduledAction(curr, std::move(action));
+          getCoroutineProcessor(curr)->pushOneTask(curr);
+          break;
 
       }
 
-      prev = curr;
-      curr = next;
     }
 
-    auto elapsed = std::chrono::system_clock::now() - startTime;
-    if(elapsed < m_granularity) {
-      std::this_thread::sleep_for(m_granularity - elapsed);
+    while(rescheduled.first != nullptr) {
+      scheduleTimer(rescheduled.popFront());
     }
 
   }
@@ -136,4 +172,8 @@ void TimerWorker::detach() {
   m_thread.detach();
 }
 
+v_int32 TimerWorker::setThreadAffinityToOneCpu(v_int32 cpuIndex) {
+  return oatpp::concurrency::setThreadAffinityToOneCpu(m_thread.native_handle(), cpuIndex);
+}
+
 }}}
\ No newline at end of file
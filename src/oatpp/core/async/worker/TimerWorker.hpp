@@ -31,18 +31,34 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <vector>
 
 namespace oatpp { namespace async { namespace worker {
 
 /**
  * Timer worker.
- * Used to wait for timer-scheduled coroutines.
+ * Used to wait for timer-scheduled coroutines. <br>
+ * Timers are kept in a min-heap ordered by their time points.
+ * Worker sleeps until the nearest time point or until new timers are pushed.
  */
 class TimerWorker : public Worker {
+private:
+
+  struct Timer {
+    v_int64 timePointMicroseconds;
+    CoroutineHandle* coroutine;
+  };
+
+  struct TimerComparator {
+    bool operator()(const Timer& a, const Timer& b) const {
+      return a.timePointMicroseconds > b.timePointMicroseconds;
+    }
+  };
+
 private:
   std::atomic<bool> m_running;
   utils::FastQueue<CoroutineHandle> m_backlog;
-  utils::FastQueue<CoroutineHandle> m_queue;
+  std::vector<Timer> m_timers;
   oatpp::concurrency::SpinLock m_backlogLock;
   std::condition_variable_any m_backlogCondition;
 private:
@@ -50,15 +66,22 @@ private:
 private:
   std::thread m_thread;
 private:
+  static v_int64 getMicroTickCount();
+  void scheduleTimer(CoroutineHandle* coroutine);
   void consumeBacklog();
 public:
 
   /**
    * Constructor.
-   * @param granularity - minimum possible time to wait.
+   * @param granularity - interval to re-check timer-scheduled coroutines which returned I/O action.
    */
   TimerWorker(const std::chrono::duration<v_int64, std::micro>& granularity = std::chrono::milliseconds(100));
 
+  /**
+   * Virtual destructor.
+   */
+  ~TimerWorker();
+
   /**
    * Push list of tasks to worker.
    * @param tasks - &id:oatpp::aysnc::utils::FastQueue; of &id:oatpp::async::CoroutineHandle;.
@@ -91,6 +114,13 @@ public:
    */
   void detach() override;
 
+  /**
+   * Pin worker-thread to one CPU.
+   * @param cpuIndex - index of CPU.
+   * @return - zero on success. Negative value on failure.
+   */
+  v_int32 setThreadAffinityToOneCpu(v_int32 cpuIndex) override;
+
 };
 
 }}}
@@ -50,6 +50,11 @@ CoroutineHandle* Worker::nextCoroutine(CoroutineHandle* coroutine) {
   return coroutine->_ref;
 }
 
+v_int32 Worker::setThreadAffinityToOneCpu(v_int32 cpuIndex) {
+  (void) cpuIndex;
+  return -1;
+}
+
 Worker::Type Worker::getType() {
   return m_type;
 }
@@ -112,6 +112,14 @@ public:
    */
   virtual void detach() = 0;
 
+  /**
+   * Pin all worker-threads to one CPU. <br>
+   * Default implementation does nothing and returns `-1`.
+   * @param cpuIndex - index of CPU.
+   * @return - zero on success. Negative value on failure.
+   */
+  virtual v_int32 setThreadAffinityToOneCpu(v_int32 cpuIndex);
+
   /**
    * Get worker type.
    * @return - one of &l:Worker::Type; values.
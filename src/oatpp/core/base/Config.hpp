@@ -39,7 +39,7 @@
 
 /**
  * Define this to disable memory-pool allocations.
- * This will make oatpp::base::memory::MemoryPool, method obtain and free call new and delete directly
+ * This will make oatpp::async::utils::FramePool, method allocate and deallocate call new and delete directly
  */
 //#define OATPP_DISABLE_POOL_ALLOCATIONS
 
@@ -62,8 +62,12 @@
  */
 //#define OATPP_COMPAT_BUILD_NO_THREAD_LOCAL 1
 
+/**
+ * `printf` format used to convert floating point numbers to strings. <br>
+ * Default is `nullptr` - the shortest representation which reads back to the same value.
+ */
 #ifndef OATPP_FLOAT_STRING_FORMAT
-  #define OATPP_FLOAT_STRING_FORMAT "%.16g"
+  #define OATPP_FLOAT_STRING_FORMAT nullptr
 #endif
 
 /**
@@ -0,0 +1,163 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "BufferPool.hpp"
+
+namespace oatpp { namespace data{ namespace buffer {
+
+BufferPool::BufferPool(v_buff_size maxBuffersPerClass)
+  : m_maxBuffersPerClass(maxBuffersPerClass)
+{
+  /* release*() never grows the vectors - no allocations while the SpinLock is held */
+  for(v_int32 i = 0; i < CLASSES_COUNT; i ++) {
+    m_classes[i].memory.reserve(m_maxBuffersPerClass);
+    m_classes[i].streams.reserve(m_maxBuffersPerClass);
+  }
+}
+
+std::shared_ptr<BufferPool> BufferPool::createShared(v_buff_size maxBuffersPerClass) {
+  return std::make_shared<BufferPool>(maxBuffersPerClass);
+}
+
+v_int32 BufferPool::getClassIndex(v_buff_size size) {
+  if(size > MAX_CLASS_SIZE) {
+    return -1;
+  }
+  v_int32 index = 0;
+  v_buff_size classSize = MIN_CLASS_SIZE;
+  while(classSize < size) {
+    classSize <<= 1;
+    index ++;
+  }
+  return index;
+}
+
+std::shared_ptr<std::string> BufferPool::acquireMemory(v_buff_size size) {
+
+  v_int32 index = getClassIndex(size);
+  if(index < 0) {
+    return std::make_shared<std::string>(size, 0);
+  }
+
+  SizeClass& sizeClass = m_classes[index];
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(sizeClass.lock);
+    if(!sizeClass.memory.empty()) {
+      auto memory = std::move(sizeClass.memory.back());
+      sizeClass.memory.pop_back();
+      return memory;
+    }
+  }
+
+  return std::make_shared<std::string>(MIN_CLASS_SIZE << index, 0);
+
+}
+
+void BufferPool::releaseMemory(std::shared_ptr<std::string>& memory) {
+
+  if(!memory || memory.use_count() > 1) {
+    memory.reset();
+    return;
+  }
+
+  v_buff_size size = memory->size();
+  v_int32 index = getClassIndex(size);
+
+  /* only exact class sizes are pooled */
+  if(index < 0 || (MIN_CLASS_SIZE << index) != size) {
+    memory.reset();
+    return;
+  }
+
+  SizeClass& sizeClass = m_classes[index];
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(sizeClass.lock);
+  if((v_buff_size) sizeClass.memory.size() < m_maxBuffersPerClass) {
+    sizeClass.memory.push_back(std::move(memory));
+  }
+  memory.reset();
+
+}
+
+std::shared_ptr<stream::BufferOutputStream> BufferPool::acquireStream(v_buff_size initialCapacity) {
+
+  v_int32 index = getClassIndex(initialCapacity);
+  if(index < 0) {
+    return std::make_shared<stream::BufferOutputStream>(initialCapacity);
+  }
+
+  SizeClass& sizeClass = m_classes[index];
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(sizeClass.lock);
+    if(!sizeClass.streams.empty()) {
+      auto stream = std::move(sizeClass.streams.back());
+      sizeClass.streams.pop_back();
+      return stream;
+    }
+  }
+
+  return std::make_shared<stream::BufferOutputStream>(MIN_CLASS_SIZE << index);
+
+}
+
+void BufferPool::releaseStream(std::shared_ptr<stream::BufferOutputStream>& stream) {
+
+  if(!stream || stream.use_count() > 1) {
+    stream.reset();
+    return;
+  }
+
+  v_buff_size capacity = stream->getCapacity();
+  if(capacity < MIN_CLASS_SIZE || capacity > MAX_CLASS_SIZE) {
+    stream.reset();
+    return;
+  }
+
+  /* largest class which capacity of the stream satisfies */
+  v_int32 index = getClassIndex(capacity);
+  if((MIN_CLASS_SIZE << index) > capacity) {
+    index --;
+  }
+
+  stream->setCurrentPosition(0);
+
+  SizeClass& sizeClass = m_classes[index];
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(sizeClass.lock);
+  if((v_buff_size) sizeClass.streams.size() < m_maxBuffersPerClass) {
+    sizeClass.streams.push_back(std::move(stream));
+  }
+  stream.reset();
+
+}
+
+v_buff_size BufferPool::getPooledCount() {
+  v_buff_size result = 0;
+  for(v_int32 i = 0; i < CLASSES_COUNT; i ++) {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_classes[i].lock);
+    result += m_classes[i].memory.size() + m_classes[i].streams.size();
+  }
+  return result;
+}
+
+}}}
@@ -0,0 +1,129 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_data_buffer_BufferPool_hpp
+#define oatpp_data_buffer_BufferPool_hpp
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/concurrency/SpinLock.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace data{ namespace buffer {
+
+/**
+ * Shared, size-classed pool of buffers. <br>
+ * Buffers are grouped by size classes - powers of two from &l:BufferPool::MIN_CLASS_SIZE; to &l:BufferPool::MAX_CLASS_SIZE;.
+ * Buffers of other sizes are not pooled. <br>
+ * Used by &id:oatpp::web::server::HttpProcessor::Coroutine; to give buffers of idle keep-alive connections back
+ * while the connection waits for the next request. <br>
+ * Thread-safe.
+ */
+class BufferPool : public oatpp::base::Countable {
+public:
+
+  /**
+   * Size of the smallest size class.
+   */
+  static constexpr v_buff_size MIN_CLASS_SIZE = 256;
+
+  /**
+   * Size of the largest size class.
+   */
+  static constexpr v_buff_size MAX_CLASS_SIZE = 65536;
+
+  /**
+   * Number of size classes.
+   */
+  static constexpr v_int32 CLASSES_COUNT = 9;
+
+private:
+
+  struct SizeClass {
+    oatpp::concurrency::SpinLock lock;
+    std::vector<std::shared_ptr<std::string>> memory;
+    std::vector<std::shared_ptr<stream::BufferOutputStream>> streams;
+  };
+
+private:
+  static v_int32 getClassIndex(v_buff_size size);
+private:
+  SizeClass m_classes[CLASSES_COUNT];
+  v_buff_size m_maxBuffersPerClass;
+public:
+
+  /**
+   * Constructor.
+   * @param maxBuffersPerClass - max number of buffers of each kind kept in each size class.
+   * Buffers released above this limit are freed. Space for the pooled pointers is reserved upfront.
+   */
+  BufferPool(v_buff_size maxBuffersPerClass = 1024);
+
+  /**
+   * Create shared BufferPool.
+   * @param maxBuffersPerClass - max number of buffers of each kind kept in each size class.
+   * @return - `std::shared_ptr` to BufferPool.
+   */
+  static std::shared_ptr<BufferPool> createShared(v_buff_size maxBuffersPerClass = 1024);
+
+  /**
+   * Get memory buffer of at least `size` bytes. Content of the buffer is undefined.
+   * @param size - min size of the buffer.
+   * @return - `std::shared_ptr` to `std::string`.
+   */
+  std::shared_ptr<std::string> acquireMemory(v_buff_size size);
+
+  /**
+   * Give memory buffer back to the pool. <br>
+   * The buffer is pooled only if the caller holds the last reference to it.
+   * @param memory - buffer obtained with &l:BufferPool::acquireMemory ();. Reset by this call.
+   */
+  void releaseMemory(std::shared_ptr<std::string>& memory);
+
+  /**
+   * Get empty &id:oatpp::data::stream::BufferOutputStream; with capacity of at least `initialCapacity` bytes.
+   * @param initialCapacity - min capacity of the stream.
+   * @return - `std::shared_ptr` to &id:oatpp::data::stream::BufferOutputStream;.
+   */
+  std::shared_ptr<stream::BufferOutputStream> acquireStream(v_buff_size initialCapacity);
+
+  /**
+   * Give &id:oatpp::data::stream::BufferOutputStream; back to the pool. <br>
+   * The stream is pooled only if the caller holds the last reference to it.
+   * @param stream - stream obtained with &l:BufferPool::acquireStream ();. Reset by this call.
+   */
+  void releaseStream(std::shared_ptr<stream::BufferOutputStream>& stream);
+
+  /**
+   * Get total number of buffers currently kept in the pool.
+   * @return
+   */
+  v_buff_size getPooledCount();
+
+};
+
+}}}
+
+#endif /* oatpp_data_buffer_BufferPool_hpp */
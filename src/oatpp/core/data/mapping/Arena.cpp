@@ -0,0 +1,183 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "Arena.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+
+namespace oatpp { namespace data { namespace mapping {
+
+namespace {
+
+/*
+ * Chunk header is padded so that chunk data is aligned same as memory returned by malloc.
+ */
+constexpr v_buff_size CHUNK_HEADER_SIZE =
+  ((sizeof(void*) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) * alignof(std::max_align_t);
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+
+/*
+ * Kept out of the class (and out of the header) - thread_local data can't be shared across DLL boundaries.
+ */
+thread_local Arena::Scope* CURRENT_SCOPE = nullptr;
+
+/*
+ * Number of scopes active in the process. Lets allocations skip the thread-local lookup when arenas are not used at all.
+ */
+std::atomic<v_int64> ACTIVE_SCOPES(0);
+
+#endif
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Arena::Scope
+
+Arena::Scope::Scope(const std::shared_ptr<Arena>& arena)
+  : m_arena(arena)
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  , m_previous(CURRENT_SCOPE)
+{
+  CURRENT_SCOPE = this;
+  ACTIVE_SCOPES.fetch_add(1, std::memory_order_relaxed);
+}
+#else
+  , m_previous(nullptr)
+{}
+#endif
+
+Arena::Scope::~Scope() {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  CURRENT_SCOPE = m_previous;
+  ACTIVE_SCOPES.fetch_sub(1, std::memory_order_relaxed);
+#endif
+}
+
+const std::shared_ptr<Arena>& Arena::Scope::getArena() const {
+  return m_arena;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Arena
+
+Arena::Arena(v_buff_size chunkSize)
+  : m_chunkSize(chunkSize)
+  , m_chunks(nullptr)
+  , m_position(nullptr)
+  , m_end(nullptr)
+  , m_allocatedBytes(0)
+  , m_chunksCount(0)
+{
+  if(m_chunkSize <= 0) {
+    throw std::runtime_error("[oatpp::data::mapping::Arena::Arena()]: Error. Invalid chunk size.");
+  }
+}
+
+Arena::~Arena() {
+  Chunk* chunk = m_chunks;
+  while(chunk != nullptr) {
+    Chunk* next = chunk->next;
+    std::free(chunk);
+    chunk = next;
+  }
+}
+
+std::shared_ptr<Arena> Arena::createShared(v_buff_size chunkSize) {
+  return std::make_shared<Arena>(chunkSize);
+}
+
+const std::shared_ptr<Arena>* Arena::getCurrent() {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  // a scope is only ever active on the thread which created it - relaxed load never misses own scope
+  if(ACTIVE_SCOPES.load(std::memory_order_relaxed) > 0) {
+    Scope* scope = CURRENT_SCOPE;
+    if(scope != nullptr && scope->m_arena) {
+      return &scope->m_arena;
+    }
+  }
+#endif
+  return nullptr;
+}
+
+p_char8 Arena::allocateChunk(v_buff_size size) {
+
+  Chunk* chunk = static_cast<Chunk*>(std::malloc(CHUNK_HEADER_SIZE + size));
+  if(chunk == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  chunk->next = m_chunks;
+  m_chunks = chunk;
+  m_chunksCount ++;
+
+  return reinterpret_cast<p_char8>(chunk) + CHUNK_HEADER_SIZE;
+
+}
+
+void* Arena::allocate(v_buff_size size, v_buff_size alignment) {
+
+  if(size <= 0) {
+    size = 1;
+  }
+
+  if(m_position != nullptr) {
+    v_buff_size misalignment = reinterpret_cast<std::uintptr_t>(m_position) & (alignment - 1);
+    p_char8 result = misalignment == 0 ? m_position : m_position + (alignment - misalignment);
+    if(result <= m_end && m_end - result >= size) {
+      m_position = result + size;
+      m_allocatedBytes += size;
+      return result;
+    }
+  }
+
+  m_allocatedBytes += size;
+
+  if(size > m_chunkSize) {
+    // dedicated chunk for a big allocation - keep bumping in the current chunk
+    return allocateChunk(size);
+  }
+
+  p_char8 result = allocateChunk(m_chunkSize);
+  m_position = result + size;
+  m_end = result + m_chunkSize;
+  return result;
+
+}
+
+v_buff_size Arena::getAllocatedBytes() const {
+  return m_allocatedBytes;
+}
+
+v_int64 Arena::getChunksCount() const {
+  return m_chunksCount;
+}
+
+}}}
@@ -0,0 +1,235 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_data_mapping_Arena_hpp
+#define oatpp_data_mapping_Arena_hpp
+
+#include "oatpp/core/base/Environment.hpp"
+
+#include <memory>
+
+namespace oatpp { namespace data { namespace mapping {
+
+/**
+ * Chunked bump allocator for request-scoped object graphs. <br>
+ * Memory is never returned to the arena piece by piece - all chunks are freed at once when the arena is destroyed. <br>
+ * Objects are placed in the arena with &l:Arena::allocateShared (); while an &l:Arena::Scope; is active on the current thread.
+ * Every such object keeps the arena alive, so the arena is released together with the last object allocated from it. <br>
+ * *Note:* this means that keeping ANY object allocated from the arena alive (ex.: a single field copied out of a DTO graph)
+ * keeps memory of the WHOLE arena allocated. Copy long-living values out to the heap (outside of an arena scope). <br>
+ * *Note:* Arena is NOT thread-safe - only one thread may allocate from it at a time.
+ * Objects allocated from the arena may be used and destroyed from any thread.
+ */
+class Arena {
+public:
+
+  /**
+   * Default chunk size.
+   */
+  static constexpr v_buff_size DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+public:
+
+  /**
+   * Make arena current for the calling thread for the lifetime of the scope object. <br>
+   * Scopes may be nested - previously active arena is restored on scope exit.
+   * Scope with `nullptr` arena disables arena allocation for the lifetime of the scope.
+   */
+  class Scope {
+    friend Arena;
+  private:
+    std::shared_ptr<Arena> m_arena;
+    Scope* m_previous;
+  public:
+
+    /**
+     * Constructor.
+     * @param arena - arena to make current. May be `nullptr`.
+     */
+    Scope(const std::shared_ptr<Arena>& arena);
+
+    /**
+     * Non-virtual destructor. Restores previously active arena.
+     */
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    /**
+     * Get arena of this scope.
+     * @return
+     */
+    const std::shared_ptr<Arena>& getArena() const;
+
+  };
+
+private:
+
+  struct Chunk {
+    Chunk* next;
+  };
+
+private:
+  v_buff_size m_chunkSize;
+  Chunk* m_chunks;
+  p_char8 m_position;
+  p_char8 m_end;
+  v_buff_size m_allocatedBytes;
+  v_int64 m_chunksCount;
+private:
+  p_char8 allocateChunk(v_buff_size size);
+public:
+
+  /**
+   * Constructor.
+   * @param chunkSize - size of a single memory chunk. Bigger allocations get dedicated chunks.
+   */
+  Arena(v_buff_size chunkSize = DEFAULT_CHUNK_SIZE);
+
+  /**
+   * Non-virtual destructor. Frees all chunks.
+   */
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  /**
+   * Create shared Arena.
+   * @param chunkSize - size of a single memory chunk. Bigger allocations get dedicated chunks.
+   * @return - `std::shared_ptr` to Arena.
+   */
+  static std::shared_ptr<Arena> createShared(v_buff_size chunkSize = DEFAULT_CHUNK_SIZE);
+
+  /**
+   * Get arena currently active on the calling thread. <br>
+   * Thread-local lookup is skipped while there are no active scopes in the process,
+   * so allocations outside of arena scopes only pay for one relaxed atomic load.
+   * @return - pointer to `std::shared_ptr` of the current arena or `nullptr` if there is no active arena.
+   */
+  static const std::shared_ptr<Arena>* getCurrent();
+
+  /**
+   * Allocate memory block.
+   * @param size - size in bytes.
+   * @param alignment - required alignment. Must be a power of two not greater than `alignof(std::max_align_t)`.
+   * @return - pointer to allocated memory.
+   */
+  void* allocate(v_buff_size size, v_buff_size alignment);
+
+  /**
+   * Get total number of bytes handed out by the arena.
+   * @return
+   */
+  v_buff_size getAllocatedBytes() const;
+
+  /**
+   * Get number of memory chunks owned by the arena.
+   * @return
+   */
+  v_int64 getChunksCount() const;
+
+  /**
+   * Create object in the current arena (see &l:Arena::getCurrent ();) or on the heap if there is no current arena.
+   * @tparam T - object type.
+   * @tparam Args - constructor arguments.
+   * @param args - constructor arguments.
+   * @return - `std::shared_ptr` to the created object.
+   */
+  template<class T, class ... Args>
+  static std::shared_ptr<T> allocateShared(Args&&... args);
+
+};
+
+/**
+ * Standard allocator placing objects to &l:Arena;. <br>
+ * Holds a strong reference to the arena - control blocks created with `std::allocate_shared` keep their arena alive.
+ * `deallocate` is a no-op - memory is reclaimed when the arena is destroyed.
+ * @tparam T - value type.
+ */
+template<class T>
+class ArenaAllocator {
+  template<class U>
+  friend class ArenaAllocator;
+private:
+  std::shared_ptr<Arena> m_arena;
+public:
+
+  typedef T value_type;
+
+  template<class U>
+  struct rebind {
+    typedef ArenaAllocator<U> other;
+  };
+
+public:
+
+  /**
+   * Constructor.
+   * @param arena - arena to allocate from.
+   */
+  ArenaAllocator(const std::shared_ptr<Arena>& arena)
+    : m_arena(arena)
+  {}
+
+  template<class U>
+  ArenaAllocator(const ArenaAllocator<U>& other)
+    : m_arena(other.m_arena)
+  {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) {
+    (void) ptr;
+    (void) n;
+  }
+
+  template<class U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return m_arena == other.m_arena;
+  }
+
+  template<class U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return m_arena != other.m_arena;
+  }
+
+};
+
+template<class T, class ... Args>
+std::shared_ptr<T> Arena::allocateShared(Args&&... args) {
+  auto arena = getCurrent();
+  if(arena != nullptr) {
+    return std::allocate_shared<T>(ArenaAllocator<T>(*arena), std::forward<Args>(args)...);
+  }
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+}}}
+
+#endif /* oatpp_data_mapping_Arena_hpp */
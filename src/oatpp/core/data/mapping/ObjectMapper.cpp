@@ -26,8 +26,115 @@
 
 #include "oatpp/core/data/stream/BufferStream.hpp"
 
+#include <cstring>
+
 namespace oatpp { namespace data { namespace mapping {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ObjectMapper::Reader
+
+ObjectMapper::Reader::Reader()
+  : m_errorCode(0)
+  , m_errorPosition(0)
+{}
+
+void ObjectMapper::Reader::setError(const oatpp::String& message, v_int64 code, v_buff_size position) {
+  m_errorMessage = message;
+  m_errorCode = code;
+  m_errorPosition = position;
+}
+
+bool ObjectMapper::Reader::hasError() const {
+  return m_errorMessage != nullptr;
+}
+
+const oatpp::String& ObjectMapper::Reader::getErrorMessage() const {
+  return m_errorMessage;
+}
+
+v_int64 ObjectMapper::Reader::getErrorCode() const {
+  return m_errorCode;
+}
+
+v_buff_size ObjectMapper::Reader::getErrorPosition() const {
+  return m_errorPosition;
+}
+
+void ObjectMapper::Reader::setArena(const std::shared_ptr<Arena>& arena) {
+  m_arena = arena;
+}
+
+const std::shared_ptr<Arena>& ObjectMapper::Reader::getArena() const {
+  return m_arena;
+}
+
+namespace {
+
+/*
+ * Default Reader - accumulate all data then deserialize it at once.
+ */
+class BufferingReader : public ObjectMapper::Reader {
+private:
+  const ObjectMapper* m_objectMapper;
+  const type::Type* m_type;
+  stream::BufferOutputStream m_buffer;
+public:
+
+  BufferingReader(const ObjectMapper* objectMapper, const type::Type* type)
+    : m_objectMapper(objectMapper)
+    , m_type(type)
+  {}
+
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+    return m_buffer.write(data, count, action);
+  }
+
+  type::Void finish() override {
+    auto text = m_buffer.toString();
+    oatpp::parser::Caret caret(text);
+    Arena::Scope arenaScope(m_arena);
+    auto result = m_objectMapper->read(caret, m_type);
+    if(caret.hasError()) {
+      setError(caret.getErrorMessage(), caret.getErrorCode(), caret.getPosition());
+      return nullptr;
+    }
+    return result;
+  }
+
+};
+
+/*
+ * Default Writer - serialize the whole object at once then give it away chunk by chunk.
+ */
+class BufferingWriter : public ObjectMapper::Writer {
+private:
+  oatpp::String m_data;
+  v_buff_size m_position;
+public:
+
+  BufferingWriter(const ObjectMapper* objectMapper, const type::Void& variant)
+    : m_data(objectMapper->writeToString(variant))
+    , m_position(0)
+  {}
+
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override {
+    (void) action;
+    v_buff_size size = m_data->size() - m_position;
+    if(size > count) {
+      size = count;
+    }
+    std::memcpy(buffer, m_data->data() + m_position, size);
+    m_position += size;
+    return size;
+  }
+
+};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ObjectMapper
+
 ObjectMapper::ObjectMapper(const Info& info)
   : m_info(info)
 {}
@@ -42,4 +149,12 @@ oatpp::String ObjectMapper::writeToString(const type::Void& variant) const {
   return stream.toString();
 }
 
-}}}
\ No newline at end of file
+std::shared_ptr<ObjectMapper::Reader> ObjectMapper::createReader(const mapping::type::Type* const type) const {
+  return std::make_shared<BufferingReader>(this, type);
+}
+
+std::shared_ptr<ObjectMapper::Writer> ObjectMapper::createWriter(const type::Void& variant) const {
+  return std::make_shared<BufferingWriter>(this, variant);
+}
+
+}}}
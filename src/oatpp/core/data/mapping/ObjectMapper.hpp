@@ -25,6 +25,7 @@
 #ifndef oatpp_data_mapping_ObjectMapper_hpp
 #define oatpp_data_mapping_ObjectMapper_hpp
 
+#include "Arena.hpp"
 #include "type/Object.hpp"
 #include "type/Type.hpp"
 
@@ -61,6 +62,89 @@ public:
     const char* const http_content_type;
 
   };
+
+  /**
+   * Incremental deserializer. <br>
+   * Consumes serialized data chunk by chunk as it arrives (it is a &id:oatpp::data::stream::WriteCallback;)
+   * and builds the object when &l:ObjectMapper::Reader::finish (); is called. <br>
+   * Reader never fails the write operation - on parsing error the rest of the data is drained and ignored,
+   * error is reported by &l:ObjectMapper::Reader::finish ();.
+   */
+  class Reader : public data::stream::WriteCallback {
+  protected:
+    oatpp::String m_errorMessage;
+    v_int64 m_errorCode;
+    v_buff_size m_errorPosition;
+    std::shared_ptr<Arena> m_arena;
+  protected:
+    void setError(const oatpp::String& message, v_int64 code, v_buff_size position);
+  public:
+
+    /**
+     * Constructor.
+     */
+    Reader();
+
+    /**
+     * Signal end of data and get the deserialized object.
+     * @return - deserialized object wrapped in &id:oatpp::Void;. `nullptr` in case of error - check &l:ObjectMapper::Reader::hasError ();.
+     */
+    virtual mapping::type::Void finish() = 0;
+
+    /**
+     * Check if parsing error occurred.
+     * @return
+     */
+    bool hasError() const;
+
+    /**
+     * Get error message.
+     * @return
+     */
+    const oatpp::String& getErrorMessage() const;
+
+    /**
+     * Get error code.
+     * @return
+     */
+    v_int64 getErrorCode() const;
+
+    /**
+     * Get position of the error in the consumed data.
+     * @return
+     */
+    v_buff_size getErrorPosition() const;
+
+    /**
+     * Set &id:oatpp::data::mapping::Arena; to allocate deserialized objects from. <br>
+     * Implementations make the arena current (see &id:oatpp::data::mapping::Arena::Scope;) while consuming data and in &l:ObjectMapper::Reader::finish ();.
+     * @param arena - arena or `nullptr` to allocate objects on the heap.
+     */
+    void setArena(const std::shared_ptr<Arena>& arena);
+
+    /**
+     * Get arena set by &l:ObjectMapper::Reader::setArena ();.
+     * @return - arena or `nullptr`.
+     */
+    const std::shared_ptr<Arena>& getArena() const;
+
+  };
+
+  /**
+   * Incremental serializer. <br>
+   * Produces serialized data chunk by chunk on each read (it is a &id:oatpp::data::stream::ReadCallback;).
+   * `0` is returned once the whole object is serialized.
+   */
+  class Writer : public data::stream::ReadCallback {
+  public:
+
+    /**
+     * Virtual destructor.
+     */
+    virtual ~Writer() = default;
+
+  };
+
 private:
   Info m_info;
 public:
@@ -92,6 +176,26 @@ public:
    */
   virtual mapping::type::Void read(oatpp::parser::Caret& caret, const mapping::type::Type* const type) const = 0;
 
+  /**
+   * Create incremental deserializer for the type. <br>
+   * Default implementation accumulates all data and calls &l:ObjectMapper::read (); on finish.
+   * Override it if the format can be deserialized as data arrives. <br>
+   * *Note:* ObjectMapper must outlive the reader.
+   * @param type - pointer to object type. See &id:oatpp::data::mapping::type::Type;.
+   * @return - `std::shared_ptr` to &l:ObjectMapper::Reader;.
+   */
+  virtual std::shared_ptr<Reader> createReader(const mapping::type::Type* const type) const;
+
+  /**
+   * Create incremental serializer for the object. <br>
+   * Default implementation serializes the whole object with &l:ObjectMapper::write (); right away.
+   * Override it if the format can be serialized chunk by chunk. <br>
+   * *Note:* ObjectMapper must outlive the writer.
+   * @param variant - object to serialize.
+   * @return - `std::shared_ptr` to &l:ObjectMapper::Writer;.
+   */
+  virtual std::shared_ptr<Writer> createWriter(const mapping::type::Void& variant) const;
+
   /**
    * Serialize object to String.
    * @param variant - Object to serialize.
@@ -131,6 +235,26 @@ public:
     }
     return result;
   }
+
+  /**
+   * Deserialize object reading the stream chunk by chunk until the end of stream.
+   * @tparam Wrapper - ObjectWrapper type.
+   * @param stream - &id:oatpp::data::stream::ReadCallback; to read serialized data from.
+   * @return - deserialized Object.
+   * @throws - &id:oatpp::parser::ParsingError;
+   * @throws - depends on implementation.
+   */
+  template<class Wrapper>
+  Wrapper readFromStream(data::stream::ReadCallback* stream) const {
+    auto reader = createReader(Wrapper::Class::getType());
+    v_char8 buffer[4096];
+    data::stream::transfer(stream, reader.get(), 0, buffer, 4096);
+    auto result = reader->finish().template cast<Wrapper>();
+    if(reader->hasError()) {
+      throw oatpp::parser::ParsingError(reader->getErrorMessage(), reader->getErrorCode(), reader->getErrorPosition());
+    }
+    return result;
+  }
   
 };
   
@@ -208,7 +208,7 @@ type::Void TypeResolver::findPropertyValue(const type::Void& baseObject,
         auto it = map.find(path[pathPosition]);
         if(it != map.end()) {
           auto property = it->second;
-          return findPropertyValue(property->getAsRef(static_cast<type::BaseObject*>(baseObject.get())), path, pathPosition + 1, cache);
+          return findPropertyValue(property->get(static_cast<type::BaseObject*>(baseObject.get())), path, pathPosition + 1, cache);
         }
       }
       return nullptr;
@@ -26,6 +26,9 @@
 #define oatpp_data_mapping_type_Collection_hpp
 
 #include "./Type.hpp"
+
+#include "oatpp/core/data/mapping/Arena.hpp"
+
 #include <unordered_set>
 
 namespace oatpp { namespace data { namespace mapping { namespace type {
@@ -125,6 +128,15 @@ public:
 
   };
 
+  template<class ItemType>
+  struct ItemView {
+
+    static type::Void get(const ItemType& i) {
+      return i;
+    }
+
+  };
+
 };
 
 template<class ContainerType, class ItemType, class Clazz>
@@ -137,7 +149,7 @@ public:
     typename ContainerType::iterator end;
 
     type::Void get() override {
-      return *iterator;
+      return Collection::ItemView<ItemType>::get(*iterator);
     }
 
     void next() override {
@@ -156,7 +168,7 @@ public:
   public:
 
     type::Void createObject() const override {
-      return type::Void(std::make_shared<ContainerType>(), Clazz::getType());
+      return type::Void(Arena::allocateShared<ContainerType>(), Clazz::getType());
     }
 
     const type::Type* getItemType() const override {
@@ -27,6 +27,8 @@
 
 #include "./Any.hpp"
 #include "./Primitive.hpp"
+
+#include "oatpp/core/data/mapping/Arena.hpp"
 #include "oatpp/core/data/share/MemoryLabel.hpp"
 
 #include <type_traits>
@@ -317,11 +319,11 @@ public:
    * @param value
    */
   EnumObjectWrapper(T value)
-    : type::ObjectWrapper<T, EnumObjectClass>(std::make_shared<T>(value))
+    : type::ObjectWrapper<T, EnumObjectClass>(Arena::allocateShared<T>(value))
   {}
 
   EnumObjectWrapper& operator = (T value) {
-    this->m_ptr = std::make_shared<T>(value);
+    this->m_ptr = Arena::allocateShared<T>(value);
     return *this;
   }
 
@@ -584,7 +586,7 @@ namespace __class {
       {}
 
       type::Void createObject() const override {
-        return type::Void(std::make_shared<T>(), getType());
+        return type::Void(Arena::allocateShared<T>(), getType());
       }
 
       type::Void toInterpretation(const type::Void& enumValue, EnumInterpreterError& error) const override {
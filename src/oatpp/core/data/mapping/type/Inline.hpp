@@ -0,0 +1,263 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_data_mapping_type_Inline_hpp
+#define oatpp_data_mapping_type_Inline_hpp
+
+#include "./Object.hpp"
+
+namespace oatpp { namespace data { namespace mapping { namespace type {
+
+/**
+ * Primitive value stored inline - without heap allocation. <br>
+ * Opt-in replacement of primitive ObjectWrapper for DTO fields and collection items.
+ * Ex.: `DTO_FIELD(Inline<Int32>, id);`, `Vector<Inline<Float64>>`. <br>
+ * Has the same &id:oatpp::Type; as the `Wrapper`, thus it is mapped the same way as the `Wrapper`.
+ * Can hold nullptr value.
+ * @tparam Wrapper - primitive ObjectWrapper ex.: &id:oatpp::Int32;, &id:oatpp::Float64;, &id:oatpp::Boolean;.
+ */
+template<class Wrapper>
+class Inline {
+public:
+  typedef typename Wrapper::UnderlyingType UnderlyingType;
+  typedef typename Wrapper::ObjectType ObjectType;
+  typedef typename Wrapper::Class Class;
+public:
+
+  /**
+   * Accessor for inline DTO fields.
+   */
+  class Accessor : public BaseObject::Property::InlineAccessor {
+  public:
+
+    void set(void* field, const Void& value) const override {
+      auto inlineField = static_cast<Inline*>(field);
+      if(!value) {
+        *inlineField = nullptr;
+        return;
+      }
+      if(value.getValueType() != Class::getType()) {
+        throw std::runtime_error("[oatpp::data::mapping::type::Inline::Accessor::set()]: Error. Type mismatch.");
+      }
+      *inlineField = *static_cast<const ObjectType*>(value.get());
+    }
+
+    Void get(const void* field) const override {
+      return static_cast<const Inline*>(field)->box();
+    }
+
+    Void getView(void* field) const override {
+      return static_cast<Inline*>(field)->view();
+    }
+
+  };
+
+private:
+  UnderlyingType m_value;
+  bool m_hasValue;
+public:
+
+  Inline()
+    : m_value()
+    , m_hasValue(false)
+  {}
+
+  Inline(std::nullptr_t)
+    : m_value()
+    , m_hasValue(false)
+  {}
+
+  Inline(UnderlyingType value)
+    : m_value(value)
+    , m_hasValue(true)
+  {}
+
+  Inline(const Wrapper& wrapper)
+    : m_value(wrapper.get() ? *wrapper.get() : UnderlyingType())
+    , m_hasValue(wrapper.get() != nullptr)
+  {}
+
+  /**
+   * Constructor used by &id:oatpp::Void::cast;. Value is copied.
+   * @param ptr
+   * @param valueType
+   */
+  Inline(const std::shared_ptr<ObjectType>& ptr, const Type* const valueType)
+    : m_value(ptr ? *ptr : UnderlyingType())
+    , m_hasValue(ptr != nullptr)
+  {
+    (void) valueType;
+  }
+
+  Inline& operator = (std::nullptr_t) {
+    m_value = UnderlyingType();
+    m_hasValue = false;
+    return *this;
+  }
+
+  Inline& operator = (UnderlyingType value) {
+    m_value = value;
+    m_hasValue = true;
+    return *this;
+  }
+
+  Inline& operator = (const Wrapper& wrapper) {
+    return *this = Inline(wrapper);
+  }
+
+  /**
+   * Get boxed copy of the value.
+   * @return - `Wrapper`.
+   */
+  Wrapper box() const {
+    if(m_hasValue) {
+      return Wrapper(m_value);
+    }
+    return nullptr;
+  }
+
+  /**
+   * Get non-owning view of the value. No allocations. <br>
+   * View is valid as long as this object is alive and is not modified.
+   * @return - &id:oatpp::Void;.
+   */
+  Void view() {
+    if(m_hasValue) {
+      return Void(std::shared_ptr<void>(std::shared_ptr<void>(), &m_value), Class::getType());
+    }
+    return Void(Class::getType());
+  }
+
+  operator Wrapper() const {
+    return box();
+  }
+
+  inline operator UnderlyingType() const {
+    return m_value;
+  }
+
+  UnderlyingType operator*() const {
+    return m_value;
+  }
+
+  /**
+   * Check if value is set.
+   * @return - `false` if value is `nullptr`.
+   */
+  bool hasValue() const {
+    return m_hasValue;
+  }
+
+  UnderlyingType getValue(const UnderlyingType& defaultValue) const {
+    if(m_hasValue) {
+      return m_value;
+    }
+    return defaultValue;
+  }
+
+  template<typename T,
+    typename enabled = typename std::enable_if<std::is_same<T, std::nullptr_t>::value, void>::type
+  >
+  inline bool operator == (T) const {
+    return !m_hasValue;
+  }
+
+  template<typename T,
+    typename enabled = typename std::enable_if<std::is_same<T, std::nullptr_t>::value, void>::type
+  >
+  inline bool operator != (T) const {
+    return m_hasValue;
+  }
+
+  template<typename T>
+  inline typename std::enable_if<std::is_same<T, UnderlyingType>::value, bool>::type operator == (T value) const {
+    return m_hasValue && m_value == value;
+  }
+
+  template<typename T>
+  inline typename std::enable_if<std::is_same<T, UnderlyingType>::value, bool>::type operator != (T value) const {
+    return !(m_hasValue && m_value == value);
+  }
+
+  template<typename T,
+    typename enabled = typename std::enable_if<std::is_same<T, Inline>::value, void>::type
+  >
+  inline bool operator == (const T &other) const {
+    if(!m_hasValue || !other.m_hasValue) return m_hasValue == other.m_hasValue;
+    return m_value == other.m_value;
+  }
+
+  template<typename T,
+    typename enabled = typename std::enable_if<std::is_same<T, Inline>::value, void>::type
+  >
+  inline bool operator != (const T &other) const {
+    return !operator == (other);
+  }
+
+};
+
+template<class Wrapper>
+struct InlineTraits<Inline<Wrapper>> {
+
+  static const BaseObject::Property::InlineAccessor* getAccessor() {
+    static typename Inline<Wrapper>::Accessor accessor;
+    return &accessor;
+  }
+
+};
+
+namespace __class {
+
+  template<class Wrapper>
+  struct Collection::ItemView<Inline<Wrapper>> {
+
+    static type::Void get(const Inline<Wrapper>& i) {
+      return const_cast<Inline<Wrapper>&>(i).view();
+    }
+
+  };
+
+}
+
+}}}}
+
+namespace std {
+
+  template<class Wrapper>
+  struct hash<oatpp::data::mapping::type::Inline<Wrapper>> {
+
+    typedef oatpp::data::mapping::type::Inline<Wrapper> argument_type;
+    typedef v_uint64 result_type;
+
+    result_type operator()(argument_type const& v) const noexcept {
+      if(!v.hasValue()) return hash<Wrapper> {} (nullptr);
+      return hash<typename argument_type::UnderlyingType> {} (*v);
+    }
+
+  };
+
+}
+
+#endif // oatpp_data_mapping_type_Inline_hpp
@@ -26,6 +26,9 @@
 #define oatpp_data_mapping_type_Map_hpp
 
 #include "./Type.hpp"
+
+#include "oatpp/core/data/mapping/Arena.hpp"
+
 #include <list>
 
 namespace oatpp { namespace data { namespace mapping { namespace type {
@@ -173,7 +176,7 @@ public:
   public:
 
     type::Void createObject() const override {
-      return type::Void(std::make_shared<ContainerType>(), Clazz::getType());
+      return type::Void(Arena::allocateShared<ContainerType>(), Clazz::getType());
     }
 
     const type::Type* getKeyType() const override {
@@ -44,6 +44,10 @@ Void& BaseObject::getAsRef(v_int64 offset) const {
   return *property;
 }
 
+void* BaseObject::getFieldPointer(v_int64 offset) const {
+  return (void*)(((v_int64) m_basePointer) + offset);
+}
+
 void BaseObject::setBasePointer(void* basePointer) {
   m_basePointer = basePointer;
 }
@@ -56,6 +60,187 @@ void* BaseObject::getBasePointer() const {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // BaseObject::Properties
 
+BaseObject::Properties::Properties()
+  : m_encodedTables(nullptr)
+  , m_nameIndex(nullptr)
+{}
+
+BaseObject::Properties::Properties(const Properties& other)
+  : m_map(other.m_map)
+  , m_list(other.m_list)
+  , m_encodedTables(nullptr)
+  , m_nameIndex(nullptr)
+{}
+
+BaseObject::Properties::~Properties() {
+  EncodedTable* curr = m_encodedTables.load();
+  while(curr != nullptr) {
+    EncodedTable* next = curr->next;
+    delete curr;
+    curr = next;
+  }
+  NameIndex* index = m_nameIndex.load();
+  while(index != nullptr) {
+    NameIndex* previous = index->m_previous;
+    delete index;
+    index = previous;
+  }
+}
+
+const BaseObject::Properties::NameIndex& BaseObject::Properties::getNameIndex() const {
+
+  NameIndex* index = m_nameIndex.load(std::memory_order_acquire);
+  if(index != nullptr && index->m_entries.size() == m_list.size()) {
+    return *index;
+  }
+
+  std::lock_guard<std::mutex> lock(m_encodedTablesMutex);
+
+  index = m_nameIndex.load(std::memory_order_acquire);
+  if(index != nullptr && index->m_entries.size() == m_list.size()) {
+    return *index;
+  }
+
+  /* outdated index is kept alive - it may still be referenced by readers */
+  NameIndex* newIndex = new NameIndex();
+  newIndex->m_previous = index;
+  newIndex->m_entries.reserve(m_list.size());
+  for(Property* property : m_list) {
+    auto it = m_map.find(property->name);
+    newIndex->m_entries.push_back({property->name, (v_buff_size) std::strlen(property->name), it->second});
+  }
+  newIndex->build();
+
+  m_nameIndex.store(newIndex, std::memory_order_release);
+
+  return *newIndex;
+
+}
+
+const std::vector<BaseObject::Properties::EncodedProperty>&
+BaseObject::Properties::getEncodedProperties(NameEncoder encoder, v_uint64 param) const {
+
+  const size_t propertiesCount = m_list.size();
+
+  for(EncodedTable* curr = m_encodedTables.load(std::memory_order_acquire); curr != nullptr; curr = curr->next) {
+    if(curr->encoder == encoder && curr->param == param && curr->properties.size() == propertiesCount) {
+      return curr->properties;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_encodedTablesMutex);
+
+  EncodedTable* head = m_encodedTables.load(std::memory_order_acquire);
+  for(EncodedTable* curr = head; curr != nullptr; curr = curr->next) {
+    if(curr->encoder == encoder && curr->param == param && curr->properties.size() == propertiesCount) {
+      return curr->properties;
+    }
+  }
+
+  /* tables are never removed - references returned to readers stay valid for the lifetime of Properties */
+  EncodedTable* table = new EncodedTable();
+  table->encoder = encoder;
+  table->param = param;
+  table->properties.reserve(propertiesCount);
+  for(Property* property : m_list) {
+    table->properties.push_back({property, encoder(property->name, param)});
+  }
+  table->next = head;
+
+  m_encodedTables.store(table, std::memory_order_release);
+
+  return table->properties;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// BaseObject::Properties::NameIndex
+
+v_uint32 BaseObject::Properties::NameIndex::hash(const char* data, v_buff_size size, v_uint32 seed) {
+  v_uint32 result = 2166136261U ^ seed;
+  for(v_buff_size i = 0; i < size; i ++) {
+    result ^= (v_uint8) data[i];
+    result *= 16777619U;
+  }
+  result ^= (v_uint32) size;
+  result ^= result >> 15;
+  return result;
+}
+
+bool BaseObject::Properties::NameIndex::place(v_uint32 tableSize, v_uint32 seed, bool perfect) {
+
+  m_slots.assign(tableSize, -1);
+  m_seed = seed;
+  m_mask = tableSize - 1;
+  m_perfect = perfect;
+
+  for(v_int32 i = 0; i < (v_int32) m_entries.size(); i ++) {
+
+    const Entry& entry = m_entries[i];
+    v_uint32 slot = hash(entry.name, entry.size, seed) & m_mask;
+
+    while(true) {
+      v_int32 occupant = m_slots[slot];
+      if(occupant == -1) {
+        m_slots[slot] = i;
+        break;
+      }
+      if(m_entries[occupant].size == entry.size && std::memcmp(m_entries[occupant].name, entry.name, entry.size) == 0) {
+        break; // duplicate name - first one wins, same as in the properties map
+      }
+      if(perfect) {
+        return false;
+      }
+      slot = (slot + 1) & m_mask;
+    }
+
+  }
+
+  return true;
+
+}
+
+void BaseObject::Properties::NameIndex::build() {
+
+  v_uint32 tableSize = 8;
+  while(tableSize < m_entries.size() * 2) {
+    tableSize <<= 1;
+  }
+
+  for(v_uint32 sizeAttempt = 0; sizeAttempt < 3; sizeAttempt ++) {
+    for(v_uint32 seed = 0; seed < 256; seed ++) {
+      if(place(tableSize, seed * 0x9E3779B9U, true)) {
+        return;
+      }
+    }
+    tableSize <<= 1;
+  }
+
+  place(tableSize, 0, false);
+
+}
+
+v_int32 BaseObject::Properties::NameIndex::findIndex(const char* name, v_buff_size size) const {
+
+  v_uint32 slot = hash(name, size, m_seed) & m_mask;
+
+  while(true) {
+    v_int32 index = m_slots[slot];
+    if(index == -1) {
+      return -1;
+    }
+    const Entry& entry = m_entries[index];
+    if(entry.size == size && std::memcmp(entry.name, name, size) == 0) {
+      return index;
+    }
+    if(m_perfect) {
+      return -1;
+    }
+    slot = (slot + 1) & m_mask;
+  }
+
+}
+
 BaseObject::Property* BaseObject::Properties::pushBack(Property* property) {
   m_map.insert({property->name, property});
   m_list.push_back(property);
@@ -70,21 +255,40 @@ void BaseObject::Properties::pushFrontAll(Properties* properties) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // BaseObject::Property
 
-BaseObject::Property::Property(v_int64 pOffset, const char* pName, const Type* pType)
+BaseObject::Property::Property(v_int64 pOffset, const char* pName, const Type* pType, const InlineAccessor* pInlineAccessor)
   : offset(pOffset)
+  , inlineAccessor(pInlineAccessor)
   , name(pName)
   , type(pType)
 {}
 
 void BaseObject::Property::set(BaseObject* object, const Void& value) {
+  if(inlineAccessor) {
+    inlineAccessor->set(object->getFieldPointer(offset), value);
+    return;
+  }
   object->set(offset, value);
 }
 
 Void BaseObject::Property::get(BaseObject* object) {
+  if(inlineAccessor) {
+    return inlineAccessor->get(object->getFieldPointer(offset));
+  }
+  return object->get(offset);
+}
+
+Void BaseObject::Property::getView(BaseObject* object) {
+  if(inlineAccessor) {
+    return inlineAccessor->getView(object->getFieldPointer(offset));
+  }
   return object->get(offset);
 }
 
 Void& BaseObject::Property::getAsRef(BaseObject* object) {
+  if(inlineAccessor) {
+    throw std::runtime_error("[oatpp::data::mapping::type::BaseObject::Property::getAsRef()]: Error. "
+                             "Property '" + std::string(name) + "' is inline and can't be accessed as ObjectWrapper reference.");
+  }
   return object->getAsRef(offset);
 }
 
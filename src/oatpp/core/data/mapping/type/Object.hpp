@@ -36,8 +36,12 @@
 #include "./Vector.hpp"
 #include "./UnorderedSet.hpp"
 
+#include "oatpp/core/data/mapping/Arena.hpp"
 #include "oatpp/core/base/Countable.hpp"
 
+#include <atomic>
+#include <cstring>
+#include <mutex>
 #include <type_traits>
 
 namespace oatpp { namespace data { namespace mapping { namespace type {
@@ -85,6 +89,42 @@ public:
 
     };
 
+    /**
+     * Accessor for fields which store their value inline (not as ObjectWrapper). <br>
+     * See &id:oatpp::data::mapping::type::Inline;.
+     */
+    class InlineAccessor {
+    public:
+
+      /**
+       * Default virtual destructor.
+       */
+      virtual ~InlineAccessor() = default;
+
+      /**
+       * Copy value into field storage.
+       * @param field - pointer to field.
+       * @param value - value to set. Its type must be the field type or value must be `nullptr`.
+       */
+      virtual void set(void* field, const Void& value) const = 0;
+
+      /**
+       * Get boxed copy of field value.
+       * @param field - pointer to field.
+       * @return - &id:oatpp::Void;.
+       */
+      virtual Void get(const void* field) const = 0;
+
+      /**
+       * Get non-owning view of field value. No allocations. <br>
+       * View is valid as long as the field is alive and is not modified.
+       * @param field - pointer to field.
+       * @return - &id:oatpp::Void;.
+       */
+      virtual Void getView(void* field) const = 0;
+
+    };
+
   public:
 
     /**
@@ -117,6 +157,7 @@ public:
 
   private:
     const v_int64 offset;
+    const InlineAccessor* const inlineAccessor;
   public:
 
     /**
@@ -124,8 +165,9 @@ public:
      * @param pOffset - memory offset of object field from object start address.
      * @param pName - name of the property.
      * @param pType - &l:Type; of the property.
+     * @param pInlineAccessor - &l:Property::InlineAccessor; if field stores its value inline. `nullptr` otherwise.
      */
-    Property(v_int64 pOffset, const char* pName, const Type* pType);
+    Property(v_int64 pOffset, const char* pName, const Type* pType, const InlineAccessor* pInlineAccessor = nullptr);
 
     /**
      * Property name.
@@ -150,30 +192,202 @@ public:
     void set(BaseObject* object, const Void& value);
 
     /**
-     * Get value of object field mapped by this property.
+     * Get value of object field mapped by this property. <br>
+     * For inline fields the value is a boxed copy.
      * @param object - object address.
      * @return - value of the field.
      */
     Void get(BaseObject* object);
 
     /**
-     * Get reference to ObjectWrapper of the object field.
+     * Get value of object field mapped by this property without copying it. <br>
+     * For inline fields the result is a non-owning view - it is valid as long as the object is alive and the field is not modified.
+     * For other fields it is the same as &l:Property::get ();.
+     * @param object - object address.
+     * @return - value of the field.
+     */
+    Void getView(BaseObject* object);
+
+    /**
+     * Get reference to ObjectWrapper of the object field. <br>
+     * Throws `std::runtime_error` for inline fields since they are not stored as ObjectWrapper.
      * @param object - object address.
      * @return - reference to ObjectWrapper of the object field.
      */
     Void& getAsRef(BaseObject* object);
 
+    /**
+     * Check if the field stores its value inline (not as ObjectWrapper).
+     * @return - `true` if field is inline.
+     */
+    bool isInline() const {
+      return inlineAccessor != nullptr;
+    }
+
   };
 
   /**
    * Object type properties table.
    */
   class Properties {
+  public:
+
+    /**
+     * Function to encode property name for a specific serialization format.
+     * @param name - property name.
+     * @param param - encoder parameter. Ex.: escape flags.
+     * @return - encoded name.
+     */
+    typedef std::string (*NameEncoder)(const char* name, v_uint64 param);
+
+    /**
+     * Property with the pre-encoded name.
+     */
+    struct EncodedProperty {
+
+      /**
+       * Property.
+       */
+      Property* property;
+
+      /**
+       * Encoded name of the property.
+       */
+      std::string encodedName;
+
+    };
+
+    /**
+     * Index for property lookup by raw name bytes. <br>
+     * Names are placed into an open-addressing table with the seed chosen so that there are no collisions (perfect hash).
+     * If no such seed is found, the table falls back to linear probing.
+     */
+    class NameIndex {
+      friend Properties;
+    public:
+
+      /**
+       * Index entry.
+       */
+      struct Entry {
+
+        /**
+         * Property name.
+         */
+        const char* name;
+
+        /**
+         * Size of property name.
+         */
+        v_buff_size size;
+
+        /**
+         * Property.
+         */
+        Property* property;
+
+      };
+
+    private:
+      std::vector<Entry> m_entries;
+      std::vector<v_int32> m_slots;
+      v_uint32 m_seed;
+      v_uint32 m_mask;
+      bool m_perfect;
+      NameIndex* m_previous;
+    private:
+      static v_uint32 hash(const char* data, v_buff_size size, v_uint32 seed);
+      bool place(v_uint32 tableSize, v_uint32 seed, bool perfect);
+      void build();
+    public:
+
+      /**
+       * Find index of property by name.
+       * @param name - pointer to name bytes (not necessarily null-terminated).
+       * @param size - size of name.
+       * @return - index of the property in declaration order or `-1` if not found.
+       */
+      v_int32 findIndex(const char* name, v_buff_size size) const;
+
+      /**
+       * Check if property at index has the given name.
+       * Use it to check the predicted property before doing the lookup.
+       * @param index - index of the property in declaration order.
+       * @param name - pointer to name bytes.
+       * @param size - size of name.
+       * @return - `true` if names match.
+       */
+      bool matches(v_int32 index, const char* name, v_buff_size size) const {
+        if(index < 0 || index >= (v_int32) m_entries.size()) {
+          return false;
+        }
+        const Entry& entry = m_entries[index];
+        return entry.size == size && std::memcmp(entry.name, name, size) == 0;
+      }
+
+      /**
+       * Get entry by index.
+       * @param index - index of the property in declaration order.
+       * @return - &l:BaseObject::Properties::NameIndex::Entry;.
+       */
+      const Entry& getEntry(v_int32 index) const {
+        return m_entries[index];
+      }
+
+      /**
+       * Get number of entries.
+       * @return - number of entries.
+       */
+      v_int32 getSize() const {
+        return (v_int32) m_entries.size();
+      }
+
+      /**
+       * Check if index is a perfect hash table.
+       * @return - `true` if lookup takes exactly one probe.
+       */
+      bool isPerfect() const {
+        return m_perfect;
+      }
+
+    };
+
+  private:
+
+    struct EncodedTable {
+      NameEncoder encoder;
+      v_uint64 param;
+      std::vector<EncodedProperty> properties;
+      EncodedTable* next;
+    };
+
   private:
     std::unordered_map<std::string, Property*> m_map;
     std::list<Property*> m_list;
+  private:
+    mutable std::atomic<EncodedTable*> m_encodedTables;
+    mutable std::atomic<NameIndex*> m_nameIndex;
+    mutable std::mutex m_encodedTablesMutex;
   public:
 
+    /**
+     * Default constructor.
+     */
+    Properties();
+
+    /**
+     * Copy constructor. Cached encoded names are not copied.
+     * @param other
+     */
+    Properties(const Properties& other);
+
+    /**
+     * Non-virtual destructor.
+     */
+    ~Properties();
+
+    Properties& operator=(const Properties& other) = delete;
+
     /**
      * Add property to the end of the list.
      * @param property
@@ -202,6 +416,23 @@ public:
       return m_list;
     }
 
+    /**
+     * Get properties in ordered way together with their names pre-encoded by `encoder`. <br>
+     * The table is built once per `encoder` and `param` pair and stored in a contiguous vector.
+     * Subsequent calls are lock-free.
+     * @param encoder - &l:BaseObject::Properties::NameEncoder;.
+     * @param param - encoder parameter.
+     * @return - std::vector of &l:BaseObject::Properties::EncodedProperty;.
+     */
+    const std::vector<EncodedProperty>& getEncodedProperties(NameEncoder encoder, v_uint64 param) const;
+
+    /**
+     * Get index for property lookup by raw name bytes. <br>
+     * The index is built once and subsequent calls are lock-free.
+     * @return - &l:BaseObject::Properties::NameIndex;.
+     */
+    const NameIndex& getNameIndex() const;
+
   };
 
 private:
@@ -210,11 +441,33 @@ private:
   void set(v_int64 offset, const Void& value);
   Void get(v_int64 offset) const;
   Void& getAsRef(v_int64 offset) const;
+  void* getFieldPointer(v_int64 offset) const;
 protected:
   void setBasePointer(void* basePointer);
   void* getBasePointer() const;
 };
 
+/**
+ * Inline storage traits of the DTO field type. <br>
+ * Specialized by &id:oatpp::data::mapping::type::Inline;.
+ * @tparam T - field type.
+ */
+template<class T>
+struct InlineTraits {
+
+  /**
+   * Get accessor for inline field.
+   * @return - &id:oatpp::data::mapping::type::BaseObject::Property::InlineAccessor; or `nullptr` if the field is a regular ObjectWrapper.
+   */
+  static const BaseObject::Property::InlineAccessor* getAccessor() {
+    return nullptr;
+  }
+
+};
+
+template<class Wrapper>
+class Inline;
+
 namespace __class {
 
   /**
@@ -255,7 +508,7 @@ namespace __class {
     public:
 
       type::Void createObject() const override {
-        return type::Void(std::make_shared<T>(), getType());
+        return type::Void(Arena::allocateShared<T>(), getType());
       }
 
       const type::BaseObject::Properties* getProperties() const override {
@@ -405,8 +658,23 @@ public:
     return dispatcher->getProperties()->getList().size();
   }
 
+  /**
+   * Get reference to ObjectWrapper of the object field. <br>
+   * *Note:* fields declared as &id:oatpp::data::mapping::type::Inline; are not stored as ObjectWrapper and can't be referenced -
+   * `std::runtime_error` is thrown for them. Access such fields with &id:oatpp::data::mapping::type::BaseObject::Property::get;,
+   * &id:oatpp::data::mapping::type::BaseObject::Property::getView; and &id:oatpp::data::mapping::type::BaseObject::Property::set; -
+   * ex.: `getPropertiesMap().at("field")->get(dto.get())`.
+   * @param propertyName - name of the property.
+   * @return - reference to ObjectWrapper of the field.
+   * @throws - `std::out_of_range` if there is no such property. `std::runtime_error` if the field is inline.
+   */
   ObjectWrapper<void>& operator[](const std::string& propertyName) {
-    return getPropertiesMap().at(propertyName)->getAsRef(this->m_ptr.get());
+    auto property = getPropertiesMap().at(propertyName);
+    if(property->isInline()) {
+      throw std::runtime_error("[oatpp::data::mapping::type::DTOWrapper::operator[]()]: Error. Field '" + propertyName + "' is Inline<T>. "
+                               "Use BaseObject::Property::get()/getView()/set() to access it.");
+    }
+    return property->getAsRef(this->m_ptr.get());
   }
 
 };
@@ -440,6 +708,9 @@ public:
   template <class T>
   using Object = DTOWrapper<T>;
 
+  template <class T>
+  using Inline = oatpp::data::mapping::type::Inline<T>;
+
   template <class T>
   using Enum = oatpp::data::mapping::type::Enum<T>;
 
@@ -27,6 +27,7 @@
 
 #include "./Type.hpp"
 
+#include "oatpp/core/data/mapping/Arena.hpp"
 #include "oatpp/core/base/Countable.hpp"
 
 #include <algorithm>
@@ -69,11 +70,11 @@ public:
   String() {}
 
   explicit String(v_buff_size size)
-    : type::ObjectWrapper<std::string, __class::String>(std::make_shared<std::string>(size, '\0'))
+    : type::ObjectWrapper<std::string, __class::String>(Arena::allocateShared<std::string>(size, '\0'))
   {}
 
   String(const char* data, v_buff_size size)
-    : type::ObjectWrapper<std::string, __class::String>(std::make_shared<std::string>(data, size))
+    : type::ObjectWrapper<std::string, __class::String>(Arena::allocateShared<std::string>(data, size))
   {}
 
   template<typename T,
@@ -86,7 +87,7 @@ public:
   >
   String(const T* data)
     : type::ObjectWrapper<std::string, __class::String>(
-        data == nullptr ? nullptr : std::make_shared<std::string>(data)
+        data == nullptr ? nullptr : Arena::allocateShared<std::string>(data)
       )
   {}
 
@@ -94,7 +95,7 @@ public:
     typename enabled = typename std::enable_if<std::is_same<T, std::string>::value, void>::type
   >
   String(const T& str)
-    : type::ObjectWrapper<std::string, __class::String>(std::make_shared<std::string>(str))
+    : type::ObjectWrapper<std::string, __class::String>(Arena::allocateShared<std::string>(str))
   {}
 
   template<typename T,
@@ -102,7 +103,7 @@ public:
   >
   String(T&& str)
     : type::ObjectWrapper<std::string, __class::String>(
-        std::make_shared<std::string>(std::forward<std::string>(str))
+        Arena::allocateShared<std::string>(std::forward<std::string>(str))
       )
   {}
 
@@ -158,7 +159,7 @@ public:
   >
   inline String& operator = (const T* str) {
     if (str) {
-      m_ptr = std::make_shared<std::string>(str);
+      m_ptr = Arena::allocateShared<std::string>(str);
     } else {
       m_ptr.reset();
     }
@@ -169,7 +170,7 @@ public:
     typename enabled = typename std::enable_if<std::is_same<T, std::string>::value, void>::type
   >
   inline String& operator = (const T& str) {
-    m_ptr = std::make_shared<std::string>(str);
+    m_ptr = Arena::allocateShared<std::string>(str);
     return *this;
   }
 
@@ -177,7 +178,7 @@ public:
     typename enabled = typename std::enable_if<std::is_same<T, std::string>::value, void>::type
   >
   inline String& operator = (T&& str) {
-    m_ptr = std::make_shared<std::string>(std::forward<std::string>(str));
+    m_ptr = Arena::allocateShared<std::string>(std::forward<std::string>(str));
     return *this;
   }
 
@@ -294,11 +295,11 @@ public:
   OATPP_DEFINE_OBJECT_WRAPPER_DEFAULTS(Primitive, TValueType, Clazz)
 
   Primitive(TValueType value)
-    : type::ObjectWrapper<TValueType, Clazz>(std::make_shared<TValueType>(value))
+    : type::ObjectWrapper<TValueType, Clazz>(Arena::allocateShared<TValueType>(value))
   {}
 
   Primitive& operator = (TValueType value) {
-    this->m_ptr = std::make_shared<TValueType>(value);
+    this->m_ptr = Arena::allocateShared<TValueType>(value);
     return *this;
   }
 
@@ -376,11 +377,11 @@ public:
   OATPP_DEFINE_OBJECT_WRAPPER_DEFAULTS(Boolean, bool, __class::Boolean)
 
   Boolean(bool value)
-    : type::ObjectWrapper<bool, __class::Boolean>(std::make_shared<bool>(value))
+    : type::ObjectWrapper<bool, __class::Boolean>(Arena::allocateShared<bool>(value))
   {}
 
   Boolean& operator = (bool value) {
-    this->m_ptr = std::make_shared<bool>(value);
+    this->m_ptr = Arena::allocateShared<bool>(value);
     return *this;
   }
 
@@ -27,9 +27,80 @@
 
 namespace oatpp { namespace data{ namespace stream {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// InlineWriteVectorData
+
+InlineWriteVectorData::InlineWriteVectorData()
+  : vectors(nullptr)
+  , count(0)
+{}
+
+InlineWriteVectorData::InlineWriteVectorData(IOVector* pVectors, v_buff_size pCount)
+  : vectors(nullptr)
+  , count(0)
+{
+  set(pVectors, pCount);
+}
+
+void InlineWriteVectorData::set(IOVector* pVectors, v_buff_size pCount) {
+  vectors = pVectors;
+  count = pCount;
+  inc(0);
+}
+
+void InlineWriteVectorData::inc(v_buff_size amount) {
+  while(count > 0 && amount >= vectors->size) {
+    amount -= vectors->size;
+    vectors ++;
+    count --;
+  }
+  if(count > 0 && amount > 0) {
+    vectors->data = (const char*) vectors->data + amount;
+    vectors->size -= amount;
+  }
+}
+
+v_buff_size InlineWriteVectorData::getBytesLeft() const {
+  v_buff_size result = 0;
+  for(v_buff_size i = 0; i < count; i ++) {
+    result += vectors[i].size;
+  }
+  return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // WriteCallback
 
+v_io_size WriteCallback::writev(const IOVector* vectors, v_buff_size count, async::Action& action) {
+
+  v_io_size progress = 0;
+
+  for(v_buff_size i = 0; i < count; i ++) {
+
+    if(vectors[i].size == 0) {
+      continue;
+    }
+
+    /* once some data is written - report progress and let the caller retry the rest */
+    async::Action nextAction;
+    auto res = write(vectors[i].data, vectors[i].size, progress == 0 ? action : nextAction);
+
+    if(res <= 0) {
+      return progress == 0 ? res : progress;
+    }
+
+    progress += res;
+
+    if(res < vectors[i].size) {
+      break;
+    }
+
+  }
+
+  return progress;
+
+}
+
 v_io_size WriteCallback::write(data::buffer::InlineWriteData& inlineData, async::Action& action) {
   auto res = write(inlineData.currBufferPtr, inlineData.bytesLeft, action);
   if(res > 0) {
@@ -38,6 +109,14 @@ v_io_size WriteCallback::write(data::buffer::InlineWriteData& inlineData, async:
   return res;
 }
 
+v_io_size WriteCallback::writev(InlineWriteVectorData& inlineData, async::Action& action) {
+  auto res = writev(inlineData.vectors, inlineData.count, action);
+  if(res > 0) {
+    inlineData.inc(res);
+  }
+  return res;
+}
+
 v_io_size WriteCallback::writeSimple(const void *data, v_buff_size count) {
   async::Action action;
   auto res = write(data, count, action);
@@ -69,6 +148,22 @@ v_io_size WriteCallback::writeExactSizeDataSimple(const void *data, v_buff_size
   return writeExactSizeDataSimple(inlineData);
 }
 
+v_io_size WriteCallback::writevExactSizeDataSimple(InlineWriteVectorData& inlineData) {
+  auto initialCount = inlineData.getBytesLeft();
+  while(inlineData.count > 0) {
+    async::Action action;
+    auto res = writev(inlineData, action);
+    if(!action.isNone()) {
+      OATPP_LOGE("[oatpp::data::stream::WriteCallback::writevExactSizeDataSimple()]", "Error. writevExactSizeDataSimple() is called on a stream in Async mode.");
+      throw std::runtime_error("[oatpp::data::stream::WriteCallback::writevExactSizeDataSimple()]: Error. writevExactSizeDataSimple() is called on a stream in Async mode.");
+    }
+    if(res == IOError::BROKEN_PIPE || res == IOError::ZERO_VALUE) {
+      break;
+    }
+  }
+  return initialCount - inlineData.getBytesLeft();
+}
+
 async::Action WriteCallback::writeExactSizeDataAsyncInline(data::buffer::InlineWriteData& inlineData, async::Action&& nextAction) {
 
   if(inlineData.bytesLeft > 0) {
@@ -105,6 +200,42 @@ async::Action WriteCallback::writeExactSizeDataAsyncInline(data::buffer::InlineW
 
 }
 
+async::Action WriteCallback::writevExactSizeDataAsyncInline(InlineWriteVectorData& inlineData, async::Action&& nextAction) {
+
+  if(inlineData.count > 0) {
+
+    async::Action action;
+    auto res = writev(inlineData, action);
+
+    if (!action.isNone()) {
+      return action;
+    }
+
+    if (res > 0) {
+      return async::Action::createActionByType(async::Action::TYPE_REPEAT);
+    } else {
+      switch (res) {
+        case IOError::BROKEN_PIPE:
+          return new AsyncIOError(IOError::BROKEN_PIPE);
+        case IOError::ZERO_VALUE:
+          break;
+        case IOError::RETRY_READ:
+          return async::Action::createActionByType(async::Action::TYPE_REPEAT);
+        case IOError::RETRY_WRITE:
+          return async::Action::createActionByType(async::Action::TYPE_REPEAT);
+        default:
+          OATPP_LOGE("[oatpp::data::stream::writevExactSizeDataAsyncInline()]", "Error. Unknown IO result.");
+          return new async::Error(
+            "[oatpp::data::stream::writevExactSizeDataAsyncInline()]: Error. Unknown IO result.");
+      }
+    }
+
+  }
+
+  return std::forward<async::Action>(nextAction);
+
+}
+
 async::CoroutineStarter WriteCallback::writeExactSizeDataAsync(const void* data, v_buff_size size) {
 
   class WriteDataCoroutine : public oatpp::async::Coroutine<WriteDataCoroutine> {
@@ -643,8 +774,8 @@ v_io_size transfer(const base::ObjectHandle<ReadCallback>& readCallback,
         return progress;
 
       default:
-        //throw std::runtime_error("Unknown buffer processor error.");
-        return progress;
+        /* ex.: malformed input of a decoder. Don't report partially processed data as a complete transfer */
+        throw std::runtime_error("[oatpp::data::stream::transfer()]: Error. Processor error " + std::to_string(procRes) + ".");
 
     }
 
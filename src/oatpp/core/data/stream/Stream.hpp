@@ -191,6 +191,72 @@ enum IOMode : v_int32 {
   ASYNCHRONOUS = 1
 };
 
+/**
+ * Memory block for vectored (scatter/gather) write. See &l:WriteCallback::writev ();.
+ */
+struct IOVector {
+
+  /**
+   * Pointer to data.
+   */
+  const void* data;
+
+  /**
+   * Size of the data in bytes.
+   */
+  v_buff_size size;
+
+};
+
+/**
+ * Convenience structure for vectored Async-Inline write operations. <br>
+ * Tracks write progress over an array of &l:IOVector;. *Note:* the array is modified as data is written.
+ */
+struct InlineWriteVectorData {
+
+  /**
+   * Pointer to the first vector which is not fully written yet.
+   */
+  IOVector* vectors;
+
+  /**
+   * Count of vectors left.
+   */
+  v_buff_size count;
+
+  /**
+   * Default constructor.
+   */
+  InlineWriteVectorData();
+
+  /**
+   * Constructor.
+   * @param vectors - array of &l:IOVector;.
+   * @param count - count of vectors in array.
+   */
+  InlineWriteVectorData(IOVector* vectors, v_buff_size count);
+
+  /**
+   * Set vectors to write.
+   * @param vectors - array of &l:IOVector;.
+   * @param count - count of vectors in array.
+   */
+  void set(IOVector* vectors, v_buff_size count);
+
+  /**
+   * Advance write position by `amount` bytes - skip fully written vectors and shift the partially written one.
+   * @param amount
+   */
+  void inc(v_buff_size amount);
+
+  /**
+   * Get total number of bytes left to write.
+   * @return
+   */
+  v_buff_size getBytesLeft() const;
+
+};
+
 /**
  * Callback for stream write operation.
  */
@@ -212,16 +278,34 @@ public:
    */
   virtual v_io_size write(const void *data, v_buff_size count, async::Action& action) = 0;
 
+  /**
+   * Vectored write operation - write several memory blocks at once. <br>
+   * Streams capable of scatter/gather I/O should override this method to put all blocks out with a single call.
+   * Default implementation writes blocks one by one with &l:WriteCallback::write (); and stops at the first short write.
+   * @param vectors - array of &l:IOVector;.
+   * @param count - count of vectors in array.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes written. 0 - to indicate end-of-file.
+   */
+  virtual v_io_size writev(const IOVector* vectors, v_buff_size count, async::Action& action);
+
   v_io_size write(data::buffer::InlineWriteData& inlineData, async::Action& action);
 
+  v_io_size writev(InlineWriteVectorData& inlineData, async::Action& action);
+
   v_io_size writeSimple(const void *data, v_buff_size count);
 
   v_io_size writeExactSizeDataSimple(data::buffer::InlineWriteData& inlineData);
 
   v_io_size writeExactSizeDataSimple(const void *data, v_buff_size count);
 
+  v_io_size writevExactSizeDataSimple(InlineWriteVectorData& inlineData);
+
   async::Action writeExactSizeDataAsyncInline(data::buffer::InlineWriteData& inlineData, async::Action&& nextAction);
 
+  async::Action writevExactSizeDataAsyncInline(InlineWriteVectorData& inlineData, async::Action&& nextAction);
+
   async::CoroutineStarter writeExactSizeDataAsync(const void* data, v_buff_size size);
 
   /**
@@ -24,6 +24,8 @@
 
 #include "Caret.hpp"
 
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
 #include <cstdlib>
 #include <algorithm>
 
@@ -351,46 +353,62 @@ v_int64 Caret::StateSaveGuard::getSavedErrorCode() {
   }
 
   v_int64 Caret::parseInt(int base) {
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    v_int64 result = (v_int64)std::strtoll(start, &end, base);
-    if(start == end){
+    if(base != 10) {
+      char* end;
+      char* start = (char*)&m_data[m_pos];
+      v_int64 result = (v_int64)std::strtoll(start, &end, base);
+      if(start == end){
+        m_errorMessage = ERROR_INVALID_INTEGER;
+      }
+      m_pos = ((v_buff_size) end - (v_buff_size) m_data);
+      return result;
+    }
+    v_int64 result;
+    auto consumed = utils::conversion::parseInt64(&m_data[m_pos], m_size - m_pos, result);
+    if(consumed == 0){
       m_errorMessage = ERROR_INVALID_INTEGER;
     }
-    m_pos = ((v_buff_size) end - (v_buff_size) m_data);
+    m_pos += consumed;
     return result;
   }
 
   v_uint64 Caret::parseUnsignedInt(int base) {
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    v_uint64 result = (v_uint64)std::strtoull(start, &end, base);
-    if(start == end){
+    if(base != 10) {
+      char* end;
+      char* start = (char*)&m_data[m_pos];
+      v_uint64 result = (v_uint64)std::strtoull(start, &end, base);
+      if(start == end){
+        m_errorMessage = ERROR_INVALID_INTEGER;
+      }
+      m_pos = ((v_buff_size) end - (v_buff_size) m_data);
+      return result;
+    }
+    v_uint64 result;
+    auto consumed = utils::conversion::parseUInt64(&m_data[m_pos], m_size - m_pos, result);
+    if(consumed == 0){
       m_errorMessage = ERROR_INVALID_INTEGER;
     }
-    m_pos = ((v_buff_size) end - (v_buff_size) m_data);
+    m_pos += consumed;
     return result;
   }
   
   v_float32 Caret::parseFloat32(){
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    v_float32 result = std::strtof(start , &end);
-    if(start == end){
+    v_float32 result;
+    auto consumed = utils::conversion::parseFloat32(&m_data[m_pos], m_size - m_pos, result);
+    if(consumed == 0){
       m_errorMessage = ERROR_INVALID_FLOAT;
     }
-    m_pos = ((v_buff_size) end - (v_buff_size) m_data);
+    m_pos += consumed;
     return result;
   }
   
   v_float64 Caret::parseFloat64(){
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    v_float64 result = std::strtod(start , &end);
-    if(start == end){
+    v_float64 result;
+    auto consumed = utils::conversion::parseFloat64(&m_data[m_pos], m_size - m_pos, result);
+    if(consumed == 0){
       m_errorMessage = ERROR_INVALID_FLOAT;
     }
-    m_pos = ((v_buff_size) end - (v_buff_size) m_data);
+    m_pos += consumed;
     return result;
   }
   
@@ -345,9 +345,10 @@ public:
 
   /**
    * parse integer value starting from the current position.
-   * Using function std::strtol()
+   * Base 10 is parsed with &id:oatpp::utils::conversion::parseInt64; and never goes out of @Caret::getSize() bound.
+   * Other bases are parsed using function std::strtol()
    *
-   * Warning: position may go out of @Caret::getSize() bound.
+   * Warning: for base other than 10 position may go out of @Caret::getSize() bound.
    *
    * @param base - base is passed to std::strtol function
    * @return parsed value
@@ -356,9 +357,10 @@ public:
 
   /**
    * parse integer value starting from the current position.
-   * Using function std::strtoul()
+   * Base 10 is parsed with &id:oatpp::utils::conversion::parseUInt64; and never goes out of @Caret::getSize() bound.
+   * Other bases are parsed using function std::strtoul()
    *
-   * Warning: position may go out of @Caret::getSize() bound.
+   * Warning: for base other than 10 position may go out of @Caret::getSize() bound.
    *
    * @param base - base is passed to std::strtoul function
    * @return parsed value
@@ -367,9 +369,7 @@ public:
 
   /**
    * parse float value starting from the current position.
-   * Using function std::strtof()
-   *
-   * Warning: position may go out of @Caret::getSize() bound.
+   * Using function &id:oatpp::utils::conversion::parseFloat32; - locale-independent and correctly rounded.
    *
    * @return parsed value
    */
@@ -377,9 +377,7 @@ public:
 
   /**
    * parse float value starting from the current position.
-   * Using function std::strtod()
-   *
-   * Warning: position may go out of @Caret::getSize() bound.
+   * Using function &id:oatpp::utils::conversion::parseFloat64; - locale-independent and correctly rounded.
    *
    * @return parsed value
    */
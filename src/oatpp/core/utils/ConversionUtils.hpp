@@ -96,6 +96,27 @@ namespace oatpp { namespace utils { namespace conversion {
    */
   v_uint64 strToUInt64(const oatpp::String& str, bool& success);
 
+  /**
+   * Parse decimal 64-bit integer from the beginning of the character sequence. <br>
+   * Accepts the same input as `std::strtoll` with base 10 (leading whitespace, optional sign) and saturates on overflow,
+   * but never reads past `size` and doesn't depend on the current locale.
+   * @param data - pointer to character sequence. Doesn't have to be null-terminated.
+   * @param size - size of the character sequence.
+   * @param result - out parameter. Parsed value.
+   * @return - number of characters consumed. `0` if no number was found.
+   */
+  v_buff_size parseInt64(const char* data, v_buff_size size, v_int64& result);
+
+  /**
+   * Parse decimal 64-bit unsigned integer from the beginning of the character sequence. <br>
+   * Same as &l:parseInt64 (); but follows `std::strtoull` semantics.
+   * @param data - pointer to character sequence. Doesn't have to be null-terminated.
+   * @param size - size of the character sequence.
+   * @param result - out parameter. Parsed value.
+   * @return - number of characters consumed. `0` if no number was found.
+   */
+  v_buff_size parseUInt64(const char* data, v_buff_size size, v_uint64& result);
+
   /**
    * Convert 32-bit integer to it's string representation.
    * @param value - 32-bit integer value.
@@ -249,11 +270,35 @@ namespace oatpp { namespace utils { namespace conversion {
    */
   v_float64 strToFloat64(const oatpp::String& str, bool& success);
 
+  /**
+   * Parse 32-bit float from the beginning of the character sequence. <br>
+   * The result is correctly rounded (Eisel-Lemire algorithm with an exact fallback)
+   * and doesn't depend on the current locale - decimal separator is always `'.'`.
+   * @param data - pointer to character sequence. Doesn't have to be null-terminated.
+   * @param size - size of the character sequence.
+   * @param result - out parameter. Parsed value.
+   * @return - number of characters consumed. `0` if no number was found.
+   */
+  v_buff_size parseFloat32(const char* data, v_buff_size size, v_float32& result);
+
+  /**
+   * Parse 64-bit float from the beginning of the character sequence. <br>
+   * The result is correctly rounded (Eisel-Lemire algorithm with an exact fallback)
+   * and doesn't depend on the current locale - decimal separator is always `'.'`.
+   * @param data - pointer to character sequence. Doesn't have to be null-terminated.
+   * @param size - size of the character sequence.
+   * @param result - out parameter. Parsed value.
+   * @return - number of characters consumed. `0` if no number was found.
+   */
+  v_buff_size parseFloat64(const char* data, v_buff_size size, v_float64& result);
+
   /**
    * Convert 32-bit float to it's string representation.
    * @param value - 32-bit float value.
    * @param data - buffer to write data to.
    * @param n - buffer size.
+   * @param format - `printf` format. If `nullptr` - the shortest representation which reads back
+   * to the same 32-bit float is written (locale-independent).
    * @return - length of the resultant string.
    */
   v_buff_size float32ToCharSequence(v_float32 value, p_char8 data, v_buff_size n, const char* format = OATPP_FLOAT_STRING_FORMAT);
@@ -263,6 +308,8 @@ namespace oatpp { namespace utils { namespace conversion {
    * @param value - 64-bit float value.
    * @param data - buffer to write data to.
    * @param n - buffer size.
+   * @param format - `printf` format. If `nullptr` - the shortest representation which reads back
+   * to the same 64-bit float is written (locale-independent).
    * @return - length of the resultant string.
    */
   v_buff_size float64ToCharSequence(v_float64 value, p_char8 data, v_buff_size n, const char* format = OATPP_FLOAT_STRING_FORMAT);
@@ -270,6 +317,7 @@ namespace oatpp { namespace utils { namespace conversion {
   /**
    * Convert 32-bit float to it's string representation.
    * @param value - 32-bit float value.
+   * @param format - `printf` format. If `nullptr` - the shortest round-trip representation is used.
    * @return - value as `oatpp::String`
    */
   oatpp::String float32ToStr(v_float32 value, const char* format = OATPP_FLOAT_STRING_FORMAT);
@@ -277,6 +325,7 @@ namespace oatpp { namespace utils { namespace conversion {
   /**
    * Convert 64-bit float to it's string representation.
    * @param value - 64-bit float value.
+   * @param format - `printf` format. If `nullptr` - the shortest round-trip representation is used.
    * @return - value as `oatpp::String`
    */
   oatpp::String float64ToStr(v_float64 value, const char* format = OATPP_FLOAT_STRING_FORMAT);
@@ -38,26 +38,73 @@ const v_int32 Server::STATUS_DONE = 4;
 Server::Server(const std::shared_ptr<ConnectionProvider> &connectionProvider,
                const std::shared_ptr<ConnectionHandler> &connectionHandler)
     : m_status(STATUS_CREATED)
-    , m_connectionProvider(connectionProvider)
-    , m_connectionHandler(connectionHandler)
+    , m_connectionProviders({connectionProvider})
+    , m_connectionHandlers({connectionHandler})
     , m_threaded(false) {}
 
+Server::Server(const std::vector<std::shared_ptr<ConnectionProvider>>& connectionProviders,
+               const std::vector<std::shared_ptr<ConnectionHandler>>& connectionHandlers)
+    : m_status(STATUS_CREATED)
+    , m_connectionProviders(connectionProviders)
+    , m_connectionHandlers(connectionHandlers)
+    , m_threaded(false)
+{
+  if(m_connectionProviders.empty()) {
+    throw std::runtime_error("[oatpp::network::Server::Server()]: Error. No connection providers specified.");
+  }
+  if(m_connectionHandlers.size() != 1 && m_connectionHandlers.size() != m_connectionProviders.size()) {
+    throw std::runtime_error("[oatpp::network::Server::Server()]: Error. "
+                             "Number of connection handlers should be either 1 or equal to the number of connection providers.");
+  }
+}
+
+void Server::acceptorLoop(v_int32 acceptorIndex) {
+
+  const auto& connectionProvider = m_connectionProviders[acceptorIndex];
+  const auto& connectionHandler = m_connectionHandlers.size() == 1 ? m_connectionHandlers[0] : m_connectionHandlers[acceptorIndex];
+  std::shared_ptr<const std::unordered_map<oatpp::String, oatpp::String>> params;
+
+  while (getStatus() == STATUS_RUNNING) {
+
+    auto connectionHandle = connectionProvider->get();
+
+    if (connectionHandle) {
+      if (getStatus() == STATUS_RUNNING) {
+        connectionHandler->handleConnection(connectionHandle, params /* null params */);
+      } else {
+        OATPP_LOGD("[oatpp::network::server::mainLoop()]", "Error. Server already stopped - closing connection...");
+      }
+    }
+  }
+
+}
+
+void Server::startAdditionalAcceptors(std::vector<std::thread>& threads) {
+  for(v_int32 i = 1; i < (v_int32) m_connectionProviders.size(); i ++) {
+    threads.push_back(std::thread(&Server::acceptorLoop, this, i));
+  }
+}
+
 // This isn't implemented as static since threading is dropped and therefore static isn't needed anymore.
 void Server::conditionalMainLoop() {
 
   setStatus(STATUS_STARTING, STATUS_RUNNING);
   std::shared_ptr<const std::unordered_map<oatpp::String, oatpp::String>> params;
 
+  /* Only the first acceptor checks the condition. Other acceptors run until the server is stopped */
+  std::vector<std::thread> acceptors;
+  startAdditionalAcceptors(acceptors);
+
   while (getStatus() == STATUS_RUNNING) {
 
     if (m_condition()) {
 
-      auto connectionHandle = m_connectionProvider->get();
+      auto connectionHandle = m_connectionProviders[0]->get();
 
       if (connectionHandle.object) {
         if (getStatus() == STATUS_RUNNING) {
           if (m_condition()) {
-            m_connectionHandler->handleConnection(connectionHandle, params /* null params */);
+            m_connectionHandlers[0]->handleConnection(connectionHandle, params /* null params */);
           } else {
             setStatus(STATUS_STOPPING);
           }
@@ -70,25 +117,25 @@ void Server::conditionalMainLoop() {
       setStatus(STATUS_STOPPING);
     }
   }
+
+  for(auto& acceptor : acceptors) {
+    acceptor.join();
+  }
+
   setStatus(STATUS_DONE);
 }
 
 void Server::mainLoop(Server *instance) {
 
   instance->setStatus(STATUS_STARTING, STATUS_RUNNING);
-  std::shared_ptr<const std::unordered_map<oatpp::String, oatpp::String>> params;
 
-  while (instance->getStatus() == STATUS_RUNNING) {
+  std::vector<std::thread> acceptors;
+  instance->startAdditionalAcceptors(acceptors);
 
-    auto connectionHandle = instance->m_connectionProvider->get();
+  instance->acceptorLoop(0);
 
-    if (connectionHandle) {
-      if (instance->getStatus() == STATUS_RUNNING) {
-        instance->m_connectionHandler->handleConnection(connectionHandle, params /* null params */);
-      } else {
-        OATPP_LOGD("[oatpp::network::server::mainLoop()]", "Error. Server already stopped - closing connection...");
-      }
-    }
+  for(auto& acceptor : acceptors) {
+    acceptor.join();
   }
 
   instance->setStatus(STATUS_DONE);
@@ -167,6 +214,10 @@ v_int32 Server::getStatus() {
   return m_status.load();
 }
 
+v_int32 Server::getAcceptorsCount() const {
+  return (v_int32) m_connectionProviders.size();
+}
+
 Server::~Server() {
   stop();
 }
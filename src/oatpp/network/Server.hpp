@@ -36,18 +36,24 @@
 #include <atomic>
 #include <thread>
 #include <functional>
+#include <vector>
 
 namespace oatpp { namespace network {
 
 /**
  * Server calls &id:oatpp::network::ConnectionProvider::get; in the loop and passes obtained Connection
- * to &id:oatpp::network::ConnectionHandler;.
+ * to &id:oatpp::network::ConnectionHandler;. <br>
+ * Server may have multiple acceptors - pairs of connection provider and connection handler - each served by its own thread.
+ * Use it together with `SO_REUSEPORT` providers (see &id:oatpp::network::tcp::server::ConnectionProvider::Config;)
+ * to let the kernel balance new connections between acceptors.
  */
 class Server : public base::Countable {
 private:
 
   static void mainLoop(Server *instance);
   void conditionalMainLoop();
+  void acceptorLoop(v_int32 acceptorIndex);
+  void startAdditionalAcceptors(std::vector<std::thread>& threads);
 
   bool setStatus(v_int32 expectedStatus, v_int32 newStatus);
   void setStatus(v_int32 status);
@@ -59,8 +65,8 @@ private:
   std::thread m_thread;
   std::mutex m_mutex;
 
-  std::shared_ptr<ConnectionProvider> m_connectionProvider;
-  std::shared_ptr<ConnectionHandler> m_connectionHandler;
+  std::vector<std::shared_ptr<ConnectionProvider>> m_connectionProviders;
+  std::vector<std::shared_ptr<ConnectionHandler>> m_connectionHandlers;
 
   bool m_threaded;
   
@@ -74,6 +80,16 @@ public:
   Server(const std::shared_ptr<ConnectionProvider>& connectionProvider,
          const std::shared_ptr<ConnectionHandler>& connectionHandler);
 
+  /**
+   * Constructor. Create server with multiple acceptors. <br>
+   * Each connection provider is served by its own thread.
+   * @param connectionProviders - &id:oatpp::network::ConnectionProvider;s - one per acceptor.
+   * @param connectionHandlers - &id:oatpp::network::ConnectionHandler;s. Either one handler shared by all acceptors,
+   * or one handler per acceptor (ex.: to pin each acceptor to its own async executor).
+   */
+  Server(const std::vector<std::shared_ptr<ConnectionProvider>>& connectionProviders,
+         const std::vector<std::shared_ptr<ConnectionHandler>>& connectionHandlers);
+
   virtual ~Server();
 
  public:
@@ -155,6 +171,12 @@ public:
    */
   v_int32 getStatus();
 
+  /**
+   * Get number of acceptors.
+   * @return
+   */
+  v_int32 getAcceptorsCount() const;
+
 };
 
 }}
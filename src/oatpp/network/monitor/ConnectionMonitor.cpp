@@ -81,6 +81,13 @@ v_io_size ConnectionMonitor::ConnectionProxy::write(const void *data, v_buff_siz
   return res;
 }
 
+v_io_size ConnectionMonitor::ConnectionProxy::writev(const data::stream::IOVector* vectors, v_buff_size count, async::Action& action) {
+  auto res = m_connectionHandle.object->writev(vectors, count, action);
+  std::lock_guard<std::mutex> lock(m_statsMutex);
+  m_monitor->onConnectionWrite(m_stats, res);
+  return res;
+}
+
 void ConnectionMonitor::ConnectionProxy::setInputStreamIOMode(data::stream::IOMode ioMode) {
   m_connectionHandle.object->setInputStreamIOMode(ioMode);
 }
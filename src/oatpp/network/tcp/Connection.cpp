@@ -30,8 +30,16 @@
 #else
   #include <unistd.h>
   #include <sys/socket.h>
+  #include <sys/uio.h>
 #endif
 
+#if defined(__linux__)
+  #include <sys/sendfile.h>
+  #include <pthread.h>
+  #include <signal.h>
+#endif
+
+#include <cstring>
 #include <thread>
 #include <chrono>
 #include <fcntl.h>
@@ -52,6 +60,7 @@ Connection::Connection(v_io_handle handle)
   // in Windows, there is no reliable method to get if a socket is blocking or not.
   // Eevery socket is created blocking in Windows so we assume this state and pray.
 
+  m_mode = data::stream::ASYNCHRONOUS; // so that setStreamIOMode() doesn't skip the call
   setStreamIOMode(data::stream::BLOCKING);
 
 #else
@@ -72,10 +81,56 @@ Connection::Connection(v_io_handle handle)
 
 }
 
+Connection::Connection(v_io_handle handle, data::stream::IOMode ioMode)
+  : m_handle(handle)
+  , m_mode(ioMode)
+{}
+
 Connection::~Connection(){
   close();
 }
 
+v_io_size Connection::handleWriteError(async::Action& action) {
+
+#if defined(WIN32) || defined(_WIN32)
+
+  auto e = WSAGetLastError();
+
+  if(e == WSAEWOULDBLOCK){
+    if(m_mode == data::stream::ASYNCHRONOUS) {
+      action = oatpp::async::Action::createIOWaitAction(m_handle, oatpp::async::Action::IOEventType::IO_EVENT_WRITE);
+    }
+    return IOError::RETRY_WRITE; // For async io. In case socket is non-blocking
+  } else if(e == WSAEINTR) {
+    return IOError::RETRY_WRITE;
+  } else if(e == WSAECONNRESET) {
+    return IOError::BROKEN_PIPE;
+  } else {
+    //OATPP_LOGD("Connection", "write errno=%d", e);
+    return IOError::BROKEN_PIPE; // Consider all other errors as a broken pipe.
+  }
+
+#else
+
+  auto e = errno;
+  if(e == EAGAIN || e == EWOULDBLOCK){
+    if(m_mode == data::stream::ASYNCHRONOUS) {
+      action = oatpp::async::Action::createIOWaitAction(m_handle, oatpp::async::Action::IOEventType::IO_EVENT_WRITE);
+    }
+    return IOError::RETRY_WRITE; // For async io. In case socket is non-blocking
+  } else if(e == EINTR) {
+    return IOError::RETRY_WRITE;
+  } else if(e == EPIPE) {
+    return IOError::BROKEN_PIPE;
+  } else {
+    //OATPP_LOGD("Connection", "write errno=%d", e);
+    return IOError::BROKEN_PIPE; // Consider all other errors as a broken pipe.
+  }
+
+#endif
+
+}
+
 v_io_size Connection::write(const void *buff, v_buff_size count, async::Action& action){
 
 #if defined(WIN32) || defined(_WIN32)
@@ -83,27 +138,65 @@ v_io_size Connection::write(const void *buff, v_buff_size count, async::Action&
   auto result = ::send(m_handle, (const char*) buff, (int)count, 0);
 
   if(result == SOCKET_ERROR) {
+    return handleWriteError(action);
+  }
+  return result;
 
-    auto e = WSAGetLastError();
+#else
 
-    if(e == WSAEWOULDBLOCK){
-      if(m_mode == data::stream::ASYNCHRONOUS) {
-        action = oatpp::async::Action::createIOWaitAction(m_handle, oatpp::async::Action::IOEventType::IO_EVENT_WRITE);
-      }
-      return IOError::RETRY_WRITE; // For async io. In case socket is non-blocking
-    } else if(e == WSAEINTR) {
-      return IOError::RETRY_WRITE;
-    } else if(e == WSAECONNRESET) {
-      return IOError::BROKEN_PIPE;
-    } else {
-      //OATPP_LOGD("Connection", "write errno=%d", e);
-      return IOError::BROKEN_PIPE; // Consider all other errors as a broken pipe.
-    }
+  errno = 0;
+  v_int32 flags = 0;
+
+#ifdef MSG_NOSIGNAL
+  flags |= MSG_NOSIGNAL;
+#endif
+
+  auto result = ::send(m_handle, buff, (size_t)count, flags);
+
+  if(result < 0) {
+    return handleWriteError(action);
   }
   return result;
 
+#endif
+
+}
+
+v_io_size Connection::writev(const data::stream::IOVector* vectors, v_buff_size count, async::Action& action) {
+
+  if(count > MAX_WRITE_VECTORS) {
+    count = MAX_WRITE_VECTORS;
+  }
+
+#if defined(WIN32) || defined(_WIN32)
+
+  WSABUF buffers[MAX_WRITE_VECTORS];
+  for(v_buff_size i = 0; i < count; i ++) {
+    buffers[i].buf = (CHAR*) vectors[i].data;
+    buffers[i].len = (ULONG) vectors[i].size;
+  }
+
+  DWORD sent = 0;
+  auto result = ::WSASend(m_handle, buffers, (DWORD) count, &sent, 0, nullptr, nullptr);
+
+  if(result == SOCKET_ERROR) {
+    return handleWriteError(action);
+  }
+  return (v_io_size) sent;
+
 #else
 
+  struct iovec buffers[MAX_WRITE_VECTORS];
+  for(v_buff_size i = 0; i < count; i ++) {
+    buffers[i].iov_base = (void*) vectors[i].data;
+    buffers[i].iov_len = (size_t) vectors[i].size;
+  }
+
+  struct msghdr message;
+  std::memset(&message, 0, sizeof(message));
+  message.msg_iov = buffers;
+  message.msg_iovlen = (decltype(message.msg_iovlen)) count;
+
   errno = 0;
   v_int32 flags = 0;
 
@@ -111,23 +204,10 @@ v_io_size Connection::write(const void *buff, v_buff_size count, async::Action&
   flags |= MSG_NOSIGNAL;
 #endif
 
-  auto result = ::send(m_handle, buff, (size_t)count, flags);
+  auto result = ::sendmsg(m_handle, &message, flags);
 
   if(result < 0) {
-    auto e = errno;
-    if(e == EAGAIN || e == EWOULDBLOCK){
-      if(m_mode == data::stream::ASYNCHRONOUS) {
-        action = oatpp::async::Action::createIOWaitAction(m_handle, oatpp::async::Action::IOEventType::IO_EVENT_WRITE);
-      }
-      return IOError::RETRY_WRITE; // For async io. In case socket is non-blocking
-    } else if(e == EINTR) {
-      return IOError::RETRY_WRITE;
-    } else if(e == EPIPE) {
-      return IOError::BROKEN_PIPE;
-    } else {
-      //OATPP_LOGD("Connection", "write errno=%d", e);
-      return IOError::BROKEN_PIPE; // Consider all other errors as a broken pipe.
-    }
+    return handleWriteError(action);
   }
   return result;
 
@@ -189,9 +269,79 @@ v_io_size Connection::read(void *buff, v_buff_size count, async::Action& action)
 
 }
 
+bool Connection::isSendFileSupported() {
+#if defined(__linux__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+v_io_size Connection::sendFile(int fileDescriptor, v_int64 offset, v_buff_size count, async::Action& action) {
+
+#if defined(__linux__)
+
+  /* Linux transfers at most 0x7ffff000 bytes per call */
+  if(count > 0x7ffff000) {
+    count = 0x7ffff000;
+  }
+
+  /*
+   * sendfile(2) has no MSG_NOSIGNAL equivalent - EPIPE raises SIGPIPE which kills the process by default.
+   * Block SIGPIPE for the calling thread and consume the signal raised by this call.
+   */
+  sigset_t pipeSet;
+  sigset_t oldSet;
+  sigemptyset(&pipeSet);
+  sigaddset(&pipeSet, SIGPIPE);
+  pthread_sigmask(SIG_BLOCK, &pipeSet, &oldSet);
+
+  sigset_t pendingSet;
+  sigemptyset(&pendingSet);
+  sigpending(&pendingSet);
+  bool sigPipePending = sigismember(&pendingSet, SIGPIPE) == 1;
+
+  errno = 0;
+  off_t fileOffset = (off_t) offset;
+  auto result = ::sendfile(m_handle, fileDescriptor, &fileOffset, (size_t) count);
+  auto error = errno;
+
+  if(result < 0 && error == EPIPE) {
+    if(!sigPipePending) {
+      struct timespec zeroTimeout = {0, 0};
+      sigtimedwait(&pipeSet, nullptr, &zeroTimeout);
+    }
+    pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
+    return IOError::BROKEN_PIPE;
+  }
+
+  pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
+
+  if(result < 0) {
+    errno = error;
+    return handleWriteError(action);
+  }
+  return result;
+
+#else
+
+  (void) fileDescriptor;
+  (void) offset;
+  (void) count;
+  (void) action;
+  return IOError::BROKEN_PIPE;
+
+#endif
+
+}
+
 #if defined(WIN32) || defined(_WIN32)
 void Connection::setStreamIOMode(oatpp::data::stream::IOMode ioMode) {
 
+  if(m_mode == ioMode) {
+    return;
+  }
+
   u_long flags;
 
   switch(ioMode) {
@@ -215,6 +365,10 @@ void Connection::setStreamIOMode(oatpp::data::stream::IOMode ioMode) {
 #else
 void Connection::setStreamIOMode(oatpp::data::stream::IOMode ioMode) {
 
+  if(m_mode == ioMode) {
+    return;
+  }
+
   auto flags = fcntl(m_handle, F_GETFL);
   if (flags < 0) {
     throw std::runtime_error("[oatpp::network::tcp::Connection::setStreamIOMode()]: Error. Can't get socket flags.");
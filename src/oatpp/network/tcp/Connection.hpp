@@ -40,12 +40,28 @@ private:
   data::stream::IOMode m_mode;
 private:
   void setStreamIOMode(oatpp::data::stream::IOMode ioMode);
+  v_io_size handleWriteError(async::Action& action);
+public:
+
+  /**
+   * Max number of vectors put out by a single &l:Connection::writev (); call.
+   */
+  static constexpr v_buff_size MAX_WRITE_VECTORS = 64;
+
 public:
   /**
    * Constructor.
    * @param handle - file descriptor (socket handle). See &id:oatpp::v_io_handle;.
    */
   Connection(v_io_handle handle);
+
+  /**
+   * Constructor. Use when the I/O mode of the handle is already known - ex.: socket accepted with `accept4()`. <br>
+   * Saves the syscall needed to query socket flags.
+   * @param handle - file descriptor (socket handle). See &id:oatpp::v_io_handle;.
+   * @param ioMode - current I/O mode of the handle. &id:oatpp::data::stream::IOMode;.
+   */
+  Connection(v_io_handle handle, data::stream::IOMode ioMode);
 public:
 
   /**
@@ -64,6 +80,37 @@ public:
    */
   v_io_size write(const void *buff, v_buff_size count, async::Action& action) override;
 
+  /**
+   * Implementation of &id:oatpp::data::stream::WriteCallback::writev;. <br>
+   * Puts all vectors out with a single `sendmsg` (`WSASend` on Windows) call.
+   * At most &l:Connection::MAX_WRITE_VECTORS; vectors are written per call.
+   * @param vectors - array of &id:oatpp::data::stream::IOVector;.
+   * @param count - count of vectors in array.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual amount of bytes written. See &id:oatpp::v_io_size;.
+   */
+  v_io_size writev(const data::stream::IOVector* vectors, v_buff_size count, async::Action& action) override;
+
+  /**
+   * Check if &l:Connection::sendFile (); is supported on this platform.
+   * @return - `true` if supported.
+   */
+  static bool isSendFileSupported();
+
+  /**
+   * Send data of the file directly to the socket without copying it to user space (`sendfile(2)`). <br>
+   * File position of the `fileDescriptor` is not changed.
+   * *Note:* check &l:Connection::isSendFileSupported (); first. On unsupported platforms this method returns &id:oatpp::IOError::BROKEN_PIPE;.
+   * @param fileDescriptor - descriptor of the file opened for reading.
+   * @param offset - offset in the file to start from.
+   * @param count - max number of bytes to send.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual amount of bytes sent. 0 - end of file. See &id:oatpp::v_io_size;.
+   */
+  v_io_size sendFile(int fileDescriptor, v_int64 offset, v_buff_size count, async::Action& action);
+
   /**
    * Implementation of &id:oatpp::data::stream::IOStream::read;.
    * @param buff - buffer to read data to.
@@ -82,6 +82,13 @@ ConnectionProvider::ExtendedConnection::ExtendedConnection(v_io_handle handle, d
   , m_context(data::stream::StreamType::STREAM_INFINITE, std::forward<data::stream::Context::Properties>(properties))
 {}
 
+ConnectionProvider::ExtendedConnection::ExtendedConnection(v_io_handle handle,
+                                                           data::stream::IOMode ioMode,
+                                                           data::stream::Context::Properties&& properties)
+  : Connection(handle, ioMode)
+  , m_context(data::stream::StreamType::STREAM_INFINITE, std::forward<data::stream::Context::Properties>(properties))
+{}
+
 oatpp::data::stream::Context& ConnectionProvider::ExtendedConnection::getOutputStreamContext() {
   return m_context;
 }
@@ -122,11 +129,25 @@ void ConnectionProvider::ConnectionInvalidator::invalidate(const std::shared_ptr
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConnectionProvider
 
+namespace {
+
+  ConnectionProvider::Config createConfig(bool useExtendedConnections) {
+    ConnectionProvider::Config config;
+    config.useExtendedConnections = useExtendedConnections;
+    return config;
+  }
+
+}
+
 ConnectionProvider::ConnectionProvider(const network::Address& address, bool useExtendedConnections)
+  : ConnectionProvider(address, createConfig(useExtendedConnections))
+{}
+
+ConnectionProvider::ConnectionProvider(const network::Address& address, const Config& config)
         : m_invalidator(std::make_shared<ConnectionInvalidator>())
         , m_address(address)
+        , m_config(config)
         , m_closed(false)
-        , m_useExtendedConnections(useExtendedConnections)
 {
   setProperty(PROPERTY_HOST, m_address.host);
   setProperty(PROPERTY_PORT, oatpp::utils::conversion::int32ToStr(m_address.port));
@@ -194,6 +215,11 @@ oatpp::v_io_handle ConnectionProvider::instantiateServer(){
         }
       }
 
+      if (m_config.reusePort) {
+        OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+                   "Warning. %s is not supported on this platform", "SO_REUSEPORT");
+      }
+
       if (bind(serverHandle, currResult->ai_addr, (int) currResult->ai_addrlen) != SOCKET_ERROR &&
           listen(serverHandle, SOMAXCONN) != SOCKET_ERROR)
       {
@@ -276,6 +302,18 @@ oatpp::v_io_handle ConnectionProvider::instantiateServer(){
                    "Warning. Failed to set %s for accepting socket: %s", "SO_REUSEADDR", strerror(errno));
       }
 
+      if (m_config.reusePort) {
+#ifdef SO_REUSEPORT
+        if (setsockopt(serverHandle, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(int)) != 0) {
+          OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+                     "Warning. Failed to set %s for accepting socket: %s", "SO_REUSEPORT", strerror(errno));
+        }
+#else
+        OATPP_LOGW("[oatpp::network::tcp::server::ConnectionProvider::instantiateServer()]",
+                   "Warning. %s is not supported on this platform", "SO_REUSEPORT");
+#endif
+      }
+
       if (bind(serverHandle, currResult->ai_addr, (int) currResult->ai_addrlen) == 0 &&
           listen(serverHandle, 10000) == 0)
       {
@@ -341,9 +379,56 @@ bool ConnectionProvider::prepareConnectionHandle(oatpp::v_io_handle handle) {
 
 }
 
+namespace {
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+
+  /*
+   * Accept connection with socket flags set at once.
+   * Connection is then created with known IOMode - no need to query socket flags.
+   */
+  oatpp::v_io_handle acceptConnection(oatpp::v_io_handle serverHandle,
+                                      struct sockaddr* address,
+                                      socklen_t* addressSize,
+                                      data::stream::IOMode ioMode)
+  {
+    int flags = SOCK_CLOEXEC;
+    if(ioMode == data::stream::IOMode::ASYNCHRONOUS) {
+      flags |= SOCK_NONBLOCK;
+    }
+    return accept4(serverHandle, address, addressSize, flags);
+  }
+
+  template<class ConnectionType, typename ... Args>
+  std::shared_ptr<ConnectionType> createConnection(oatpp::v_io_handle handle, data::stream::IOMode ioMode, Args&&... args) {
+    return std::make_shared<ConnectionType>(handle, ioMode, std::forward<Args>(args)...);
+  }
+
+#else
+
+  oatpp::v_io_handle acceptConnection(oatpp::v_io_handle serverHandle,
+                                      struct sockaddr* address,
+                                      socklen_t* addressSize,
+                                      data::stream::IOMode ioMode)
+  {
+    (void) ioMode;
+    return accept(serverHandle, address, addressSize);
+  }
+
+  template<class ConnectionType, typename ... Args>
+  std::shared_ptr<ConnectionType> createConnection(oatpp::v_io_handle handle, data::stream::IOMode ioMode, Args&&... args) {
+    auto connection = std::make_shared<ConnectionType>(handle, std::forward<Args>(args)...);
+    connection->setOutputStreamIOMode(ioMode);
+    return connection;
+  }
+
+#endif
+
+}
+
 provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getDefaultConnection() {
 
-  oatpp::v_io_handle handle = accept(m_serverHandle, nullptr, nullptr);
+  oatpp::v_io_handle handle = acceptConnection(m_serverHandle, nullptr, nullptr, m_config.acceptedConnectionsIOMode);
 
   if(!oatpp::isValidIOHandle(handle)) {
     return nullptr;
@@ -351,7 +436,7 @@ provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getDefaultC
 
   if(prepareConnectionHandle(handle)) {
     return provider::ResourceHandle<data::stream::IOStream>(
-      std::make_shared<Connection>(handle),
+      createConnection<Connection>(handle, m_config.acceptedConnectionsIOMode),
         m_invalidator
     );
   }
@@ -367,7 +452,8 @@ provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getExtended
 
   data::stream::Context::Properties properties;
 
-  oatpp::v_io_handle handle = accept(m_serverHandle, (struct sockaddr*) &clientAddress, &clientAddressSize);
+  oatpp::v_io_handle handle = acceptConnection(m_serverHandle, (struct sockaddr*) &clientAddress, &clientAddressSize,
+                                              m_config.acceptedConnectionsIOMode);
 
   if(!oatpp::isValidIOHandle(handle)) {
     return nullptr;
@@ -408,7 +494,7 @@ provider::ResourceHandle<data::stream::IOStream> ConnectionProvider::getExtended
 
   if(prepareConnectionHandle(handle)) {
     return provider::ResourceHandle<data::stream::IOStream>(
-      std::make_shared<ExtendedConnection>(handle, std::move(properties)),
+      createConnection<ExtendedConnection>(handle, m_config.acceptedConnectionsIOMode, std::move(properties)),
       m_invalidator
     );
   }
@@ -437,7 +523,7 @@ provider::ResourceHandle<oatpp::data::stream::IOStream> ConnectionProvider::get(
 
   }
 
-  if(m_useExtendedConnections) {
+  if(m_config.useExtendedConnections) {
     return getExtendedConnection();
   }
 
@@ -69,6 +69,14 @@ public:
      */
     ExtendedConnection(v_io_handle handle, data::stream::Context::Properties&& properties);
 
+    /**
+     * Constructor.
+     * @param handle - &id:oatpp::v_io_handle;.
+     * @param ioMode - current I/O mode of the handle. &id:oatpp::data::stream::IOMode;.
+     * @param properties - &id:oatpp::data::stream::Context::Properties;.
+     */
+    ExtendedConnection(v_io_handle handle, data::stream::IOMode ioMode, data::stream::Context::Properties&& properties);
+
     /**
      * Get output stream context.
      * @return - &id:oatpp::data::stream::Context;.
@@ -83,12 +91,42 @@ public:
 
   };
 
+public:
+
+  /**
+   * Connection provider config.
+   */
+  struct Config {
+
+    /**
+     * Set `true` to use &l:ConnectionProvider::ExtendedConnection;.
+     * `false` to use &id:oatpp::network::tcp::Connection;.
+     */
+    bool useExtendedConnections = false;
+
+    /**
+     * Set `SO_REUSEPORT` on the accepting socket, so that multiple providers (ex.: one per acceptor thread)
+     * can listen on the same port and the kernel will balance incoming connections between them. <br>
+     * Has no effect on platforms without `SO_REUSEPORT`.
+     */
+    bool reusePort = false;
+
+    /**
+     * I/O mode of accepted connections. <br>
+     * On Linux connections are accepted with `accept4()` directly in this mode so that
+     * connection handler doesn't have to change socket flags. <br>
+     * Use &id:oatpp::data::stream::IOMode::ASYNCHRONOUS; with asynchronous connection handlers.
+     */
+    data::stream::IOMode acceptedConnectionsIOMode = data::stream::IOMode::BLOCKING;
+
+  };
+
 private:
   std::shared_ptr<ConnectionInvalidator> m_invalidator;
   network::Address m_address;
+  Config m_config;
   std::atomic<bool> m_closed;
   oatpp::v_io_handle m_serverHandle;
-  bool m_useExtendedConnections;
 private:
   oatpp::v_io_handle instantiateServer();
 private:
@@ -105,6 +143,13 @@ public:
    */
   ConnectionProvider(const network::Address& address, bool useExtendedConnections = false);
 
+  /**
+   * Constructor.
+   * @param address - &id:oatpp::network::Address;.
+   * @param config - &l:ConnectionProvider::Config;.
+   */
+  ConnectionProvider(const network::Address& address, const Config& config);
+
 public:
 
   /**
@@ -118,6 +163,16 @@ public:
     return std::make_shared<ConnectionProvider>(address, useExtendedConnections);
   }
 
+  /**
+   * Create shared ConnectionProvider.
+   * @param address - &id:oatpp::network::Address;.
+   * @param config - &l:ConnectionProvider::Config;.
+   * @return - `std::shared_ptr` to ConnectionProvider.
+   */
+  static std::shared_ptr<ConnectionProvider> createShared(const network::Address& address, const Config& config){
+    return std::make_shared<ConnectionProvider>(address, config);
+  }
+
   /**
    * Virtual destructor.
    */
@@ -0,0 +1,333 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "Utils.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace oatpp { namespace parser { namespace cbor {
+
+v_buff_size Utils::encodeHead(p_char8 buffer, v_uint8 majorType, v_uint64 argument) {
+
+  const v_uint8 type = (v_uint8) (majorType << 5);
+
+  if(argument < 24) {
+    buffer[0] = (v_char8) (type | argument);
+    return 1;
+  }
+
+  v_buff_size size;
+  if(argument <= 0xff) {
+    buffer[0] = (v_char8) (type | 24);
+    size = 1;
+  } else if(argument <= 0xffff) {
+    buffer[0] = (v_char8) (type | 25);
+    size = 2;
+  } else if(argument <= 0xffffffff) {
+    buffer[0] = (v_char8) (type | 26);
+    size = 4;
+  } else {
+    buffer[0] = (v_char8) (type | 27);
+    size = 8;
+  }
+
+  for(v_buff_size i = size; i > 0; i --) {
+    buffer[i] = (v_char8) (argument & 0xff);
+    argument >>= 8;
+  }
+
+  return size + 1;
+
+}
+
+void Utils::writeHead(data::stream::ConsistentOutputStream* stream, v_uint8 majorType, v_uint64 argument) {
+  v_char8 buffer[9];
+  stream->writeSimple(buffer, encodeHead(buffer, majorType, argument));
+}
+
+void Utils::writeTextString(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size) {
+  writeHead(stream, MAJOR_TYPE_TEXT_STRING, (v_uint64) size);
+  stream->writeSimple(data, size);
+}
+
+void Utils::writeFloat64(data::stream::ConsistentOutputStream* stream, v_float64 value) {
+
+  if(std::isnan(value) || std::isinf(value) ||
+     (std::fabs(value) <= std::numeric_limits<v_float32>::max() && (v_float64) (v_float32) value == value))
+  {
+    writeFloat32(stream, (v_float32) value);
+    return;
+  }
+
+  v_uint64 bits;
+  std::memcpy(&bits, &value, 8);
+
+  v_char8 buffer[9];
+  buffer[0] = BYTE_FLOAT64;
+  for(v_int32 i = 8; i > 0; i --) {
+    buffer[i] = (v_char8) (bits & 0xff);
+    bits >>= 8;
+  }
+  stream->writeSimple(buffer, 9);
+
+}
+
+void Utils::writeFloat32(data::stream::ConsistentOutputStream* stream, v_float32 value) {
+
+  v_uint32 bits;
+  std::memcpy(&bits, &value, 4);
+
+  v_char8 buffer[5];
+  buffer[0] = BYTE_FLOAT32;
+  for(v_int32 i = 4; i > 0; i --) {
+    buffer[i] = (v_char8) (bits & 0xff);
+    bits >>= 8;
+  }
+  stream->writeSimple(buffer, 5);
+
+}
+
+bool Utils::readHead(parser::Caret& caret, Head& head) {
+
+  if(caret.getPosition() >= caret.getDataSize()) {
+    caret.setError("[oatpp::parser::cbor::Utils::readHead()]: Error. Unexpected end of data.", ERROR_CODE_UNEXPECTED_END);
+    return false;
+  }
+
+  const v_uint8 initialByte = (v_uint8) *caret.getCurrData();
+  head.majorType = initialByte >> 5;
+  head.additional = initialByte & 0x1f;
+
+  if(head.additional < 24) {
+    head.argument = head.additional;
+    caret.inc();
+    return true;
+  }
+
+  if(head.additional == ADDITIONAL_INDEFINITE) {
+    if(head.majorType == MAJOR_TYPE_UNSIGNED_INT || head.majorType == MAJOR_TYPE_NEGATIVE_INT || head.majorType == MAJOR_TYPE_TAG) {
+      caret.setError("[oatpp::parser::cbor::Utils::readHead()]: Error. Indefinite length is not allowed for this major type.", ERROR_CODE_INVALID_HEAD);
+      return false;
+    }
+    head.argument = 0;
+    caret.inc();
+    return true;
+  }
+
+  if(head.additional > 27) {
+    caret.setError("[oatpp::parser::cbor::Utils::readHead()]: Error. Reserved additional information value.", ERROR_CODE_INVALID_HEAD);
+    return false;
+  }
+
+  const v_buff_size size = (v_buff_size) 1 << (head.additional - 24);
+  if(caret.getDataSize() - caret.getPosition() < size + 1) {
+    caret.setError("[oatpp::parser::cbor::Utils::readHead()]: Error. Unexpected end of data.", ERROR_CODE_UNEXPECTED_END);
+    return false;
+  }
+
+  auto data = (const v_uint8*) caret.getCurrData();
+  head.argument = 0;
+  for(v_buff_size i = 1; i <= size; i ++) {
+    head.argument = (head.argument << 8) | data[i];
+  }
+
+  caret.inc(size + 1);
+  return true;
+
+}
+
+bool Utils::skipBreak(parser::Caret& caret) {
+  if(caret.getPosition() < caret.getDataSize() && (v_uint8) *caret.getCurrData() == BYTE_BREAK) {
+    caret.inc();
+    return true;
+  }
+  return false;
+}
+
+bool Utils::skipNull(parser::Caret& caret) {
+  if(caret.getPosition() < caret.getDataSize()) {
+    const v_uint8 b = (v_uint8) *caret.getCurrData();
+    if(b == BYTE_NULL || b == BYTE_UNDEFINED) {
+      caret.inc();
+      return true;
+    }
+  }
+  return false;
+}
+
+void Utils::skipTags(parser::Caret& caret) {
+  while(caret.getPosition() < caret.getDataSize() && ((v_uint8) *caret.getCurrData() >> 5) == MAJOR_TYPE_TAG) {
+    Head head;
+    if(!readHead(caret, head)) {
+      return;
+    }
+  }
+}
+
+bool Utils::skipValue(parser::Caret& caret, v_int32 level) {
+
+  if(level > MAX_NESTING_LEVEL) {
+    caret.setError("[oatpp::parser::cbor::Utils::skipValue()]: Error. Nesting is too deep.", ERROR_CODE_NESTING_TOO_DEEP);
+    return false;
+  }
+
+  Head head;
+  if(!readHead(caret, head)) {
+    return false;
+  }
+
+  switch(head.majorType) {
+
+    case MAJOR_TYPE_UNSIGNED_INT:
+    case MAJOR_TYPE_NEGATIVE_INT:
+      return true;
+
+    case MAJOR_TYPE_BYTE_STRING:
+    case MAJOR_TYPE_TEXT_STRING: {
+      if(head.isIndefinite()) {
+        while(!skipBreak(caret)) {
+          if(!skipValue(caret, level + 1)) return false;
+        }
+        return true;
+      }
+      if(head.argument > (v_uint64) (caret.getDataSize() - caret.getPosition())) {
+        caret.setError("[oatpp::parser::cbor::Utils::skipValue()]: Error. Unexpected end of data.", ERROR_CODE_UNEXPECTED_END);
+        return false;
+      }
+      caret.inc((v_buff_size) head.argument);
+      return true;
+    }
+
+    case MAJOR_TYPE_ARRAY:
+    case MAJOR_TYPE_MAP: {
+      const v_uint64 multiplier = head.majorType == MAJOR_TYPE_MAP ? 2 : 1;
+      if(head.isIndefinite()) {
+        while(!skipBreak(caret)) {
+          for(v_uint64 i = 0; i < multiplier; i ++) {
+            if(!skipValue(caret, level + 1)) return false;
+          }
+        }
+        return true;
+      }
+      for(v_uint64 i = 0; i < head.argument; i ++) {
+        for(v_uint64 j = 0; j < multiplier; j ++) {
+          if(!skipValue(caret, level + 1)) return false;
+        }
+      }
+      return true;
+    }
+
+    case MAJOR_TYPE_TAG:
+      return skipValue(caret, level + 1);
+
+    default: // MAJOR_TYPE_SIMPLE
+      if(head.isIndefinite()) {
+        caret.setError("[oatpp::parser::cbor::Utils::skipValue()]: Error. Unexpected 'break'.", ERROR_CODE_INVALID_HEAD);
+        return false;
+      }
+      return true;
+
+  }
+
+}
+
+bool Utils::skipValue(parser::Caret& caret) {
+  return skipValue(caret, 0);
+}
+
+const char* Utils::readString(parser::Caret& caret, const Head& head, std::string& buffer, v_buff_size& size) {
+
+  if(!head.isIndefinite()) {
+    if(head.argument > (v_uint64) (caret.getDataSize() - caret.getPosition())) {
+      caret.setError("[oatpp::parser::cbor::Utils::readString()]: Error. Unexpected end of data.", ERROR_CODE_UNEXPECTED_END);
+      return nullptr;
+    }
+    const char* data = caret.getCurrData();
+    size = (v_buff_size) head.argument;
+    caret.inc(size);
+    return data;
+  }
+
+  buffer.clear();
+  while(!skipBreak(caret)) {
+    Head chunkHead;
+    if(!readHead(caret, chunkHead)) {
+      return nullptr;
+    }
+    if(chunkHead.majorType != head.majorType || chunkHead.isIndefinite()) {
+      caret.setError("[oatpp::parser::cbor::Utils::readString()]: Error. Invalid chunk of indefinite-length string.", ERROR_CODE_INVALID_HEAD);
+      return nullptr;
+    }
+    v_buff_size chunkSize;
+    const char* chunk = readString(caret, chunkHead, buffer, chunkSize);
+    if(chunk == nullptr) {
+      return nullptr;
+    }
+    buffer.append(chunk, chunkSize);
+  }
+
+  size = (v_buff_size) buffer.size();
+  return buffer.data();
+
+}
+
+v_float64 Utils::decodeFloat(const Head& head) {
+
+  switch(head.additional) {
+
+    case 25: {
+      const v_int32 exponent = (v_int32) ((head.argument >> 10) & 0x1f);
+      const v_int32 mantissa = (v_int32) (head.argument & 0x3ff);
+      v_float64 value;
+      if(exponent == 0) {
+        value = std::ldexp((v_float64) mantissa, -24);
+      } else if(exponent != 31) {
+        value = std::ldexp((v_float64) (mantissa + 1024), exponent - 25);
+      } else {
+        value = mantissa == 0 ? std::numeric_limits<v_float64>::infinity() : std::numeric_limits<v_float64>::quiet_NaN();
+      }
+      return (head.argument & 0x8000) ? -value : value;
+    }
+
+    case 26: {
+      const v_uint32 bits = (v_uint32) head.argument;
+      v_float32 value;
+      std::memcpy(&value, &bits, 4);
+      return value;
+    }
+
+    default: {
+      v_float64 value;
+      std::memcpy(&value, &head.argument, 8);
+      return value;
+    }
+
+  }
+
+}
+
+}}}
@@ -0,0 +1,217 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_parser_cbor_Utils_hpp
+#define oatpp_parser_cbor_Utils_hpp
+
+#include "oatpp/core/data/stream/Stream.hpp"
+#include "oatpp/core/parser/Caret.hpp"
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace parser { namespace cbor {
+
+/**
+ * Utility class for CBOR ([RFC 8949](https://www.rfc-editor.org/rfc/rfc8949)) serializer/deserializer.
+ * Used by &id:oatpp::parser::cbor::mapping::Serializer;, &id:oatpp::parser::cbor::mapping::Deserializer;.
+ */
+class Utils {
+public:
+
+  static constexpr v_uint8 MAJOR_TYPE_UNSIGNED_INT = 0;
+  static constexpr v_uint8 MAJOR_TYPE_NEGATIVE_INT = 1;
+  static constexpr v_uint8 MAJOR_TYPE_BYTE_STRING = 2;
+  static constexpr v_uint8 MAJOR_TYPE_TEXT_STRING = 3;
+  static constexpr v_uint8 MAJOR_TYPE_ARRAY = 4;
+  static constexpr v_uint8 MAJOR_TYPE_MAP = 5;
+  static constexpr v_uint8 MAJOR_TYPE_TAG = 6;
+  static constexpr v_uint8 MAJOR_TYPE_SIMPLE = 7;
+
+  static constexpr v_uint8 ADDITIONAL_INDEFINITE = 31;
+
+  static constexpr v_uint8 BYTE_FALSE = 0xf4;
+  static constexpr v_uint8 BYTE_TRUE = 0xf5;
+  static constexpr v_uint8 BYTE_NULL = 0xf6;
+  static constexpr v_uint8 BYTE_UNDEFINED = 0xf7;
+  static constexpr v_uint8 BYTE_FLOAT16 = 0xf9;
+  static constexpr v_uint8 BYTE_FLOAT32 = 0xfa;
+  static constexpr v_uint8 BYTE_FLOAT64 = 0xfb;
+  static constexpr v_uint8 BYTE_BREAK = 0xff;
+
+public:
+
+  /**
+   * ERROR_CODE_UNEXPECTED_END
+   */
+  static constexpr v_int64 ERROR_CODE_UNEXPECTED_END = 1;
+
+  /**
+   * ERROR_CODE_INVALID_HEAD
+   */
+  static constexpr v_int64 ERROR_CODE_INVALID_HEAD = 2;
+
+  /**
+   * ERROR_CODE_NESTING_TOO_DEEP
+   */
+  static constexpr v_int64 ERROR_CODE_NESTING_TOO_DEEP = 3;
+
+  /**
+   * Max nesting level of arrays/maps/tags accepted by &l:Utils::skipValue ();.
+   */
+  static constexpr v_int32 MAX_NESTING_LEVEL = 1024;
+
+public:
+
+  /**
+   * Data item head.
+   */
+  struct Head {
+
+    /**
+     * Major type - one of `MAJOR_TYPE_*`.
+     */
+    v_uint8 majorType;
+
+    /**
+     * Additional information - low 5 bits of the initial byte.
+     */
+    v_uint8 additional;
+
+    /**
+     * Argument - value, length, or count. Raw bits for floats. `0` for indefinite length.
+     */
+    v_uint64 argument;
+
+    /**
+     * Check if the data item has indefinite length.
+     * @return
+     */
+    bool isIndefinite() const {
+      return additional == ADDITIONAL_INDEFINITE;
+    }
+
+  };
+
+private:
+  static bool skipValue(parser::Caret& caret, v_int32 level);
+public:
+
+  /**
+   * Encode data item head to buffer using the shortest form.
+   * @param buffer - buffer of at least 9 bytes.
+   * @param majorType - major type.
+   * @param argument - value, length, or count.
+   * @return - number of bytes written.
+   */
+  static v_buff_size encodeHead(p_char8 buffer, v_uint8 majorType, v_uint64 argument);
+
+  /**
+   * Write data item head to stream using the shortest form.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param majorType - major type.
+   * @param argument - value, length, or count.
+   */
+  static void writeHead(data::stream::ConsistentOutputStream* stream, v_uint8 majorType, v_uint64 argument);
+
+  /**
+   * Write text string (major type 3).
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param data - pointer to UTF-8 data.
+   * @param size - data size.
+   */
+  static void writeTextString(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size);
+
+  /**
+   * Write float64 value. Value is written as float32 if it can be represented as float32 without loss.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param value - value.
+   */
+  static void writeFloat64(data::stream::ConsistentOutputStream* stream, v_float64 value);
+
+  /**
+   * Write float32 value.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param value - value.
+   */
+  static void writeFloat32(data::stream::ConsistentOutputStream* stream, v_float32 value);
+
+  /**
+   * Read data item head and move caret past it. <br>
+   * Sets caret error on failure.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param head - out parameter - &l:Utils::Head;.
+   * @return - `true` on success.
+   */
+  static bool readHead(parser::Caret& caret, Head& head);
+
+  /**
+   * Check if caret is at `break` stop code and skip it if so.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @return - `true` if `break` was skipped.
+   */
+  static bool skipBreak(parser::Caret& caret);
+
+  /**
+   * Check if caret is at `null` or `undefined` and skip it if so.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @return - `true` if `null` was skipped.
+   */
+  static bool skipNull(parser::Caret& caret);
+
+  /**
+   * Skip semantic tags (major type 6) - their content is decoded as a plain data item.
+   * @param caret - &id:oatpp::parser::Caret;.
+   */
+  static void skipTags(parser::Caret& caret);
+
+  /**
+   * Skip whole data item including nested items.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @return - `true` on success.
+   */
+  static bool skipValue(parser::Caret& caret);
+
+  /**
+   * Read text or byte string. Definite-length strings are returned without copying. <br>
+   * Chunks of indefinite-length strings are concatenated into `buffer`.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param head - head of the string - already read by &l:Utils::readHead ();.
+   * @param buffer - buffer for indefinite-length strings.
+   * @param size - out parameter - string size.
+   * @return - pointer to string data or `nullptr` in case of error.
+   */
+  static const char* readString(parser::Caret& caret, const Head& head, std::string& buffer, v_buff_size& size);
+
+  /**
+   * Convert float head (`BYTE_FLOAT16`, `BYTE_FLOAT32`, `BYTE_FLOAT64`) to float64.
+   * @param head - &l:Utils::Head;.
+   * @return - value.
+   */
+  static v_float64 decodeFloat(const Head& head);
+
+};
+
+}}}
+
+#endif /* oatpp_parser_cbor_Utils_hpp */
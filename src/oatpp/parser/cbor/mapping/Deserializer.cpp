@@ -0,0 +1,529 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "Deserializer.hpp"
+
+#include "oatpp/core/data/mapping/type/Any.hpp"
+
+namespace oatpp { namespace parser { namespace cbor { namespace mapping {
+
+Deserializer::Deserializer(const std::shared_ptr<Config>& config)
+  : m_config(config)
+{
+
+  m_methods.resize(data::mapping::type::ClassId::getClassCount(), nullptr);
+
+  setDeserializerMethod(data::mapping::type::__class::String::CLASS_ID, &Deserializer::deserializeString);
+  setDeserializerMethod(data::mapping::type::__class::Any::CLASS_ID, &Deserializer::deserializeAny);
+
+  setDeserializerMethod(data::mapping::type::__class::Int8::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int8>);
+  setDeserializerMethod(data::mapping::type::__class::UInt8::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt8>);
+
+  setDeserializerMethod(data::mapping::type::__class::Int16::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int16>);
+  setDeserializerMethod(data::mapping::type::__class::UInt16::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt16>);
+
+  setDeserializerMethod(data::mapping::type::__class::Int32::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int32>);
+  setDeserializerMethod(data::mapping::type::__class::UInt32::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt32>);
+
+  setDeserializerMethod(data::mapping::type::__class::Int64::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int64>);
+  setDeserializerMethod(data::mapping::type::__class::UInt64::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt64>);
+
+  setDeserializerMethod(data::mapping::type::__class::Float32::CLASS_ID, &Deserializer::deserializeFloat32);
+  setDeserializerMethod(data::mapping::type::__class::Float64::CLASS_ID, &Deserializer::deserializeFloat64);
+  setDeserializerMethod(data::mapping::type::__class::Boolean::CLASS_ID, &Deserializer::deserializeBoolean);
+
+  setDeserializerMethod(data::mapping::type::__class::AbstractObject::CLASS_ID, &Deserializer::deserializeObject);
+  setDeserializerMethod(data::mapping::type::__class::AbstractEnum::CLASS_ID, &Deserializer::deserializeEnum);
+
+  setDeserializerMethod(data::mapping::type::__class::AbstractVector::CLASS_ID, &Deserializer::deserializeCollection);
+  setDeserializerMethod(data::mapping::type::__class::AbstractList::CLASS_ID, &Deserializer::deserializeCollection);
+  setDeserializerMethod(data::mapping::type::__class::AbstractUnorderedSet::CLASS_ID, &Deserializer::deserializeCollection);
+
+  setDeserializerMethod(data::mapping::type::__class::AbstractPairList::CLASS_ID, &Deserializer::deserializeMap);
+  setDeserializerMethod(data::mapping::type::__class::AbstractUnorderedMap::CLASS_ID, &Deserializer::deserializeMap);
+
+}
+
+void Deserializer::setDeserializerMethod(const data::mapping::type::ClassId& classId, DeserializerMethod method) {
+  const v_uint32 id = classId.id;
+  if(id >= m_methods.size()) {
+    m_methods.resize(id + 1, nullptr);
+  }
+  m_methods[id] = method;
+}
+
+bool Deserializer::readInt(parser::Caret& caret, v_int64& value) {
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return false;
+  }
+  switch(head.majorType) {
+    case Utils::MAJOR_TYPE_UNSIGNED_INT:
+      value = (v_int64) head.argument;
+      return true;
+    case Utils::MAJOR_TYPE_NEGATIVE_INT:
+      value = -1 - (v_int64) head.argument;
+      return true;
+    default:
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::readInt()]: Error. Integer expected.", ERROR_CODE_UNEXPECTED_TYPE);
+      return false;
+  }
+}
+
+bool Deserializer::readUInt(parser::Caret& caret, v_uint64& value) {
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return false;
+  }
+  if(head.majorType != Utils::MAJOR_TYPE_UNSIGNED_INT) {
+    caret.setError("[oatpp::parser::cbor::mapping::Deserializer::readUInt()]: Error. Unsigned integer expected.", ERROR_CODE_UNEXPECTED_TYPE);
+    return false;
+  }
+  value = head.argument;
+  return true;
+}
+
+bool Deserializer::readFloat(parser::Caret& caret, v_float64& value) {
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return false;
+  }
+  switch(head.majorType) {
+    case Utils::MAJOR_TYPE_UNSIGNED_INT:
+      value = (v_float64) head.argument;
+      return true;
+    case Utils::MAJOR_TYPE_NEGATIVE_INT:
+      value = -1.0 - (v_float64) head.argument;
+      return true;
+    case Utils::MAJOR_TYPE_SIMPLE:
+      if(head.additional >= 25 && head.additional <= 27) {
+        value = Utils::decodeFloat(head);
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  caret.setError("[oatpp::parser::cbor::mapping::Deserializer::readFloat()]: Error. Number expected.", ERROR_CODE_UNEXPECTED_TYPE);
+  return false;
+}
+
+bool Deserializer::readContainerHead(parser::Caret& caret, v_uint8 majorType, Utils::Head& head) {
+  if(!Utils::readHead(caret, head)) {
+    return false;
+  }
+  if(head.majorType != majorType) {
+    if(majorType == Utils::MAJOR_TYPE_ARRAY) {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::readContainerHead()]: Error. Array expected.", ERROR_CODE_UNEXPECTED_TYPE);
+    } else {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::readContainerHead()]: Error. Map expected.", ERROR_CODE_UNEXPECTED_TYPE);
+    }
+    return false;
+  }
+  return true;
+}
+
+bool Deserializer::hasNextItem(parser::Caret& caret, const Utils::Head& head, v_uint64& index) {
+  if(caret.hasError()) {
+    return false;
+  }
+  if(head.isIndefinite()) {
+    return !Utils::skipBreak(caret);
+  }
+  return index ++ < head.argument;
+}
+
+oatpp::Void Deserializer::deserializeFloat32(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  (void) deserializer;
+  (void) type;
+
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(Float32::Class::getType());
+  }
+
+  v_float64 value;
+  if(!readFloat(caret, value)) {
+    return nullptr;
+  }
+  return Float32((v_float32) value);
+
+}
+
+oatpp::Void Deserializer::deserializeFloat64(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  (void) deserializer;
+  (void) type;
+
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(Float64::Class::getType());
+  }
+
+  v_float64 value;
+  if(!readFloat(caret, value)) {
+    return nullptr;
+  }
+  return Float64(value);
+
+}
+
+oatpp::Void Deserializer::deserializeBoolean(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  (void) deserializer;
+  (void) type;
+
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(Boolean::Class::getType());
+  }
+
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return nullptr;
+  }
+  if(head.majorType != Utils::MAJOR_TYPE_SIMPLE || (head.additional != 20 && head.additional != 21)) {
+    caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeBoolean()]: Error. Boolean expected.", ERROR_CODE_UNEXPECTED_TYPE);
+    return nullptr;
+  }
+  return Boolean(head.additional == 21);
+
+}
+
+oatpp::Void Deserializer::deserializeString(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  (void) deserializer;
+  (void) type;
+
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(String::Class::getType());
+  }
+
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return nullptr;
+  }
+  if(head.majorType != Utils::MAJOR_TYPE_TEXT_STRING && head.majorType != Utils::MAJOR_TYPE_BYTE_STRING) {
+    caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeString()]: Error. String expected.", ERROR_CODE_UNEXPECTED_TYPE);
+    return nullptr;
+  }
+
+  std::string buffer;
+  v_buff_size size;
+  const char* data = Utils::readString(caret, head, buffer, size);
+  if(data == nullptr) {
+    return nullptr;
+  }
+  return oatpp::String(data, size);
+
+}
+
+const data::mapping::type::Type* Deserializer::guessType(parser::Caret& caret) {
+
+  if(caret.getPosition() < caret.getDataSize()) {
+    const v_uint8 initialByte = (v_uint8) *caret.getCurrData();
+    switch (initialByte >> 5) {
+      case Utils::MAJOR_TYPE_UNSIGNED_INT:
+        return UInt64::Class::getType();
+      case Utils::MAJOR_TYPE_NEGATIVE_INT:
+        return Int64::Class::getType();
+      case Utils::MAJOR_TYPE_BYTE_STRING:
+      case Utils::MAJOR_TYPE_TEXT_STRING:
+        return String::Class::getType();
+      case Utils::MAJOR_TYPE_ARRAY:
+        return oatpp::List<Any>::Class::getType();
+      case Utils::MAJOR_TYPE_MAP:
+        return oatpp::Fields<Any>::Class::getType();
+      case Utils::MAJOR_TYPE_SIMPLE:
+        switch (initialByte) {
+          case Utils::BYTE_FALSE:
+          case Utils::BYTE_TRUE:
+            return Boolean::Class::getType();
+          case Utils::BYTE_FLOAT16:
+          case Utils::BYTE_FLOAT32:
+          case Utils::BYTE_FLOAT64:
+            return Float64::Class::getType();
+          default:
+            break;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  caret.setError("[oatpp::parser::cbor::mapping::Deserializer::guessType()]: Error. Can't guess type for oatpp::Any.");
+  return nullptr;
+
+}
+
+oatpp::Void Deserializer::deserializeAny(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+  (void) type;
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(Any::Class::getType());
+  } else {
+    const Type* const fieldType = guessType(caret);
+    if(fieldType != nullptr) {
+      auto fieldValue = deserializer->deserialize(caret, fieldType);
+      auto anyHandle = data::mapping::Arena::allocateShared<data::mapping::type::AnyHandle>(fieldValue.getPtr(), fieldValue.getValueType());
+      return oatpp::Void(anyHandle, Any::Class::getType());
+    }
+  }
+  return oatpp::Void(Any::Class::getType());
+}
+
+oatpp::Void Deserializer::deserializeEnum(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  auto polymorphicDispatcher = static_cast<const data::mapping::type::__class::AbstractEnum::PolymorphicDispatcher*>(
+    type->polymorphicDispatcher
+  );
+
+  data::mapping::type::EnumInterpreterError e = data::mapping::type::EnumInterpreterError::OK;
+  const auto& value = deserializer->deserialize(caret, polymorphicDispatcher->getInterpretationType());
+  if(caret.hasError()) {
+    return nullptr;
+  }
+  const auto& result = polymorphicDispatcher->fromInterpretation(value, e);
+
+  if(e == data::mapping::type::EnumInterpreterError::OK) {
+    return result;
+  }
+
+  switch(e) {
+    case data::mapping::type::EnumInterpreterError::CONSTRAINT_NOT_NULL:
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeEnum()]: Error. Enum constraint violated - 'NotNull'.");
+      break;
+    default:
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeEnum()]: Error. Can't deserialize Enum.");
+  }
+
+  return nullptr;
+
+}
+
+oatpp::Void Deserializer::deserializeCollection(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(type);
+  }
+
+  Utils::Head head;
+  if(!readContainerHead(caret, Utils::MAJOR_TYPE_ARRAY, head)) {
+    return nullptr;
+  }
+
+  auto dispatcher = static_cast<const data::mapping::type::__class::Collection::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  auto collection = dispatcher->createObject();
+  auto itemType = dispatcher->getItemType();
+
+  v_uint64 index = 0;
+  while(hasNextItem(caret, head, index)) {
+    auto item = deserializer->deserialize(caret, itemType);
+    if(caret.hasError()){
+      return nullptr;
+    }
+    dispatcher->addItem(collection, item);
+  }
+
+  if(caret.hasError()) {
+    return nullptr;
+  }
+
+  return collection;
+
+}
+
+oatpp::Void Deserializer::deserializeMap(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(type);
+  }
+
+  auto dispatcher = static_cast<const data::mapping::type::__class::Map::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+
+  auto keyType = dispatcher->getKeyType();
+  if(keyType->classId != oatpp::String::Class::CLASS_ID){
+    throw std::runtime_error("[oatpp::parser::cbor::mapping::Deserializer::deserializeMap()]: Invalid map key. Key should be String");
+  }
+  auto valueType = dispatcher->getValueType();
+
+  Utils::Head head;
+  if(!readContainerHead(caret, Utils::MAJOR_TYPE_MAP, head)) {
+    return nullptr;
+  }
+
+  auto map = dispatcher->createObject();
+  std::string keyBuffer;
+
+  v_uint64 index = 0;
+  while(hasNextItem(caret, head, index)) {
+
+    Utils::Head keyHead;
+    if(!Utils::readHead(caret, keyHead)) {
+      return nullptr;
+    }
+    if(keyHead.majorType != Utils::MAJOR_TYPE_TEXT_STRING) {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeMap()]: Error. Map key - text string expected.", ERROR_CODE_MAP_KEY);
+      return nullptr;
+    }
+    v_buff_size keySize;
+    const char* keyData = Utils::readString(caret, keyHead, keyBuffer, keySize);
+    if(keyData == nullptr) {
+      return nullptr;
+    }
+    oatpp::String key(keyData, keySize);
+
+    auto item = deserializer->deserialize(caret, valueType);
+    if(caret.hasError()){
+      return nullptr;
+    }
+    dispatcher->addItem(map, key, item);
+
+  }
+
+  if(caret.hasError()) {
+    return nullptr;
+  }
+
+  return map;
+
+}
+
+oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(type);
+  }
+
+  Utils::Head head;
+  if(!readContainerHead(caret, Utils::MAJOR_TYPE_MAP, head)) {
+    return nullptr;
+  }
+
+  auto dispatcher = static_cast<const oatpp::data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  auto object = dispatcher->createObject();
+  const auto& fieldsIndex = dispatcher->getProperties()->getNameIndex();
+  v_int32 predictedIndex = 0;
+  std::string keyBuffer;
+
+  std::vector<std::pair<oatpp::BaseObject::Property*, oatpp::String>> polymorphs;
+
+  v_uint64 index = 0;
+  while(hasNextItem(caret, head, index)) {
+
+    Utils::Head keyHead;
+    if(!Utils::readHead(caret, keyHead)) {
+      return nullptr;
+    }
+    if(keyHead.majorType != Utils::MAJOR_TYPE_TEXT_STRING) {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeObject()]: Error. Field name - text string expected.", ERROR_CODE_MAP_KEY);
+      return nullptr;
+    }
+    v_buff_size keySize;
+    const char* keyData = Utils::readString(caret, keyHead, keyBuffer, keySize);
+    if(keyData == nullptr) {
+      return nullptr;
+    }
+
+    /* field names are looked up by raw bytes - no allocations */
+    v_int32 fieldIndex = fieldsIndex.matches(predictedIndex, keyData, keySize) ? predictedIndex : fieldsIndex.findIndex(keyData, keySize);
+
+    if(fieldIndex >= 0) {
+
+      predictedIndex = fieldIndex + 1;
+      auto field = fieldsIndex.getEntry(fieldIndex).property;
+
+      if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
+        auto label = caret.putLabel();
+        if(!Utils::skipValue(caret)) {
+          return nullptr;
+        }
+        polymorphs.emplace_back(field, label.toString()); // store polymorphs for later processing.
+      } else {
+        auto value = deserializer->deserialize(caret, field->type);
+        if(caret.hasError()) {
+          return nullptr;
+        }
+        field->set(static_cast<oatpp::BaseObject*>(object.get()), value);
+      }
+
+    } else if (deserializer->getConfig()->allowUnknownFields) {
+      if(!Utils::skipValue(caret)) {
+        return nullptr;
+      }
+    } else {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeObject()]: Error. Unknown field", ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+      return nullptr;
+    }
+
+  }
+
+  if(caret.hasError()) {
+    return nullptr;
+  }
+
+  for(auto& p : polymorphs) {
+    parser::Caret polyCaret(p.second);
+    auto selectedType = p.first->info.typeSelector->selectType(static_cast<oatpp::BaseObject *>(object.get()));
+    auto value = deserializer->deserialize(polyCaret, selectedType);
+    if(polyCaret.hasError()) {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeObject()]: Error. Can't deserialize polymorphic field.", polyCaret.getErrorCode());
+      return nullptr;
+    }
+    oatpp::Any any(value);
+    p.first->set(static_cast<oatpp::BaseObject *>(object.get()), oatpp::Void(any.getPtr(), p.first->type));
+  }
+
+  return object;
+
+}
+
+oatpp::Void Deserializer::deserialize(parser::Caret& caret, const Type* const type) {
+
+  Utils::skipTags(caret);
+  if(caret.hasError()) {
+    return nullptr;
+  }
+
+  auto id = type->classId.id;
+  auto& method = m_methods[id];
+  if(method) {
+    return (*method)(this, caret, type);
+  } else {
+
+    auto* interpretation = type->findInterpretation(m_config->enabledInterpretations);
+    if(interpretation) {
+      return interpretation->fromInterpretation(deserialize(caret, interpretation->getInterpretationType()));
+    }
+
+    throw std::runtime_error("[oatpp::parser::cbor::mapping::Deserializer::deserialize()]: "
+                             "Error. No deserialize method for type '" + std::string(type->classId.name) + "'");
+  }
+
+}
+
+const std::shared_ptr<Deserializer::Config>& Deserializer::getConfig() {
+  return m_config;
+}
+
+}}}}
@@ -0,0 +1,342 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "Serializer.hpp"
+
+#include "oatpp/core/data/mapping/type/Any.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace parser { namespace cbor { namespace mapping {
+
+Serializer::Serializer(const std::shared_ptr<Config>& config)
+  : m_config(config)
+{
+
+  m_methods.resize(data::mapping::type::ClassId::getClassCount(), nullptr);
+
+  setSerializerMethod(data::mapping::type::__class::String::CLASS_ID, &Serializer::serializeString);
+  setSerializerMethod(data::mapping::type::__class::Any::CLASS_ID, &Serializer::serializeAny);
+
+  setSerializerMethod(data::mapping::type::__class::Int8::CLASS_ID, &Serializer::serializeInt<oatpp::Int8>);
+  setSerializerMethod(data::mapping::type::__class::UInt8::CLASS_ID, &Serializer::serializeUInt<oatpp::UInt8>);
+
+  setSerializerMethod(data::mapping::type::__class::Int16::CLASS_ID, &Serializer::serializeInt<oatpp::Int16>);
+  setSerializerMethod(data::mapping::type::__class::UInt16::CLASS_ID, &Serializer::serializeUInt<oatpp::UInt16>);
+
+  setSerializerMethod(data::mapping::type::__class::Int32::CLASS_ID, &Serializer::serializeInt<oatpp::Int32>);
+  setSerializerMethod(data::mapping::type::__class::UInt32::CLASS_ID, &Serializer::serializeUInt<oatpp::UInt32>);
+
+  setSerializerMethod(data::mapping::type::__class::Int64::CLASS_ID, &Serializer::serializeInt<oatpp::Int64>);
+  setSerializerMethod(data::mapping::type::__class::UInt64::CLASS_ID, &Serializer::serializeUInt<oatpp::UInt64>);
+
+  setSerializerMethod(data::mapping::type::__class::Float32::CLASS_ID, &Serializer::serializeFloat32);
+  setSerializerMethod(data::mapping::type::__class::Float64::CLASS_ID, &Serializer::serializeFloat64);
+  setSerializerMethod(data::mapping::type::__class::Boolean::CLASS_ID, &Serializer::serializeBoolean);
+
+  setSerializerMethod(data::mapping::type::__class::AbstractObject::CLASS_ID, &Serializer::serializeObject);
+  setSerializerMethod(data::mapping::type::__class::AbstractEnum::CLASS_ID, &Serializer::serializeEnum);
+
+  setSerializerMethod(data::mapping::type::__class::AbstractVector::CLASS_ID, &Serializer::serializeCollection);
+  setSerializerMethod(data::mapping::type::__class::AbstractList::CLASS_ID, &Serializer::serializeCollection);
+  setSerializerMethod(data::mapping::type::__class::AbstractUnorderedSet::CLASS_ID, &Serializer::serializeCollection);
+
+  setSerializerMethod(data::mapping::type::__class::AbstractPairList::CLASS_ID, &Serializer::serializeMap);
+  setSerializerMethod(data::mapping::type::__class::AbstractUnorderedMap::CLASS_ID, &Serializer::serializeMap);
+
+}
+
+void Serializer::setSerializerMethod(const data::mapping::type::ClassId& classId, SerializerMethod method) {
+  const v_uint32 id = classId.id;
+  if(id >= m_methods.size()) {
+    m_methods.resize(id + 1, nullptr);
+  }
+  m_methods[id] = method;
+}
+
+std::string Serializer::encodeFieldName(const char* name, v_uint64 param) {
+  (void) param;
+  const v_buff_size size = std::strlen(name);
+  v_char8 head[9];
+  const v_buff_size headSize = Utils::encodeHead(head, Utils::MAJOR_TYPE_TEXT_STRING, (v_uint64) size);
+  std::string result;
+  result.reserve(headSize + size);
+  result.append((const char*) head, headSize);
+  result.append(name, size);
+  return result;
+}
+
+void Serializer::serializeFloat32(Serializer* serializer,
+                                  data::stream::ConsistentOutputStream* stream,
+                                  const oatpp::Void& polymorph)
+{
+  (void) serializer;
+  if(polymorph) {
+    Utils::writeFloat32(stream, *static_cast<v_float32*>(polymorph.get()));
+  } else {
+    stream->writeCharSimple(Utils::BYTE_NULL);
+  }
+}
+
+void Serializer::serializeFloat64(Serializer* serializer,
+                                  data::stream::ConsistentOutputStream* stream,
+                                  const oatpp::Void& polymorph)
+{
+  (void) serializer;
+  if(polymorph) {
+    Utils::writeFloat64(stream, *static_cast<v_float64*>(polymorph.get()));
+  } else {
+    stream->writeCharSimple(Utils::BYTE_NULL);
+  }
+}
+
+void Serializer::serializeBoolean(Serializer* serializer,
+                                  data::stream::ConsistentOutputStream* stream,
+                                  const oatpp::Void& polymorph)
+{
+  (void) serializer;
+  if(polymorph) {
+    stream->writeCharSimple(*static_cast<bool*>(polymorph.get()) ? Utils::BYTE_TRUE : Utils::BYTE_FALSE);
+  } else {
+    stream->writeCharSimple(Utils::BYTE_NULL);
+  }
+}
+
+void Serializer::serializeString(Serializer* serializer,
+                                 data::stream::ConsistentOutputStream* stream,
+                                 const oatpp::Void& polymorph)
+{
+
+  (void) serializer;
+
+  if(!polymorph) {
+    stream->writeCharSimple(Utils::BYTE_NULL);
+    return;
+  }
+
+  auto str = static_cast<std::string*>(polymorph.get());
+  Utils::writeTextString(stream, str->data(), str->size());
+
+}
+
+void Serializer::serializeAny(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const oatpp::Void& polymorph)
+{
+
+  if(!polymorph) {
+    stream->writeCharSimple(Utils::BYTE_NULL);
+    return;
+  }
+
+  auto anyHandle = static_cast<data::mapping::type::AnyHandle*>(polymorph.get());
+  serializer->serialize(stream, oatpp::Void(anyHandle->ptr, anyHandle->type));
+
+}
+
+void Serializer::serializeEnum(Serializer* serializer,
+                               data::stream::ConsistentOutputStream* stream,
+                               const oatpp::Void& polymorph)
+{
+  auto polymorphicDispatcher = static_cast<const data::mapping::type::__class::AbstractEnum::PolymorphicDispatcher*>(
+    polymorph.getValueType()->polymorphicDispatcher
+  );
+
+  data::mapping::type::EnumInterpreterError e = data::mapping::type::EnumInterpreterError::OK;
+  serializer->serialize(stream, polymorphicDispatcher->toInterpretation(polymorph, e));
+
+  if(e == data::mapping::type::EnumInterpreterError::OK) {
+    return;
+  }
+
+  switch(e) {
+    case data::mapping::type::EnumInterpreterError::CONSTRAINT_NOT_NULL:
+      throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::serializeEnum()]: Error. Enum constraint violated - 'NotNull'.");
+    default:
+      throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::serializeEnum()]: Error. Can't serialize Enum.");
+  }
+
+}
+
+void Serializer::serializeCollection(Serializer* serializer,
+                                     data::stream::ConsistentOutputStream* stream,
+                                     const oatpp::Void& polymorph)
+{
+
+  if(!polymorph) {
+    stream->writeCharSimple(Utils::BYTE_NULL);
+    return;
+  }
+
+  auto dispatcher = static_cast<const data::mapping::type::__class::Collection::PolymorphicDispatcher*>(
+    polymorph.getValueType()->polymorphicDispatcher
+  );
+
+  /* definite length when every item is written, indefinite length when null items may be skipped */
+  const bool includeNulls = serializer->m_config->includeNullFields || serializer->m_config->alwaysIncludeNullCollectionElements;
+  if(includeNulls) {
+    Utils::writeHead(stream, Utils::MAJOR_TYPE_ARRAY, (v_uint64) dispatcher->getCollectionSize(polymorph));
+  } else {
+    stream->writeCharSimple((v_char8) ((Utils::MAJOR_TYPE_ARRAY << 5) | Utils::ADDITIONAL_INDEFINITE));
+  }
+
+  auto iterator = dispatcher->beginIteration(polymorph);
+
+  while (!iterator->finished()) {
+    const auto& value = iterator->get();
+    if(value || includeNulls) {
+      serializer->serialize(stream, value);
+    }
+    iterator->next();
+  }
+
+  if(!includeNulls) {
+    stream->writeCharSimple(Utils::BYTE_BREAK);
+  }
+
+}
+
+void Serializer::serializeMap(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const oatpp::Void& polymorph)
+{
+
+  if(!polymorph) {
+    stream->writeCharSimple(Utils::BYTE_NULL);
+    return;
+  }
+
+  auto dispatcher = static_cast<const data::mapping::type::__class::Map::PolymorphicDispatcher*>(
+    polymorph.getValueType()->polymorphicDispatcher
+  );
+
+  auto keyType = dispatcher->getKeyType();
+  if(keyType->classId != oatpp::String::Class::CLASS_ID){
+    throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::serializeMap()]: Invalid map key. Key should be String");
+  }
+
+  const bool includeNulls = serializer->m_config->includeNullFields || serializer->m_config->alwaysIncludeNullCollectionElements;
+  if(includeNulls) {
+    Utils::writeHead(stream, Utils::MAJOR_TYPE_MAP, (v_uint64) dispatcher->getMapSize(polymorph));
+  } else {
+    stream->writeCharSimple((v_char8) ((Utils::MAJOR_TYPE_MAP << 5) | Utils::ADDITIONAL_INDEFINITE));
+  }
+
+  auto iterator = dispatcher->beginIteration(polymorph);
+
+  while (!iterator->finished()) {
+    const auto& value = iterator->getValue();
+    if(value || includeNulls) {
+      const auto& key = iterator->getKey();
+      if(!key) {
+        throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::serializeMap()]: Invalid map key. Key should not be null");
+      }
+      auto keyStr = static_cast<std::string*>(key.get());
+      Utils::writeTextString(stream, keyStr->data(), keyStr->size());
+      serializer->serialize(stream, value);
+    }
+    iterator->next();
+  }
+
+  if(!includeNulls) {
+    stream->writeCharSimple(Utils::BYTE_BREAK);
+  }
+
+}
+
+void Serializer::serializeObject(Serializer* serializer,
+                                 data::stream::ConsistentOutputStream* stream,
+                                 const oatpp::Void& polymorph)
+{
+
+  if(!polymorph) {
+    stream->writeCharSimple(Utils::BYTE_NULL);
+    return;
+  }
+
+  auto config = serializer->m_config;
+  auto dispatcher = static_cast<const oatpp::data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(
+    polymorph.getValueType()->polymorphicDispatcher
+  );
+  const auto& fields = dispatcher->getProperties()->getEncodedProperties(&Serializer::encodeFieldName, 0);
+  auto object = static_cast<oatpp::BaseObject*>(polymorph.get());
+
+  if(config->includeNullFields) {
+    Utils::writeHead(stream, Utils::MAJOR_TYPE_MAP, (v_uint64) fields.size());
+  } else {
+    stream->writeCharSimple((v_char8) ((Utils::MAJOR_TYPE_MAP << 5) | Utils::ADDITIONAL_INDEFINITE));
+  }
+
+  for (auto const& entry : fields) {
+
+    auto field = entry.property;
+
+    oatpp::Void value;
+    if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
+      const auto& any = field->get(object).cast<oatpp::Any>();
+      value = any.retrieve(field->info.typeSelector->selectType(object));
+    } else {
+      value = field->getView(object);
+    }
+
+    if (value || config->includeNullFields || (field->info.required && config->alwaysIncludeRequired)) {
+      stream->writeSimple(entry.encodedName.data(), entry.encodedName.size());
+      serializer->serialize(stream, value);
+    }
+
+  }
+
+  if(!config->includeNullFields) {
+    stream->writeCharSimple(Utils::BYTE_BREAK);
+  }
+
+}
+
+void Serializer::serialize(data::stream::ConsistentOutputStream* stream,
+                           const oatpp::Void& polymorph)
+{
+  auto id = polymorph.getValueType()->classId.id;
+  auto& method = m_methods[id];
+  if(method) {
+    (*method)(this, stream, polymorph);
+  } else {
+
+    auto* interpretation = polymorph.getValueType()->findInterpretation(m_config->enabledInterpretations);
+    if(interpretation) {
+      serialize(stream, interpretation->toInterpretation(polymorph));
+    } else {
+      throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::serialize()]: "
+                               "Error. No serialize method for type '" +
+                               std::string(polymorph.getValueType()->classId.name) + "'");
+    }
+
+  }
+}
+
+const std::shared_ptr<Serializer::Config>& Serializer::getConfig() {
+  return m_config;
+}
+
+}}}}
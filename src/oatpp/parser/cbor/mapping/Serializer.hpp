@@ -0,0 +1,203 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_parser_cbor_mapping_Serializer_hpp
+#define oatpp_parser_cbor_mapping_Serializer_hpp
+
+#include "oatpp/parser/cbor/Utils.hpp"
+#include "oatpp/core/Types.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace parser { namespace cbor { namespace mapping {
+
+/**
+ * CBOR Serializer.
+ * Serializes oatpp DTO object to CBOR ([RFC 8949](https://www.rfc-editor.org/rfc/rfc8949)).
+ * See [Data Transfer Object(DTO) component](https://oatpp.io/docs/components/dto/).
+ */
+class Serializer {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+  typedef oatpp::data::mapping::type::BaseObject::Property Property;
+  typedef oatpp::data::mapping::type::BaseObject::Properties Properties;
+
+  typedef oatpp::String String;
+public:
+
+  /**
+   * Serializer config.
+   */
+  class Config : public oatpp::base::Countable {
+  public:
+    /**
+     * Constructor.
+     */
+    Config()
+    {}
+  public:
+
+    /**
+     * Create shared config.
+     * @return - `std::shared_ptr` to Config.
+     */
+    static std::shared_ptr<Config> createShared(){
+      return std::make_shared<Config>();
+    }
+
+    /**
+     * Include fields with value == nullptr into serialized CBOR.
+     * Field will still be included when field-info `required` is set to true and &id:alwaysIncludeRequired is set to true.
+     */
+    bool includeNullFields = true;
+
+    /**
+     * Always include required fields (set in in DTO_FIELD_INFO) even if they are `value == nullptr`
+     */
+    bool alwaysIncludeRequired = false;
+
+    /**
+     * Always include array or map elements, even if their value is `nullptr`.
+     */
+    bool alwaysIncludeNullCollectionElements = false;
+
+    /**
+     * Enable type interpretations.
+     */
+    std::vector<std::string> enabledInterpretations = {};
+
+  };
+
+public:
+  typedef void (*SerializerMethod)(Serializer*,
+                                   data::stream::ConsistentOutputStream*,
+                                   const oatpp::Void&);
+private:
+
+  template<class T>
+  static void serializeInt(Serializer* serializer,
+                           data::stream::ConsistentOutputStream* stream,
+                           const oatpp::Void& polymorph)
+  {
+    (void) serializer;
+    if(polymorph) {
+      const v_int64 value = *static_cast<typename T::ObjectType*>(polymorph.get());
+      if(value >= 0) {
+        Utils::writeHead(stream, Utils::MAJOR_TYPE_UNSIGNED_INT, (v_uint64) value);
+      } else {
+        Utils::writeHead(stream, Utils::MAJOR_TYPE_NEGATIVE_INT, (v_uint64) (-(value + 1)));
+      }
+    } else {
+      stream->writeCharSimple(Utils::BYTE_NULL);
+    }
+  }
+
+  template<class T>
+  static void serializeUInt(Serializer* serializer,
+                            data::stream::ConsistentOutputStream* stream,
+                            const oatpp::Void& polymorph)
+  {
+    (void) serializer;
+    if(polymorph) {
+      Utils::writeHead(stream, Utils::MAJOR_TYPE_UNSIGNED_INT, *static_cast<typename T::ObjectType*>(polymorph.get()));
+    } else {
+      stream->writeCharSimple(Utils::BYTE_NULL);
+    }
+  }
+
+  static std::string encodeFieldName(const char* name, v_uint64 param);
+
+  static void serializeFloat32(Serializer* serializer,
+                               data::stream::ConsistentOutputStream* stream,
+                               const oatpp::Void& polymorph);
+
+  static void serializeFloat64(Serializer* serializer,
+                               data::stream::ConsistentOutputStream* stream,
+                               const oatpp::Void& polymorph);
+
+  static void serializeBoolean(Serializer* serializer,
+                               data::stream::ConsistentOutputStream* stream,
+                               const oatpp::Void& polymorph);
+
+  static void serializeString(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const oatpp::Void& polymorph);
+
+  static void serializeAny(Serializer* serializer,
+                           data::stream::ConsistentOutputStream* stream,
+                           const oatpp::Void& polymorph);
+
+  static void serializeEnum(Serializer* serializer,
+                            data::stream::ConsistentOutputStream* stream,
+                            const oatpp::Void& polymorph);
+
+  static void serializeCollection(Serializer* serializer,
+                                  data::stream::ConsistentOutputStream* stream,
+                                  const oatpp::Void& polymorph);
+
+  static void serializeMap(Serializer* serializer,
+                           data::stream::ConsistentOutputStream* stream,
+                           const oatpp::Void& polymorph);
+
+  static void serializeObject(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const oatpp::Void& polymorph);
+
+private:
+  std::shared_ptr<Config> m_config;
+  std::vector<SerializerMethod> m_methods;
+public:
+
+  /**
+   * Constructor.
+   * @param config - serializer config.
+   */
+  Serializer(const std::shared_ptr<Config>& config = std::make_shared<Config>());
+
+  /**
+   * Set serializer method for type.
+   * @param classId - &id:oatpp::data::mapping::type::ClassId;.
+   * @param method - `typedef void (*SerializerMethod)(Serializer*, data::stream::ConsistentOutputStream*, const oatpp::Void&)`.
+   */
+  void setSerializerMethod(const data::mapping::type::ClassId& classId, SerializerMethod method);
+
+  /**
+   * Serialize object to stream.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param polymorph - DTO as &id:oatpp::Void;.
+   */
+  void serialize(data::stream::ConsistentOutputStream* stream, const oatpp::Void& polymorph);
+
+  /**
+   * Get serializer config.
+   * @return
+   */
+  const std::shared_ptr<Config>& getConfig();
+
+};
+
+}}}}
+
+#endif /* oatpp_parser_cbor_mapping_Serializer_hpp */
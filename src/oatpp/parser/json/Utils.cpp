@@ -27,71 +27,198 @@
 #include "oatpp/encoding/Unicode.hpp"
 #include "oatpp/encoding/Hex.hpp"
 
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define OATPP_JSON_UTILS_SSE2
+  #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    #define OATPP_JSON_UTILS_AVX2_DISPATCH
+  #endif
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #endif
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define OATPP_JSON_UTILS_NEON
+#endif
+
 namespace oatpp { namespace parser { namespace json{
 
-v_buff_size Utils::calcEscapedStringSize(const char* data, v_buff_size size, v_buff_size& safeSize, v_uint32 flags) {
-  v_buff_size result = 0;
-  v_buff_size i = 0;
-  safeSize = size;
-  while (i < size) {
-    v_char8 a = data[i];
-    if(a < 32) {
-      i ++;
+namespace {
 
-      switch (a) {
+  /*
+   * Char which can be copied to json string as is.
+   */
+  bool isSafeChar(v_char8 a, bool escapeSolidus) {
+    return a >= 32 && a < 128 && a != '"' && a != '\\' && !(escapeSolidus && a == '/');
+  }
 
-        case '\b':
-        case '\f':
-        case '\n':
-        case '\r':
-        case '\t': result += 2; break; // '\n'
+  v_buff_size findUnsafeCharScalar(const char* data, v_buff_size from, v_buff_size size, bool escapeSolidus) {
+    while(from < size && isSafeChar((v_char8) data[from], escapeSolidus)) {
+      from ++;
+    }
+    return from;
+  }
 
-        default:
-          result += 6; // '\uFFFF' - 6 chars
-          break;
+#if defined(OATPP_JSON_UTILS_SSE2) || defined(OATPP_JSON_UTILS_AVX2_DISPATCH)
+
+  v_int32 countTrailingZeros(v_uint32 mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (v_int32) index;
+#else
+    return __builtin_ctz(mask);
+#endif
+  }
+
+#endif
 
+#ifdef OATPP_JSON_UTILS_SSE2
+
+  v_buff_size findUnsafeCharSSE2(const char* data, v_buff_size from, v_buff_size size, bool escapeSolidus) {
+
+    /* signed compare: bytes < 32 and bytes >= 128 (negative) are both "less than 32" */
+    const __m128i space = _mm_set1_epi8(32);
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i solidus = escapeSolidus ? _mm_set1_epi8('/') : _mm_set1_epi8('"');
+
+    while(from + 16 <= size) {
+      __m128i block = _mm_loadu_si128((const __m128i*) (data + from));
+      __m128i unsafe = _mm_or_si128(
+        _mm_or_si128(_mm_cmplt_epi8(block, space), _mm_cmpeq_epi8(block, quote)),
+        _mm_or_si128(_mm_cmpeq_epi8(block, backslash), _mm_cmpeq_epi8(block, solidus))
+      );
+      v_uint32 mask = (v_uint32) _mm_movemask_epi8(unsafe);
+      if(mask != 0) {
+        return from + countTrailingZeros(mask);
       }
+      from += 16;
+    }
 
-    } else if(a < 128){
-      i ++;
+    return findUnsafeCharScalar(data, from, size, escapeSolidus);
 
-      switch (a) {
-        case '\"':
-        case '\\': result += 2; break; // '\/'
+  }
 
-        case '/':
-          result ++;
-          if((flags & FLAG_ESCAPE_SOLIDUS) > 0) result ++;
-          break;
+#endif
 
-        default:
-          result ++;
-          break;
+#ifdef OATPP_JSON_UTILS_AVX2_DISPATCH
+
+  __attribute__((target("avx2")))
+  v_buff_size findUnsafeCharAVX2(const char* data, v_buff_size from, v_buff_size size, bool escapeSolidus) {
+
+    const __m256i space = _mm256_set1_epi8(32);
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i solidus = escapeSolidus ? _mm256_set1_epi8('/') : _mm256_set1_epi8('"');
 
+    while(from + 32 <= size) {
+      __m256i block = _mm256_loadu_si256((const __m256i*) (data + from));
+      __m256i unsafe = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpgt_epi8(space, block), _mm256_cmpeq_epi8(block, quote)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, backslash), _mm256_cmpeq_epi8(block, solidus))
+      );
+      v_uint32 mask = (v_uint32) _mm256_movemask_epi8(unsafe);
+      if(mask != 0) {
+        return from + countTrailingZeros(mask);
       }
+      from += 32;
+    }
 
-    } else {
-      v_buff_size charSize = oatpp::encoding::Unicode::getUtf8CharSequenceLength(a);
-      if(charSize != 0) {
-        if(i + charSize > size) {
-          safeSize = i;
-        }
-        i += charSize;
-        if(charSize < 4) {
-          result += 6; // '\uFFFF' - 6 chars
-        } else if(charSize == 4) {
-          result += 12; // '\uFFFF\uFFFF' - 12 chars surrogate pair
-        } else {
-          result += 11; // '\u+FFFFFFFF' - 11 chars NOT JSON standard case
-        }
-      } else {
-        // invalid char
-        i ++;
-        result ++;
+    return findUnsafeCharSSE2(data, from, size, escapeSolidus);
+
+  }
+
+#endif
+
+#ifdef OATPP_JSON_UTILS_NEON
+
+  v_buff_size findUnsafeCharNEON(const char* data, v_buff_size from, v_buff_size size, bool escapeSolidus) {
+
+    const int8x16_t space = vdupq_n_s8(32);
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t solidus = vdupq_n_u8(escapeSolidus ? '/' : '"');
+
+    while(from + 16 <= size) {
+      uint8x16_t block = vld1q_u8((const uint8_t*) (data + from));
+      uint8x16_t unsafe = vorrq_u8(
+        vorrq_u8(vcltq_s8(vreinterpretq_s8_u8(block), space), vceqq_u8(block, quote)),
+        vorrq_u8(vceqq_u8(block, backslash), vceqq_u8(block, solidus))
+      );
+      if(vmaxvq_u8(unsafe) != 0) {
+        return findUnsafeCharScalar(data, from, from + 16, escapeSolidus);
       }
+      from += 16;
     }
+
+    return findUnsafeCharScalar(data, from, size, escapeSolidus);
+
   }
-  return result;
+
+#endif
+
+  typedef v_buff_size (*FindUnsafeCharFunction)(const char* data, v_buff_size from, v_buff_size size, bool escapeSolidus);
+
+  FindUnsafeCharFunction selectFindUnsafeChar() {
+#if defined(OATPP_JSON_UTILS_AVX2_DISPATCH)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+      return &findUnsafeCharAVX2;
+    }
+    return &findUnsafeCharSSE2;
+#elif defined(OATPP_JSON_UTILS_SSE2)
+    return &findUnsafeCharSSE2;
+#elif defined(OATPP_JSON_UTILS_NEON)
+    return &findUnsafeCharNEON;
+#else
+    return &findUnsafeCharScalar;
+#endif
+  }
+
+  /*
+   * Find first char which has to be escaped in json string.
+   * Safe chars are skipped 16 or 32 at a time depending on the instruction set available.
+   * Implementation is selected on first use - json may be escaped during static initialization of other units.
+   */
+  v_buff_size findUnsafeChar(const char* data, v_buff_size from, v_buff_size size, bool escapeSolidus) {
+    static const FindUnsafeCharFunction findUnsafeCharImpl = selectFindUnsafeChar();
+    return findUnsafeCharImpl(data, from, size, escapeSolidus);
+  }
+
+  class StringSink {
+  private:
+    std::string& m_string;
+  public:
+
+    StringSink(std::string& string)
+      : m_string(string)
+    {}
+
+    void write(const char* data, v_buff_size size) {
+      m_string.append(data, size);
+    }
+
+  };
+
+  class StreamSink {
+  private:
+    data::stream::ConsistentOutputStream* m_stream;
+  public:
+
+    StreamSink(data::stream::ConsistentOutputStream* stream)
+      : m_stream(stream)
+    {}
+
+    void write(const char* data, v_buff_size size) {
+      m_stream->writeSimple(data, size);
+    }
+
+  };
+
 }
 
 v_buff_size Utils::calcUnescapedStringSize(const char* data, v_buff_size size, v_int64& errorCode, v_buff_size& errorPosition) {
@@ -100,6 +227,16 @@ v_buff_size Utils::calcUnescapedStringSize(const char* data, v_buff_size size, v
   v_buff_size i = 0;
   
   while (i < size) {
+
+    /* skip run of plain chars */
+    auto backslash = (const char*) std::memchr(&data[i], '\\', size - i);
+    if(backslash == nullptr) {
+      result += size - i;
+      break;
+    }
+    result += backslash - &data[i];
+    i = backslash - data;
+
     v_char8 a = data[i];
     if(a == '\\'){
       
@@ -217,91 +354,104 @@ v_buff_size Utils::escapeUtf8Char(const char* sequence, p_char8 buffer){
   }
 }
 
-oatpp::String Utils::escapeString(const char* data, v_buff_size size, v_uint32 flags) {
-  v_buff_size safeSize;
-  v_buff_size escapedSize = calcEscapedStringSize(data, size, safeSize, flags);
-  if(escapedSize == size) {
-    return String((const char*)data, size);
-  }
-  auto result = String(escapedSize);
-  p_char8 resultData = (p_char8) result->data();
-  v_buff_size pos = 0;
+template<class Sink>
+void Utils::escapeToSink(const char* data, v_buff_size size, v_uint32 flags, Sink& sink) {
 
-  {
-    v_buff_size i = 0;
-    while (i < safeSize) {
-      v_char8 a = data[i];
-      if (a < 32) {
+  const bool escapeSolidus = (flags & FLAG_ESCAPE_SOLIDUS) > 0;
+  v_char8 buffer[12];
 
-        switch (a) {
+  v_buff_size i = 0;
+  while (i < size) {
 
-          case '\b': resultData[pos] = '\\'; resultData[pos + 1] = 'b'; pos += 2; break;
-          case '\f': resultData[pos] = '\\'; resultData[pos + 1] = 'f'; pos += 2; break;
-          case '\n': resultData[pos] = '\\'; resultData[pos + 1] = 'n'; pos += 2; break;
-          case '\r': resultData[pos] = '\\'; resultData[pos + 1] = 'r'; pos += 2; break;
-          case '\t': resultData[pos] = '\\'; resultData[pos + 1] = 't'; pos += 2; break;
+    v_buff_size safeEnd = findUnsafeChar(data, i, size, escapeSolidus);
+    if(safeEnd > i) {
+      sink.write(&data[i], safeEnd - i);
+      i = safeEnd;
+      if(i == size) {
+        break;
+      }
+    }
 
-          default:
-            resultData[pos] = '\\';
-            resultData[pos + 1] = 'u';
-            oatpp::encoding::Hex::writeUInt16(a, &resultData[pos + 2]);
-            pos += 6;
-            break;
+    v_char8 a = data[i];
+    if (a < 32) {
 
-        }
+      switch (a) {
 
-        i++;
+        case '\b': sink.write("\\b", 2); break;
+        case '\f': sink.write("\\f", 2); break;
+        case '\n': sink.write("\\n", 2); break;
+        case '\r': sink.write("\\r", 2); break;
+        case '\t': sink.write("\\t", 2); break;
+
+        default:
+          buffer[0] = '\\';
+          buffer[1] = 'u';
+          oatpp::encoding::Hex::writeUInt16(a, &buffer[2]);
+          sink.write((const char*) buffer, 6);
+          break;
 
       }
-      else if (a < 128) {
 
-        switch (a) {
-          case '\"': resultData[pos] = '\\'; resultData[pos + 1] = '"'; pos += 2; break;
-          case '\\': resultData[pos] = '\\'; resultData[pos + 1] = '\\'; pos += 2; break;
+      i++;
 
-          case '/':
-            if((flags & FLAG_ESCAPE_SOLIDUS) > 0) {
-              resultData[pos] = '\\';
-              resultData[pos + 1] = '/';
-              pos += 2;
-            } else {
-              resultData[pos] = data[i];
-              pos++;
-            }
-            break;
+    }
+    else if (a < 128) {
 
-          default:
-            resultData[pos] = data[i];
-            pos++;
-            break;
+      switch (a) {
+        case '\"': sink.write("\\\"", 2); break;
+        case '\\': sink.write("\\\\", 2); break;
+        case '/': sink.write("\\/", 2); break;
+        default: sink.write(&data[i], 1); break;
+      }
 
-        }
+      i++;
 
-        i++;
+    }
+    else {
+      v_buff_size charSize = oatpp::encoding::Unicode::getUtf8CharSequenceLength(a);
+      if (charSize != 0) {
+        if(i + charSize > size) {
+          // truncated sequence - replace it with '?' of the length of its escaped form
+          v_buff_size escapedSize = charSize < 4 ? 6 : (charSize == 4 ? 12 : 11);
+          std::memset(buffer, '?', escapedSize);
+          sink.write((const char*) buffer, escapedSize);
+          break;
+        }
+        std::memset(buffer, 0, sizeof(buffer));
+        sink.write((const char*) buffer, escapeUtf8Char(&data[i], buffer));
+        i += charSize;
       }
       else {
-        v_buff_size charSize = oatpp::encoding::Unicode::getUtf8CharSequenceLength(a);
-        if (charSize != 0) {
-          pos += escapeUtf8Char(&data[i], &resultData[pos]);
-          i += charSize;
-        }
-        else {
-          // invalid char
-          resultData[pos] = data[i];
-          i++;
-          pos++;
-        }
+        // invalid char
+        sink.write(&data[i], 1);
+        i++;
       }
     }
   }
-  
-  if(size > safeSize){
-    for(v_buff_size i = pos; i < result->size(); i ++){
-      resultData[i] = '?';
-    }
+
+}
+
+oatpp::String Utils::escapeString(const char* data, v_buff_size size, v_uint32 flags) {
+
+  v_buff_size safeSize = findUnsafeChar(data, 0, size, (flags & FLAG_ESCAPE_SOLIDUS) > 0);
+  if(safeSize == size) {
+    return String((const char*)data, size);
   }
-  
-  return result;
+
+  std::string result;
+  result.reserve(size + (size >> 3) + 16);
+  result.append(data, safeSize);
+
+  StringSink sink(result);
+  escapeToSink(&data[safeSize], size - safeSize, flags, sink);
+
+  return String(std::move(result));
+
+}
+
+void Utils::escapeStringToStream(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size, v_uint32 flags) {
+  StreamSink sink(stream);
+  escapeToSink(data, size, flags, sink);
 }
 
 void Utils::unescapeStringToBuffer(const char* data, v_buff_size size, p_char8 resultData){
@@ -310,6 +460,18 @@ void Utils::unescapeStringToBuffer(const char* data, v_buff_size size, p_char8 r
   v_buff_size pos = 0;
   
   while (i < size) {
+
+    /* copy run of plain chars */
+    auto backslash = (const char*) std::memchr(&data[i], '\\', size - i);
+    if(backslash == nullptr) {
+      std::memcpy(&resultData[pos], &data[i], size - i);
+      break;
+    }
+    v_buff_size runSize = backslash - &data[i];
+    std::memcpy(&resultData[pos], &data[i], runSize);
+    pos += runSize;
+    i += runSize;
+
     v_char8 a = data[i];
     
     if(a == '\\'){
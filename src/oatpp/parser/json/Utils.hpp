@@ -25,6 +25,7 @@
 #ifndef oatpp_parser_json_Utils_hpp
 #define oatpp_parser_json_Utils_hpp
 
+#include "oatpp/core/data/stream/Stream.hpp"
 #include "oatpp/core/parser/Caret.hpp"
 #include "oatpp/core/Types.hpp"
 
@@ -71,12 +72,21 @@ public:
   typedef oatpp::parser::Caret ParsingCaret;
 private:
   static v_buff_size escapeUtf8Char(const char* sequence, p_char8 buffer);
-  static v_buff_size calcEscapedStringSize(const char* data, v_buff_size size, v_buff_size& safeSize, v_uint32 flags);
+  template<class Sink>
+  static void escapeToSink(const char* data, v_buff_size size, v_uint32 flags, Sink& sink);
   static v_buff_size calcUnescapedStringSize(const char* data, v_buff_size size, v_int64& errorCode, v_buff_size& errorPosition);
   static void unescapeStringToBuffer(const char* data, v_buff_size size, p_char8 resultData);
-  static const char* preparseString(ParsingCaret& caret, v_buff_size& size);
 public:
 
+  /**
+   * Find bounds of the json string at caret without unescaping it. <br>
+   * On success caret is positioned right after the opening quote.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param size - out parameter - size of the raw (still escaped) string content.
+   * @return - pointer to the raw string content or `nullptr` in case of error.
+   */
+  static const char* preparseString(ParsingCaret& caret, v_buff_size& size);
+
   /**
    * Escape string as for json standard. <br>
    * *Note:* if(copyAsOwnData == false && escapedString == initialString) then result string will point to initial data.
@@ -87,6 +97,18 @@ public:
    */
   static String escapeString(const char* data, v_buff_size size, v_uint32 flags = FLAG_ESCAPE_ALL);
 
+  /**
+   * Escape string as for json standard and write it directly to stream - no intermediate string is created.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param data - pointer to string to escape.
+   * @param size - data size.
+   * @param flags - escape flags.
+   */
+  static void escapeStringToStream(data::stream::ConsistentOutputStream* stream,
+                                   const char* data,
+                                   v_buff_size size,
+                                   v_uint32 flags = FLAG_ESCAPE_ALL);
+
   /**
    * Unescape string as for json standard.
    * @param data - pointer to string to unescape.
@@ -26,6 +26,8 @@
 
 #include "oatpp/core/utils/ConversionUtils.hpp"
 
+#include <cstring>
+
 namespace oatpp { namespace parser { namespace json { namespace mapping {
 
 Deserializer::Deserializer(const std::shared_ptr<Config>& config)
@@ -63,6 +65,38 @@ Deserializer::Deserializer(const std::shared_ptr<Config>& config)
   setDeserializerMethod(data::mapping::type::__class::AbstractPairList::CLASS_ID, &Deserializer::deserializeMap);
   setDeserializerMethod(data::mapping::type::__class::AbstractUnorderedMap::CLASS_ID, &Deserializer::deserializeMap);
 
+  setInlineDeserializerMethod(data::mapping::type::__class::Int8::CLASS_ID, &Deserializer::deserializeInline<v_int8, &Deserializer::parseIntValue<v_int8>>);
+  setInlineDeserializerMethod(data::mapping::type::__class::UInt8::CLASS_ID, &Deserializer::deserializeInline<v_uint8, &Deserializer::parseUIntValue<v_uint8>>);
+
+  setInlineDeserializerMethod(data::mapping::type::__class::Int16::CLASS_ID, &Deserializer::deserializeInline<v_int16, &Deserializer::parseIntValue<v_int16>>);
+  setInlineDeserializerMethod(data::mapping::type::__class::UInt16::CLASS_ID, &Deserializer::deserializeInline<v_uint16, &Deserializer::parseUIntValue<v_uint16>>);
+
+  setInlineDeserializerMethod(data::mapping::type::__class::Int32::CLASS_ID, &Deserializer::deserializeInline<v_int32, &Deserializer::parseIntValue<v_int32>>);
+  setInlineDeserializerMethod(data::mapping::type::__class::UInt32::CLASS_ID, &Deserializer::deserializeInline<v_uint32, &Deserializer::parseUIntValue<v_uint32>>);
+
+  setInlineDeserializerMethod(data::mapping::type::__class::Int64::CLASS_ID, &Deserializer::deserializeInline<v_int64, &Deserializer::parseIntValue<v_int64>>);
+  setInlineDeserializerMethod(data::mapping::type::__class::UInt64::CLASS_ID, &Deserializer::deserializeInline<v_uint64, &Deserializer::parseUIntValue<v_uint64>>);
+
+  setInlineDeserializerMethod(data::mapping::type::__class::Float32::CLASS_ID, &Deserializer::deserializeInline<v_float32, &Deserializer::parseFloat32Value>);
+  setInlineDeserializerMethod(data::mapping::type::__class::Float64::CLASS_ID, &Deserializer::deserializeInline<v_float64, &Deserializer::parseFloat64Value>);
+  setInlineDeserializerMethod(data::mapping::type::__class::Boolean::CLASS_ID, &Deserializer::deserializeInline<bool, &Deserializer::parseBooleanValue>);
+
+  setArrayItemReaders<oatpp::Int8, &Deserializer::parseIntValue<v_int8>>(data::mapping::type::__class::Int8::CLASS_ID);
+  setArrayItemReaders<oatpp::UInt8, &Deserializer::parseUIntValue<v_uint8>>(data::mapping::type::__class::UInt8::CLASS_ID);
+
+  setArrayItemReaders<oatpp::Int16, &Deserializer::parseIntValue<v_int16>>(data::mapping::type::__class::Int16::CLASS_ID);
+  setArrayItemReaders<oatpp::UInt16, &Deserializer::parseUIntValue<v_uint16>>(data::mapping::type::__class::UInt16::CLASS_ID);
+
+  setArrayItemReaders<oatpp::Int32, &Deserializer::parseIntValue<v_int32>>(data::mapping::type::__class::Int32::CLASS_ID);
+  setArrayItemReaders<oatpp::UInt32, &Deserializer::parseUIntValue<v_uint32>>(data::mapping::type::__class::UInt32::CLASS_ID);
+
+  setArrayItemReaders<oatpp::Int64, &Deserializer::parseIntValue<v_int64>>(data::mapping::type::__class::Int64::CLASS_ID);
+  setArrayItemReaders<oatpp::UInt64, &Deserializer::parseUIntValue<v_uint64>>(data::mapping::type::__class::UInt64::CLASS_ID);
+
+  setArrayItemReaders<oatpp::Float32, &Deserializer::parseFloat32Value>(data::mapping::type::__class::Float32::CLASS_ID);
+  setArrayItemReaders<oatpp::Float64, &Deserializer::parseFloat64Value>(data::mapping::type::__class::Float64::CLASS_ID);
+  setArrayItemReaders<oatpp::Boolean, &Deserializer::parseBooleanValue>(data::mapping::type::__class::Boolean::CLASS_ID);
+
 }
 
 void Deserializer::setDeserializerMethod(const data::mapping::type::ClassId& classId, DeserializerMethod method) {
@@ -71,6 +105,49 @@ void Deserializer::setDeserializerMethod(const data::mapping::type::ClassId& cla
     m_methods.resize(id + 1, nullptr);
   }
   m_methods[id] = method;
+  if(id < m_inlineMethods.size()) {
+    m_inlineMethods[id] = nullptr; // custom method takes over inline fields too
+  }
+  if(id < m_arrayItemReaders.size()) {
+    m_arrayItemReaders[id] = {nullptr, nullptr, nullptr, nullptr}; // and array items
+  }
+}
+
+Deserializer::ArrayItemReader Deserializer::getArrayItemReader(const Type* type) const {
+  if(type->classId.id != data::mapping::type::__class::AbstractVector::CLASS_ID.id) {
+    return nullptr;
+  }
+  const v_uint32 itemId = type->params[0]->classId.id;
+  if(itemId >= m_arrayItemReaders.size()) {
+    return nullptr;
+  }
+  const ArrayItemReaders& readers = m_arrayItemReaders[itemId];
+  if(type == readers.vectorType) {
+    return readers.vectorReader;
+  }
+  if(type == readers.inlineVectorType) {
+    return readers.inlineVectorReader;
+  }
+  return nullptr;
+}
+
+void Deserializer::setInlineDeserializerMethod(const data::mapping::type::ClassId& classId, InlineDeserializerMethod method) {
+  const v_uint32 id = classId.id;
+  if(id >= m_inlineMethods.size()) {
+    m_inlineMethods.resize(id + 1, nullptr);
+  }
+  m_inlineMethods[id] = method;
+}
+
+void Deserializer::deserializeField(parser::Caret& caret, oatpp::BaseObject::Property* field, oatpp::BaseObject* object) {
+  if(field->isInline()) {
+    const v_uint32 id = field->type->classId.id;
+    if(id < m_inlineMethods.size() && m_inlineMethods[id]) {
+      m_inlineMethods[id](caret, field, object);
+      return;
+    }
+  }
+  field->set(object, deserialize(caret, field->type));
 }
 
 void Deserializer::skipScope(oatpp::parser::Caret& caret, v_char8 charOpen, v_char8 charClose){
@@ -154,6 +231,24 @@ void Deserializer::skipValue(oatpp::parser::Caret& caret){
   }
 }
 
+v_float32 Deserializer::parseFloat32Value(parser::Caret& caret) {
+  return caret.parseFloat32();
+}
+
+v_float64 Deserializer::parseFloat64Value(parser::Caret& caret) {
+  return caret.parseFloat64();
+}
+
+bool Deserializer::parseBooleanValue(parser::Caret& caret) {
+  if(caret.isAtText("true", true)) {
+    return true;
+  } else if(caret.isAtText("false", true)) {
+    return false;
+  }
+  caret.setError("[oatpp::parser::json::mapping::Deserializer::readBooleanValue()]: Error. 'true' or 'false' - expected.", ERROR_CODE_VALUE_BOOLEAN);
+  return false;
+}
+
 oatpp::Void Deserializer::deserializeFloat32(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
 
   (void) deserializer;
@@ -187,14 +282,11 @@ oatpp::Void Deserializer::deserializeBoolean(Deserializer* deserializer, parser:
   if(caret.isAtText("null", true)){
     return oatpp::Void(Boolean::Class::getType());
   } else {
-    if(caret.isAtText("true", true)) {
-      return Boolean(true);
-    } else if(caret.isAtText("false", true)) {
-      return Boolean(false);
-    } else {
-      caret.setError("[oatpp::parser::json::mapping::Deserializer::readBooleanValue()]: Error. 'true' or 'false' - expected.", ERROR_CODE_VALUE_BOOLEAN);
+    bool value = parseBooleanValue(caret);
+    if(caret.hasError()) {
       return oatpp::Void(Boolean::Class::getType());
     }
+    return Boolean(value);
   }
 
 }
@@ -257,7 +349,7 @@ oatpp::Void Deserializer::deserializeAny(Deserializer* deserializer, parser::Car
     const Type* const fieldType = guessType(caret);
     if(fieldType != nullptr) {
       auto fieldValue = deserializer->deserialize(caret, fieldType);
-      auto anyHandle = std::make_shared<data::mapping::type::AnyHandle>(fieldValue.getPtr(), fieldValue.getValueType());
+      auto anyHandle = data::mapping::Arena::allocateShared<data::mapping::type::AnyHandle>(fieldValue.getPtr(), fieldValue.getValueType());
       return oatpp::Void(anyHandle, Any::Class::getType());
     }
   }
@@ -305,18 +397,27 @@ oatpp::Void Deserializer::deserializeCollection(Deserializer* deserializer, pars
     auto collection = dispatcher->createObject();
 
     auto itemType = dispatcher->getItemType();
+    auto itemReader = deserializer->getArrayItemReader(type);
 
     caret.skipBlankChars();
 
     while(!caret.isAtChar(']') && caret.canContinue()){
 
       caret.skipBlankChars();
-      auto item = deserializer->deserialize(caret, itemType);
-      if(caret.hasError()){
-        return nullptr;
+
+      if(itemReader) {
+        itemReader(caret, collection.get());
+        if(caret.hasError()){
+          return nullptr;
+        }
+      } else {
+        auto item = deserializer->deserialize(caret, itemType);
+        if(caret.hasError()){
+          return nullptr;
+        }
+        dispatcher->addItem(collection, item);
       }
 
-      dispatcher->addItem(collection, item);
       caret.skipBlankChars();
 
       caret.canContinueAtChar(',', 1);
@@ -402,6 +503,44 @@ oatpp::Void Deserializer::deserializeMap(Deserializer* deserializer, parser::Car
 
 }
 
+v_int32 Deserializer::readFieldIndex(oatpp::parser::Caret& caret,
+                                    const oatpp::BaseObject::Properties::NameIndex& index,
+                                    v_int32 predictedIndex)
+{
+
+  v_buff_size size;
+  const char* data = Utils::preparseString(caret, size);
+  if(data == nullptr) {
+    return -1;
+  }
+
+  v_buff_size pos = caret.getPosition();
+
+  if(std::memchr(data, '\\', size) == nullptr) {
+
+    /* no escaped chars - lookup raw key bytes, no allocations */
+    caret.setPosition(pos + size + 1);
+    if(index.matches(predictedIndex, data, size)) {
+      return predictedIndex;
+    }
+    return index.findIndex(data, size);
+
+  }
+
+  v_int64 errorCode;
+  v_buff_size errorPosition;
+  const std::string& key = Utils::unescapeStringToStdString(data, size, errorCode, errorPosition);
+  if(errorCode != 0){
+    caret.setError("[oatpp::parser::json::mapping::Deserializer::readFieldIndex()]: Error. Call to unescapeStringToStdString() failed", errorCode);
+    caret.setPosition(pos + errorPosition);
+    return -1;
+  }
+
+  caret.setPosition(pos + size + 1);
+  return index.findIndex(key.data(), (v_buff_size) key.size());
+
+}
+
 oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
 
   if(caret.isAtText("null", true)){
@@ -412,7 +551,9 @@ oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer, parser::
 
     auto dispatcher = static_cast<const oatpp::data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(type->polymorphicDispatcher);
     auto object = dispatcher->createObject();
-    const auto& fieldsMap = dispatcher->getProperties()->getMap();
+    const auto& fieldsIndex = dispatcher->getProperties()->getNameIndex();
+    const bool predictFieldsOrder = deserializer->getConfig()->predictFieldsOrder;
+    v_int32 predictedIndex = predictFieldsOrder ? 0 : -1;
 
     caret.skipBlankChars();
 
@@ -420,13 +561,16 @@ oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer, parser::
     while (!caret.isAtChar('}') && caret.canContinue()) {
 
       caret.skipBlankChars();
-      auto key = Utils::parseStringToStdString(caret);
+      v_int32 fieldIndex = readFieldIndex(caret, fieldsIndex, predictedIndex);
       if(caret.hasError()){
         return nullptr;
       }
 
-      auto fieldIterator = fieldsMap.find(key);
-      if(fieldIterator != fieldsMap.end()){
+      if(fieldIndex >= 0){
+
+        if(predictFieldsOrder) {
+          predictedIndex = fieldIndex + 1;
+        }
 
         caret.skipBlankChars();
         if(!caret.canContinueAtChar(':', 1)){
@@ -436,14 +580,14 @@ oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer, parser::
 
         caret.skipBlankChars();
 
-        auto field = fieldIterator->second;
+        auto field = fieldsIndex.getEntry(fieldIndex).property;
 
         if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
           auto label = caret.putLabel();
           skipValue(caret);
           polymorphs.emplace_back(field, label.toString()); // store polymorphs for later processing.
         } else {
-          field->set(static_cast<oatpp::BaseObject *>(object.get()), deserializer->deserialize(caret, field->type));
+          deserializer->deserializeField(caret, field, static_cast<oatpp::BaseObject *>(object.get()));
         }
 
       } else if (deserializer->getConfig()->allowUnknownFields) {
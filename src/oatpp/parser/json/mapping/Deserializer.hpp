@@ -38,6 +38,7 @@ namespace oatpp { namespace parser { namespace json { namespace mapping {
  * Deserialize oatpp DTO object from json. See [Data Transfer Object(DTO) component](https://oatpp.io/docs/components/dto/).
  */
 class Deserializer {
+  friend class StreamingDeserializer;
 public:
   typedef oatpp::data::mapping::type::Type Type;
   typedef oatpp::data::mapping::type::BaseObject::Property Property;
@@ -110,6 +111,12 @@ public:
      */
     bool allowUnknownFields = true;
 
+    /**
+     * Predict the next object field from the declaration order of DTO fields.
+     * When json fields come in the same order as declared in DTO, field lookup is a single comparison.
+     */
+    bool predictFieldsOrder = true;
+
     /**
      * Enable type interpretations.
      */
@@ -119,11 +126,27 @@ public:
 
 public:
   typedef oatpp::Void (*DeserializerMethod)(Deserializer*, parser::Caret&, const Type* const);
+private:
+  typedef void (*InlineDeserializerMethod)(parser::Caret&, oatpp::BaseObject::Property*, oatpp::BaseObject*);
+  typedef void (*ArrayItemReader)(parser::Caret&, void*);
+
+  /*
+   * Typed array item readers for `Vector<T>` and `Vector<Inline<T>>` of primitive T.
+   */
+  struct ArrayItemReaders {
+    const Type* vectorType;
+    ArrayItemReader vectorReader;
+    const Type* inlineVectorType;
+    ArrayItemReader inlineVectorReader;
+  };
 private:
   static void skipScope(oatpp::parser::Caret& caret, v_char8 charOpen, v_char8 charClose);
   static void skipString(oatpp::parser::Caret& caret);
   static void skipToken(oatpp::parser::Caret& caret);
   static void skipValue(oatpp::parser::Caret& caret);
+  static v_int32 readFieldIndex(oatpp::parser::Caret& caret,
+                                const oatpp::BaseObject::Properties::NameIndex& index,
+                                v_int32 predictedIndex);
 private:
   static const Type* guessNumberType(oatpp::parser::Caret& caret);
   static const Type* guessType(oatpp::parser::Caret& caret);
@@ -229,6 +252,66 @@ private:
 
   }
 
+  template<typename V>
+  static V parseIntValue(parser::Caret& caret) {
+    return static_cast<V>(caret.parseInt());
+  }
+
+  template<typename V>
+  static V parseUIntValue(parser::Caret& caret) {
+    return static_cast<V>(caret.parseUnsignedInt());
+  }
+
+  static v_float32 parseFloat32Value(parser::Caret& caret);
+  static v_float64 parseFloat64Value(parser::Caret& caret);
+  static bool parseBooleanValue(parser::Caret& caret);
+
+  /*
+   * Parse primitive value on stack and copy it into the inline field - no heap allocations.
+   */
+  template<typename V, V (*parse)(parser::Caret&)>
+  static void deserializeInline(parser::Caret& caret, oatpp::BaseObject::Property* field, oatpp::BaseObject* object) {
+    if(caret.isAtText("null", true)){
+      field->set(object, nullptr);
+      return;
+    }
+    V value = parse(caret);
+    if(!caret.hasError()) {
+      field->set(object, oatpp::Void(std::shared_ptr<void>(std::shared_ptr<void>(), &value), field->type));
+    }
+  }
+
+  /*
+   * Parse primitive item and append it directly to the std::vector storage - no Void boxing and no virtual dispatch.
+   */
+  template<class Item, typename V, V (*parse)(parser::Caret&)>
+  static void readArrayItem(parser::Caret& caret, void* container) {
+    auto vector = static_cast<std::vector<Item>*>(container);
+    if(caret.isAtText("null", true)){
+      vector->emplace_back(nullptr);
+      return;
+    }
+    V value = parse(caret);
+    if(!caret.hasError()) {
+      vector->emplace_back(value);
+    }
+  }
+
+  template<class Wrapper, typename Wrapper::UnderlyingType (*parse)(parser::Caret&)>
+  void setArrayItemReaders(const data::mapping::type::ClassId& classId) {
+    typedef typename Wrapper::UnderlyingType V;
+    const v_uint32 id = classId.id;
+    if(id >= m_arrayItemReaders.size()) {
+      m_arrayItemReaders.resize(id + 1, {nullptr, nullptr, nullptr, nullptr});
+    }
+    m_arrayItemReaders[id] = {
+      oatpp::Vector<Wrapper>::Class::getType(), &readArrayItem<Wrapper, V, parse>,
+      oatpp::Vector<oatpp::Inline<Wrapper>>::Class::getType(), &readArrayItem<oatpp::Inline<Wrapper>, V, parse>
+    };
+  }
+
+  ArrayItemReader getArrayItemReader(const Type* type) const;
+
   static oatpp::Void deserializeFloat32(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
   static oatpp::Void deserializeFloat64(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
   static oatpp::Void deserializeBoolean(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
@@ -241,9 +324,14 @@ private:
 
   static oatpp::Void deserializeObject(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
 
+private:
+  void setInlineDeserializerMethod(const data::mapping::type::ClassId& classId, InlineDeserializerMethod method);
+  void deserializeField(parser::Caret& caret, oatpp::BaseObject::Property* field, oatpp::BaseObject* object);
 private:
   std::shared_ptr<Config> m_config;
   std::vector<DeserializerMethod> m_methods;
+  std::vector<InlineDeserializerMethod> m_inlineMethods;
+  std::vector<ArrayItemReaders> m_arrayItemReaders;
 public:
 
   /**
@@ -253,7 +341,8 @@ public:
   Deserializer(const std::shared_ptr<Config>& config = std::make_shared<Config>());
 
   /**
-   * Set deserializer method for type.
+   * Set deserializer method for type. <br>
+   * Inline fields (&id:oatpp::data::mapping::type::Inline;) and `Vector` items of this type will be deserialized by this method too.
    * @param classId - &id:oatpp::data::mapping::type::ClassId;.
    * @param method - `typedef oatpp::Void (*DeserializerMethod)(Deserializer*, parser::Caret&, const Type* const)`.
    */
@@ -60,6 +60,14 @@ oatpp::Void ObjectMapper::read(oatpp::parser::Caret& caret,
   return m_deserializer->deserialize(caret, type);
 }
 
+std::shared_ptr<ObjectMapper::Reader> ObjectMapper::createReader(const oatpp::data::mapping::type::Type* const type) const {
+  return std::make_shared<StreamingDeserializer>(m_deserializer, type);
+}
+
+std::shared_ptr<ObjectMapper::Writer> ObjectMapper::createWriter(const oatpp::Void& variant) const {
+  return std::make_shared<StreamingSerializer>(m_serializer, variant);
+}
+
 std::shared_ptr<Serializer> ObjectMapper::getSerializer() {
   return m_serializer;
 }
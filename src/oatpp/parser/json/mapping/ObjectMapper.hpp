@@ -27,6 +27,8 @@
 
 #include "./Serializer.hpp"
 #include "./Deserializer.hpp"
+#include "./StreamingDeserializer.hpp"
+#include "./StreamingSerializer.hpp"
 
 #include "oatpp/core/data/mapping/ObjectMapper.hpp"
 
@@ -99,6 +101,21 @@ public:
    */
   oatpp::Void read(oatpp::parser::Caret& caret, const oatpp::data::mapping::type::Type* const type) const override;
 
+  /**
+   * Implementation of &id:oatpp::data::mapping::ObjectMapper::createReader;.
+   * Creates &id:oatpp::parser::json::mapping::StreamingDeserializer; - json is parsed as it arrives.
+   * @param type - type of resultant object &id:oatpp::data::mapping::type::Type;.
+   * @return - `std::shared_ptr` to &id:oatpp::data::mapping::ObjectMapper::Reader;.
+   */
+  std::shared_ptr<Reader> createReader(const oatpp::data::mapping::type::Type* const type) const override;
+
+  /**
+   * Implementation of &id:oatpp::data::mapping::ObjectMapper::createWriter;.
+   * Creates &id:oatpp::parser::json::mapping::StreamingSerializer; - json is produced chunk by chunk as it is read.
+   * @param variant - object to serialize &id:oatpp::Void;.
+   * @return - `std::shared_ptr` to &id:oatpp::data::mapping::ObjectMapper::Writer;.
+   */
+  std::shared_ptr<Writer> createWriter(const oatpp::Void& variant) const override;
 
   /**
    * Get serializer.
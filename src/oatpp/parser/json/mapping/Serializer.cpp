@@ -27,6 +27,8 @@
 #include "oatpp/parser/json/Utils.hpp"
 #include "oatpp/core/data/mapping/type/Any.hpp"
 
+#include <limits>
+
 namespace oatpp { namespace parser { namespace json { namespace mapping {
 
 Serializer::Serializer(const std::shared_ptr<Config>& config)
@@ -64,6 +66,22 @@ Serializer::Serializer(const std::shared_ptr<Config>& config)
   setSerializerMethod(data::mapping::type::__class::AbstractPairList::CLASS_ID, &Serializer::serializeMap);
   setSerializerMethod(data::mapping::type::__class::AbstractUnorderedMap::CLASS_ID, &Serializer::serializeMap);
 
+  setArrayWriters<oatpp::Int8>(data::mapping::type::__class::Int8::CLASS_ID);
+  setArrayWriters<oatpp::UInt8>(data::mapping::type::__class::UInt8::CLASS_ID);
+
+  setArrayWriters<oatpp::Int16>(data::mapping::type::__class::Int16::CLASS_ID);
+  setArrayWriters<oatpp::UInt16>(data::mapping::type::__class::UInt16::CLASS_ID);
+
+  setArrayWriters<oatpp::Int32>(data::mapping::type::__class::Int32::CLASS_ID);
+  setArrayWriters<oatpp::UInt32>(data::mapping::type::__class::UInt32::CLASS_ID);
+
+  setArrayWriters<oatpp::Int64>(data::mapping::type::__class::Int64::CLASS_ID);
+  setArrayWriters<oatpp::UInt64>(data::mapping::type::__class::UInt64::CLASS_ID);
+
+  setArrayWriters<oatpp::Float32>(data::mapping::type::__class::Float32::CLASS_ID);
+  setArrayWriters<oatpp::Float64>(data::mapping::type::__class::Float64::CLASS_ID);
+  setArrayWriters<oatpp::Boolean>(data::mapping::type::__class::Boolean::CLASS_ID);
+
 }
 
 void Serializer::setSerializerMethod(const data::mapping::type::ClassId& classId, SerializerMethod method) {
@@ -72,15 +90,45 @@ void Serializer::setSerializerMethod(const data::mapping::type::ClassId& classId
     m_methods.resize(id + 1, nullptr);
   }
   m_methods[id] = method;
+  if(id < m_arrayWriters.size()) {
+    m_arrayWriters[id] = {nullptr, nullptr, nullptr, nullptr}; // custom method takes over array items too
+  }
+}
+
+Serializer::ArrayWriter Serializer::getArrayWriter(const Type* type) const {
+  if(type->classId.id != data::mapping::type::__class::AbstractVector::CLASS_ID.id) {
+    return nullptr;
+  }
+  const v_uint32 itemId = type->params[0]->classId.id;
+  if(itemId >= m_arrayWriters.size()) {
+    return nullptr;
+  }
+  const ArrayWriters& writers = m_arrayWriters[itemId];
+  if(type == writers.vectorType) {
+    return writers.vectorWriter;
+  }
+  if(type == writers.inlineVectorType) {
+    return writers.inlineVectorWriter;
+  }
+  return nullptr;
 }
 
 void Serializer::serializeString(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size, v_uint32 escapeFlags) {
-  auto encodedValue = Utils::escapeString(data, size, escapeFlags);
   stream->writeCharSimple('\"');
-  stream->writeSimple(encodedValue);
+  Utils::escapeStringToStream(stream, data, size, escapeFlags);
   stream->writeCharSimple('\"');
 }
 
+std::string Serializer::encodeFieldName(const char* name, v_uint64 escapeFlags) {
+  auto encodedName = Utils::escapeString(name, std::strlen(name), (v_uint32) escapeFlags);
+  std::string result;
+  result.reserve(encodedName->size() + 3);
+  result.push_back('\"');
+  result.append(encodedName->data(), encodedName->size());
+  result.append("\":", 2);
+  return result;
+}
+
 void Serializer::serializeString(Serializer* serializer,
                                  data::stream::ConsistentOutputStream* stream,
                                  const oatpp::Void& polymorph)
@@ -146,13 +194,21 @@ void Serializer::serializeCollection(Serializer* serializer,
     return;
   }
 
+  stream->writeCharSimple('[');
+  bool first = true;
+
+  auto arrayWriter = serializer->getArrayWriter(polymorph.getValueType());
+  if(arrayWriter) {
+    v_buff_size position = 0;
+    arrayWriter(serializer, stream, polymorph.get(), position, std::numeric_limits<v_buff_size>::max(), first);
+    stream->writeCharSimple(']');
+    return;
+  }
+
   auto dispatcher = static_cast<const data::mapping::type::__class::Collection::PolymorphicDispatcher*>(
     polymorph.getValueType()->polymorphicDispatcher
   );
 
-  stream->writeCharSimple('[');
-  bool first = true;
-
   auto iterator = dispatcher->beginIteration(polymorph);
 
   while (!iterator->finished()) {
@@ -222,27 +278,28 @@ void Serializer::serializeObject(Serializer* serializer,
   stream->writeCharSimple('{');
 
   bool first = true;
+  auto config = serializer->m_config;
   auto dispatcher = static_cast<const oatpp::data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(
     polymorph.getValueType()->polymorphicDispatcher
   );
-  auto fields = dispatcher->getProperties()->getList();
+  const auto& fields = dispatcher->getProperties()->getEncodedProperties(&Serializer::encodeFieldName, config->escapeFlags);
   auto object = static_cast<oatpp::BaseObject*>(polymorph.get());
-  auto config = serializer->m_config;
 
-  for (auto const& field : fields) {
+  for (auto const& entry : fields) {
+
+    auto field = entry.property;
 
     oatpp::Void value;
     if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
       const auto& any = field->get(object).cast<oatpp::Any>();
       value = any.retrieve(field->info.typeSelector->selectType(object));
     } else {
-      value = field->get(object);
+      value = field->getView(object);
     }
 
     if (value || config->includeNullFields || (field->info.required && config->alwaysIncludeRequired)) {
       (first) ? first = false : stream->writeSimple(",", 1);
-      serializeString(stream, field->name, std::strlen(field->name), serializer->m_config->escapeFlags);
-      stream->writeSimple(":", 1);
+      stream->writeSimple(entry.encodedName.data(), entry.encodedName.size());
       serializer->serialize(stream, value);
     }
 
@@ -37,6 +37,7 @@ namespace oatpp { namespace parser { namespace json { namespace mapping {
  * Serializes oatpp DTO object to json. See [Data Transfer Object(DTO) component](https://oatpp.io/docs/components/dto/).
  */
 class Serializer {
+  friend class StreamingSerializer;
 public:
   typedef oatpp::data::mapping::type::Type Type;
   typedef oatpp::data::mapping::type::BaseObject::Property Property;
@@ -118,6 +119,89 @@ public:
   typedef void (*SerializerMethod)(Serializer*,
                                    data::stream::ConsistentOutputStream*,
                                    const oatpp::Void&);
+private:
+
+  /*
+   * Write up to `count` items of the typed array starting at `position`.
+   * Returns `true` when all items are written.
+   */
+  typedef bool (*ArrayWriter)(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const void* container,
+                              v_buff_size& position,
+                              v_buff_size count,
+                              bool& first);
+
+  /*
+   * Typed array writers for `Vector<T>` and `Vector<Inline<T>>` of primitive T.
+   */
+  struct ArrayWriters {
+    const Type* vectorType;
+    ArrayWriter vectorWriter;
+    const Type* inlineVectorType;
+    ArrayWriter inlineVectorWriter;
+  };
+
+  template<class Item>
+  struct ArrayItem {
+    static bool get(const Item& item, typename Item::UnderlyingType& value) {
+      if(item.get() == nullptr) return false;
+      value = *item.get();
+      return true;
+    }
+  };
+
+  template<class Wrapper>
+  struct ArrayItem<data::mapping::type::Inline<Wrapper>> {
+    static bool get(const data::mapping::type::Inline<Wrapper>& item, typename Wrapper::UnderlyingType& value) {
+      if(!item.hasValue()) return false;
+      value = *item;
+      return true;
+    }
+  };
+
+  /*
+   * Write primitives directly from the std::vector storage - no Void boxing and no virtual iterator calls.
+   */
+  template<class Item>
+  static bool writeArrayItems(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const void* container,
+                              v_buff_size& position,
+                              v_buff_size count,
+                              bool& first)
+  {
+    const auto& vector = *static_cast<const std::vector<Item>*>(container);
+    const bool includeNulls = serializer->m_config->includeNullFields || serializer->m_config->alwaysIncludeNullCollectionElements;
+    const v_buff_size size = (v_buff_size) vector.size();
+    const v_buff_size end = (count < size - position) ? position + count : size;
+    for(; position < end; position ++) {
+      typename Item::UnderlyingType value = typename Item::UnderlyingType();
+      if(ArrayItem<Item>::get(vector[position], value)) {
+        (first) ? first = false : stream->writeCharSimple(',');
+        stream->writeAsString(value);
+      } else if(includeNulls) {
+        (first) ? first = false : stream->writeCharSimple(',');
+        stream->writeSimple("null", 4);
+      }
+    }
+    return position == size;
+  }
+
+  template<class Wrapper>
+  void setArrayWriters(const data::mapping::type::ClassId& classId) {
+    const v_uint32 id = classId.id;
+    if(id >= m_arrayWriters.size()) {
+      m_arrayWriters.resize(id + 1, {nullptr, nullptr, nullptr, nullptr});
+    }
+    m_arrayWriters[id] = {
+      oatpp::Vector<Wrapper>::Class::getType(), &writeArrayItems<Wrapper>,
+      oatpp::Vector<oatpp::Inline<Wrapper>>::Class::getType(), &writeArrayItems<oatpp::Inline<Wrapper>>
+    };
+  }
+
+  ArrayWriter getArrayWriter(const Type* type) const;
+
 private:
 
   template<class T>
@@ -133,6 +217,12 @@ private:
     }
   }
   
+  /*
+   * Encode object field name as `"<escaped name>":`.
+   * Used to build the per-type table of pre-encoded field names - see BaseObject::Properties::getEncodedProperties().
+   */
+  static std::string encodeFieldName(const char* name, v_uint64 escapeFlags);
+
   static void serializeString(oatpp::data::stream::ConsistentOutputStream* stream,
                               const char* data,
                               v_buff_size size,
@@ -167,6 +257,7 @@ private:
 private:
   std::shared_ptr<Config> m_config;
   std::vector<SerializerMethod> m_methods;
+  std::vector<ArrayWriters> m_arrayWriters;
 public:
 
   /**
@@ -176,7 +267,8 @@ public:
   Serializer(const std::shared_ptr<Config>& config = std::make_shared<Config>());
 
   /**
-   * Set serializer method for type.
+   * Set serializer method for type. <br>
+   * Typed-array fast path for `Vector` of this type is disabled - items are serialized with this method.
    * @param classId - &id:oatpp::data::mapping::type::ClassId;.
    * @param method - `typedef void (*SerializerMethod)(Serializer*, data::stream::ConsistentOutputStream*, const oatpp::Void&)`.
    */
@@ -0,0 +1,582 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "StreamingDeserializer.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace parser { namespace json { namespace mapping {
+
+StreamingDeserializer::StreamingDeserializer(const std::shared_ptr<Deserializer>& deserializer, const Type* type)
+  : m_deserializer(deserializer)
+  , m_type(type)
+  , m_state(STATE_VALUE)
+  , m_position(0)
+  , m_cursor(0)
+  , m_valueMode(VALUE_TYPED)
+  , m_valueType(type)
+  , m_captureKind(CAPTURE_TOKEN)
+  , m_captureDepth(0)
+  , m_captureInString(false)
+  , m_captureEscape(false)
+{}
+
+void StreamingDeserializer::fail(const oatpp::String& message, v_int64 code) {
+  if(m_state != STATE_ERROR) {
+    setError(message, code, m_cursor);
+    m_state = STATE_ERROR;
+    m_stack.clear();
+    m_capture.clear();
+  }
+}
+
+bool StreamingDeserializer::isStructural(const Type* type, FrameKind& kind) const {
+
+  const auto& methods = m_deserializer->m_methods;
+  const v_uint32 id = type->classId.id;
+  if(id >= methods.size()) {
+    return false;
+  }
+
+  auto method = methods[id];
+  if(method == &Deserializer::deserializeObject) {
+    kind = FRAME_OBJECT;
+    return true;
+  }
+  if(method == &Deserializer::deserializeCollection) {
+    kind = FRAME_COLLECTION;
+    return true;
+  }
+  if(method == &Deserializer::deserializeMap) {
+    kind = FRAME_MAP;
+    return true;
+  }
+
+  return false;
+
+}
+
+void StreamingDeserializer::expectValue(ValueMode mode, const Type* type) {
+  m_valueMode = mode;
+  m_valueType = type;
+  m_state = STATE_VALUE;
+}
+
+void StreamingDeserializer::beginCapture(char c) {
+  if(c == '"') {
+    m_captureKind = CAPTURE_STRING;
+  } else if(c == '{' || c == '[') {
+    m_captureKind = CAPTURE_SCOPE;
+  } else {
+    m_captureKind = CAPTURE_TOKEN;
+  }
+  m_captureDepth = 0;
+  m_captureInString = false;
+  m_captureEscape = false;
+  m_capture.clear();
+  m_state = STATE_CAPTURE;
+}
+
+bool StreamingDeserializer::startValue(char c) {
+
+  if(m_valueMode == VALUE_TYPED) {
+    FrameKind kind;
+    if(isStructural(m_valueType, kind) && c == (kind == FRAME_COLLECTION ? '[' : '{')) {
+      pushFrame(kind, m_valueType);
+      return true;
+    }
+  }
+
+  beginCapture(c);
+  return false;
+
+}
+
+void StreamingDeserializer::pushFrame(FrameKind kind, const Type* type) {
+
+  Frame frame;
+  frame.kind = kind;
+  frame.type = type;
+  frame.dispatcher = type->polymorphicDispatcher;
+  frame.fieldsIndex = nullptr;
+  frame.predictedIndex = -1;
+  frame.field = nullptr;
+  frame.itemType = nullptr;
+  frame.itemReader = nullptr;
+
+  switch(kind) {
+
+    case FRAME_OBJECT: {
+      auto dispatcher = static_cast<const data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(frame.dispatcher);
+      frame.value = dispatcher->createObject();
+      frame.fieldsIndex = &dispatcher->getProperties()->getNameIndex();
+      frame.predictedIndex = m_deserializer->getConfig()->predictFieldsOrder ? 0 : -1;
+      m_state = STATE_OBJECT_KEY;
+      break;
+    }
+
+    case FRAME_COLLECTION: {
+      auto dispatcher = static_cast<const data::mapping::type::__class::Collection::PolymorphicDispatcher*>(frame.dispatcher);
+      frame.value = dispatcher->createObject();
+      frame.itemType = dispatcher->getItemType();
+      frame.itemReader = m_deserializer->getArrayItemReader(type);
+      m_state = STATE_ARRAY_VALUE;
+      break;
+    }
+
+    case FRAME_MAP: {
+      auto dispatcher = static_cast<const data::mapping::type::__class::Map::PolymorphicDispatcher*>(frame.dispatcher);
+      if(dispatcher->getKeyType()->classId != oatpp::String::Class::CLASS_ID){
+        throw std::runtime_error("[oatpp::parser::json::mapping::StreamingDeserializer::pushFrame()]: Invalid json map key. Key should be String");
+      }
+      frame.value = dispatcher->createObject();
+      frame.itemType = dispatcher->getValueType();
+      m_state = STATE_OBJECT_KEY;
+      break;
+    }
+
+  }
+
+  m_stack.push_back(std::move(frame));
+
+}
+
+void StreamingDeserializer::popFrame() {
+
+  Frame frame = std::move(m_stack.back());
+  m_stack.pop_back();
+
+  if(frame.kind == FRAME_OBJECT) {
+    auto object = static_cast<oatpp::BaseObject*>(frame.value.get());
+    for(auto& p : frame.polymorphs) {
+      parser::Caret polyCaret(p.second);
+      auto selectedType = p.first->info.typeSelector->selectType(object);
+      auto value = m_deserializer->deserialize(polyCaret, selectedType);
+      oatpp::Any any(value);
+      p.first->set(object, oatpp::Void(any.getPtr(), p.first->type));
+    }
+  }
+
+  onValue(frame.value);
+
+}
+
+void StreamingDeserializer::afterValue() {
+  if(m_stack.empty()) {
+    m_state = STATE_DONE;
+  } else if(m_stack.back().kind == FRAME_COLLECTION) {
+    m_state = STATE_ARRAY_NEXT;
+  } else {
+    m_state = STATE_OBJECT_NEXT;
+  }
+}
+
+void StreamingDeserializer::onValue(const oatpp::Void& value) {
+
+  if(m_stack.empty()) {
+    m_result = value;
+    m_state = STATE_DONE;
+    return;
+  }
+
+  Frame& frame = m_stack.back();
+
+  switch(frame.kind) {
+
+    case FRAME_OBJECT:
+      frame.field->set(static_cast<oatpp::BaseObject*>(frame.value.get()), value);
+      break;
+
+    case FRAME_COLLECTION:
+      static_cast<const data::mapping::type::__class::Collection::PolymorphicDispatcher*>(frame.dispatcher)
+        ->addItem(frame.value, value);
+      break;
+
+    case FRAME_MAP:
+      static_cast<const data::mapping::type::__class::Map::PolymorphicDispatcher*>(frame.dispatcher)
+        ->addItem(frame.value, frame.key, value);
+      break;
+
+  }
+
+  afterValue();
+
+}
+
+void StreamingDeserializer::onCaptured(const char* data, v_buff_size size) {
+  switch(m_valueMode) {
+
+    case VALUE_TYPED:
+      onLeaf(data, size);
+      break;
+
+    case VALUE_KEY:
+      onKey(data, size);
+      break;
+
+    case VALUE_RAW:
+      m_stack.back().polymorphs.emplace_back(m_stack.back().field, oatpp::String(data, size));
+      afterValue();
+      break;
+
+    case VALUE_SKIP:
+      afterValue();
+      break;
+
+  }
+}
+
+void StreamingDeserializer::onKey(const char* data, v_buff_size size) {
+
+  /* strip quotes */
+  const char* key = data + 1;
+  v_buff_size keySize = size - 2;
+
+  Frame& frame = m_stack.back();
+
+  if(frame.kind == FRAME_MAP) {
+    v_int64 errorCode;
+    v_buff_size errorPosition;
+    frame.key = Utils::unescapeString(key, keySize, errorCode, errorPosition);
+    if(errorCode != 0) {
+      fail("[oatpp::parser::json::mapping::StreamingDeserializer::onKey()]: Error. Call to unescapeString() failed", errorCode);
+      return;
+    }
+    m_state = STATE_OBJECT_COLON;
+    return;
+  }
+
+  const auto& index = *frame.fieldsIndex;
+  v_int32 fieldIndex;
+
+  if(std::memchr(key, '\\', keySize) == nullptr) {
+    fieldIndex = index.matches(frame.predictedIndex, key, keySize) ? frame.predictedIndex : index.findIndex(key, keySize);
+  } else {
+    v_int64 errorCode;
+    v_buff_size errorPosition;
+    const std::string& unescaped = Utils::unescapeStringToStdString(key, keySize, errorCode, errorPosition);
+    if(errorCode != 0) {
+      fail("[oatpp::parser::json::mapping::StreamingDeserializer::onKey()]: Error. Call to unescapeStringToStdString() failed", errorCode);
+      return;
+    }
+    fieldIndex = index.findIndex(unescaped.data(), (v_buff_size) unescaped.size());
+  }
+
+  if(fieldIndex >= 0) {
+    if(frame.predictedIndex >= 0) {
+      frame.predictedIndex = fieldIndex + 1;
+    }
+    frame.field = index.getEntry(fieldIndex).property;
+  } else if(m_deserializer->getConfig()->allowUnknownFields) {
+    frame.field = nullptr;
+  } else {
+    fail("[oatpp::parser::json::mapping::StreamingDeserializer::onKey()]: Error. Unknown field", Deserializer::ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+    return;
+  }
+
+  m_state = STATE_OBJECT_COLON;
+
+}
+
+void StreamingDeserializer::onLeaf(const char* data, v_buff_size size) {
+
+  parser::Caret caret(data, size);
+
+  /* inline fields and typed array items are set in place - no boxed value is passed around */
+  Frame* parent = m_stack.empty() ? nullptr : &m_stack.back();
+  const bool inlineField = parent && parent->kind == FRAME_OBJECT && parent->field->isInline();
+  const bool arrayItem = parent && parent->kind == FRAME_COLLECTION && parent->itemReader;
+
+  oatpp::Void value;
+  if(inlineField) {
+    m_deserializer->deserializeField(caret, parent->field, static_cast<oatpp::BaseObject*>(parent->value.get()));
+  } else if(arrayItem) {
+    parent->itemReader(caret, parent->value.get());
+  } else {
+    value = m_deserializer->deserialize(caret, m_valueType);
+  }
+
+  if(caret.hasError()) {
+    fail(caret.getErrorMessage(), caret.getErrorCode());
+    return;
+  }
+
+  caret.skipBlankChars();
+  if(caret.canContinue()) {
+    fail("[oatpp::parser::json::mapping::StreamingDeserializer::onLeaf()]: Error. Unexpected characters after value", 0);
+    return;
+  }
+
+  if(inlineField || arrayItem) {
+    afterValue();
+    return;
+  }
+
+  onValue(value);
+
+}
+
+v_buff_size StreamingDeserializer::capture(const char* data, v_buff_size size, bool& done) {
+
+  v_buff_size i = 0;
+
+  switch(m_captureKind) {
+
+    case CAPTURE_STRING:
+      while(i < size) {
+        char c = data[i ++];
+        if(m_captureEscape) {
+          m_captureEscape = false;
+        } else if(c == '\\') {
+          m_captureEscape = true;
+        } else if(c == '"') {
+          if(m_captureDepth > 0) {
+            done = true;
+            return i;
+          }
+          m_captureDepth = 1;
+        }
+      }
+      break;
+
+    case CAPTURE_SCOPE:
+      while(i < size) {
+        char c = data[i ++];
+        if(m_captureInString) {
+          if(m_captureEscape) {
+            m_captureEscape = false;
+          } else if(c == '\\') {
+            m_captureEscape = true;
+          } else if(c == '"') {
+            m_captureInString = false;
+          }
+        } else if(c == '"') {
+          m_captureInString = true;
+        } else if(c == '{' || c == '[') {
+          m_captureDepth ++;
+        } else if(c == '}' || c == ']') {
+          m_captureDepth --;
+          if(m_captureDepth == 0) {
+            done = true;
+            return i;
+          }
+        }
+      }
+      break;
+
+    case CAPTURE_TOKEN:
+      while(i < size) {
+        char c = data[i];
+        if(c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',' || c == '}' || c == ']') {
+          done = true;
+          return i;
+        }
+        i ++;
+      }
+      break;
+
+  }
+
+  return i;
+
+}
+
+bool StreamingDeserializer::step(char c) {
+
+  switch(m_state) {
+
+    case STATE_VALUE:
+      return startValue(c);
+
+    case STATE_OBJECT_KEY:
+      if(c == '"') {
+        m_valueMode = VALUE_KEY;
+        beginCapture(c);
+        return false;
+      }
+      if(c == '}') {
+        popFrame();
+        return true;
+      }
+      fail("[oatpp::parser::json::mapping::StreamingDeserializer::step()]: Error. '\"' - expected", Utils::ERROR_CODE_PARSER_QUOTE_EXPECTED);
+      return true;
+
+    case STATE_OBJECT_COLON: {
+      if(c != ':') {
+        fail("[oatpp::parser::json::mapping::StreamingDeserializer::step()]: Error. ':' - expected", Deserializer::ERROR_CODE_OBJECT_SCOPE_COLON_MISSING);
+        return true;
+      }
+      const Frame& frame = m_stack.back();
+      if(frame.kind == FRAME_MAP) {
+        expectValue(VALUE_TYPED, frame.itemType);
+      } else if(frame.field == nullptr) {
+        expectValue(VALUE_SKIP, nullptr);
+      } else if(frame.field->info.typeSelector && frame.field->type == oatpp::Any::Class::getType()) {
+        expectValue(VALUE_RAW, nullptr);
+      } else {
+        expectValue(VALUE_TYPED, frame.field->type);
+      }
+      return true;
+    }
+
+    case STATE_OBJECT_NEXT:
+      if(c == ',') {
+        m_state = STATE_OBJECT_KEY;
+        return true;
+      }
+      if(c == '}') {
+        popFrame();
+        return true;
+      }
+      if(c == '"') {
+        m_state = STATE_OBJECT_KEY;
+        return false;
+      }
+      fail("[oatpp::parser::json::mapping::StreamingDeserializer::step()]: Error. '}' - expected", Deserializer::ERROR_CODE_OBJECT_SCOPE_CLOSE);
+      return true;
+
+    case STATE_ARRAY_VALUE:
+      if(c == ']') {
+        popFrame();
+        return true;
+      }
+      expectValue(VALUE_TYPED, m_stack.back().itemType);
+      return false;
+
+    case STATE_ARRAY_NEXT:
+      if(c == ',') {
+        m_state = STATE_ARRAY_VALUE;
+        return true;
+      }
+      if(c == ']') {
+        popFrame();
+        return true;
+      }
+      m_state = STATE_ARRAY_VALUE;
+      return false;
+
+    default:
+      return true;
+
+  }
+
+}
+
+void StreamingDeserializer::process(const char* data, v_buff_size size) {
+
+  const char* p = data;
+  const char* end = data + size;
+
+  while(p < end) {
+
+    m_cursor = m_position + (p - data);
+
+    if(m_state == STATE_DONE || m_state == STATE_ERROR) {
+      return;
+    }
+
+    if(m_state == STATE_CAPTURE) {
+
+      bool done = false;
+      v_buff_size count = capture(p, end - p, done);
+      const bool keep = (m_valueMode != VALUE_SKIP);
+
+      if(done) {
+        if(m_capture.empty()) {
+          onCaptured(p, count);
+        } else {
+          if(keep) m_capture.append(p, (size_t) count);
+          onCaptured(m_capture.data(), (v_buff_size) m_capture.size());
+          m_capture.clear();
+        }
+      } else if(keep) {
+        m_capture.append(p, (size_t) count);
+      }
+
+      p += count;
+      continue;
+
+    }
+
+    char c = *p;
+    if(c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+      p ++;
+      continue;
+    }
+
+    if(step(c)) {
+      p ++;
+    }
+
+  }
+
+}
+
+v_io_size StreamingDeserializer::write(const void *data, v_buff_size count, async::Action& action) {
+  (void) action;
+  data::mapping::Arena::Scope arenaScope(m_arena);
+  process((const char*) data, count);
+  m_position += count;
+  return count;
+}
+
+oatpp::Void StreamingDeserializer::finish() {
+
+  data::mapping::Arena::Scope arenaScope(m_arena);
+
+  m_cursor = m_position;
+
+  if(m_state == STATE_CAPTURE) {
+    if(m_captureKind == CAPTURE_TOKEN || m_valueMode == VALUE_TYPED) {
+      /* end of data terminates a token. Incomplete strings and scopes will fail in Deserializer */
+      std::string captured;
+      captured.swap(m_capture);
+      onCaptured(captured.data(), (v_buff_size) captured.size());
+    } else {
+      fail("[oatpp::parser::json::mapping::StreamingDeserializer::finish()]: Error. Unexpected end of data", 0);
+    }
+  } else if(m_state == STATE_VALUE && m_stack.empty()) {
+    /* no value at all - let Deserializer report it */
+    onLeaf("", 0);
+  }
+
+  if(m_state == STATE_ERROR) {
+    return nullptr;
+  }
+
+  if(!m_stack.empty()) {
+    if(m_stack.back().kind == FRAME_COLLECTION) {
+      fail("[oatpp::parser::json::mapping::StreamingDeserializer::finish()]: Error. ']' - expected", Deserializer::ERROR_CODE_ARRAY_SCOPE_CLOSE);
+    } else {
+      fail("[oatpp::parser::json::mapping::StreamingDeserializer::finish()]: Error. '}' - expected", Deserializer::ERROR_CODE_OBJECT_SCOPE_CLOSE);
+    }
+    return nullptr;
+  }
+
+  return m_result;
+
+}
+
+}}}}
@@ -0,0 +1,159 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_json_mapping_StreamingDeserializer_hpp
+#define oatpp_parser_json_mapping_StreamingDeserializer_hpp
+
+#include "./Deserializer.hpp"
+
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+
+#include <string>
+#include <vector>
+
+namespace oatpp { namespace parser { namespace json { namespace mapping {
+
+/**
+ * Incremental json deserializer. <br>
+ * Consumes json chunk by chunk and keeps all parser state between chunks, so it can be fed directly
+ * by synchronous and asynchronous body decoders. Objects, collections and maps are built as data arrives.
+ * Leaf values (strings, numbers, &id:oatpp::Any;, enums, interpretations, etc.) are buffered only while incomplete
+ * and then deserialized with the regular &id:oatpp::parser::json::mapping::Deserializer; -
+ * so peak memory is bounded by the largest leaf value instead of the whole document. <br>
+ * Extends &id:oatpp::data::mapping::ObjectMapper::Reader;.
+ */
+class StreamingDeserializer : public oatpp::base::Countable, public oatpp::data::mapping::ObjectMapper::Reader {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+  typedef oatpp::data::mapping::type::BaseObject::Property Property;
+  typedef oatpp::data::mapping::type::BaseObject::Properties Properties;
+private:
+
+  enum State : v_int32 {
+    STATE_VALUE,
+    STATE_CAPTURE,
+    STATE_OBJECT_KEY,
+    STATE_OBJECT_COLON,
+    STATE_OBJECT_NEXT,
+    STATE_ARRAY_VALUE,
+    STATE_ARRAY_NEXT,
+    STATE_DONE,
+    STATE_ERROR
+  };
+
+  enum FrameKind : v_int32 {
+    FRAME_OBJECT,
+    FRAME_COLLECTION,
+    FRAME_MAP
+  };
+
+  enum ValueMode : v_int32 {
+    VALUE_TYPED,
+    VALUE_RAW,
+    VALUE_SKIP,
+    VALUE_KEY
+  };
+
+  enum CaptureKind : v_int32 {
+    CAPTURE_STRING,
+    CAPTURE_SCOPE,
+    CAPTURE_TOKEN
+  };
+
+  struct Frame {
+    FrameKind kind;
+    const Type* type;
+    oatpp::Void value;
+    const void* dispatcher;
+    const Properties::NameIndex* fieldsIndex;
+    v_int32 predictedIndex;
+    Property* field;
+    oatpp::String key;
+    const Type* itemType;
+    Deserializer::ArrayItemReader itemReader;
+    std::vector<std::pair<Property*, oatpp::String>> polymorphs;
+  };
+
+private:
+  std::shared_ptr<Deserializer> m_deserializer;
+  const Type* m_type;
+  State m_state;
+  std::vector<Frame> m_stack;
+  oatpp::Void m_result;
+  v_buff_size m_position;
+  v_buff_size m_cursor;
+private:
+  ValueMode m_valueMode;
+  const Type* m_valueType;
+private:
+  CaptureKind m_captureKind;
+  v_int32 m_captureDepth;
+  bool m_captureInString;
+  bool m_captureEscape;
+  std::string m_capture;
+private:
+  void fail(const oatpp::String& message, v_int64 code);
+  bool isStructural(const Type* type, FrameKind& kind) const;
+  void expectValue(ValueMode mode, const Type* type);
+  void beginCapture(char c);
+  bool startValue(char c);
+  void pushFrame(FrameKind kind, const Type* type);
+  void popFrame();
+  void afterValue();
+  void onValue(const oatpp::Void& value);
+  void onCaptured(const char* data, v_buff_size size);
+  void onKey(const char* data, v_buff_size size);
+  void onLeaf(const char* data, v_buff_size size);
+  v_buff_size capture(const char* data, v_buff_size size, bool& done);
+  bool step(char c);
+  void process(const char* data, v_buff_size size);
+public:
+
+  /**
+   * Constructor.
+   * @param deserializer - &id:oatpp::parser::json::mapping::Deserializer; used for config and for leaf values.
+   * @param type - type of the resultant object.
+   */
+  StreamingDeserializer(const std::shared_ptr<Deserializer>& deserializer, const Type* type);
+
+  /**
+   * Consume next chunk of json.
+   * @param data - pointer to data.
+   * @param count - size of the data in bytes.
+   * @param action - not used. Reader never waits.
+   * @return - always `count`.
+   */
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
+
+  /**
+   * Signal end of json and get the deserialized object.
+   * @return - deserialized object wrapped in &id:oatpp::Void;. `nullptr` in case of error.
+   */
+  oatpp::Void finish() override;
+
+};
+
+}}}}
+
+#endif /* oatpp_parser_json_mapping_StreamingDeserializer_hpp */
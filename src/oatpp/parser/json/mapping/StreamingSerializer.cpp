@@ -0,0 +1,263 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "StreamingSerializer.hpp"
+
+#include "oatpp/core/data/mapping/type/Any.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace parser { namespace json { namespace mapping {
+
+StreamingSerializer::StreamingSerializer(const std::shared_ptr<Serializer>& serializer, const oatpp::Void& variant)
+  : m_serializer(serializer)
+  , m_root(variant)
+  , m_started(false)
+  , m_finished(false)
+  , m_bufferPosition(0)
+  , m_stream(&m_buffer)
+{
+  if(m_serializer->getConfig()->useBeautifier) {
+    m_beautifier.reset(new Beautifier(&m_buffer, "  ", "\n"));
+    m_stream = m_beautifier.get();
+  }
+}
+
+bool StreamingSerializer::isStructural(const Type* type, FrameKind& kind) const {
+
+  const auto& methods = m_serializer->m_methods;
+  const v_uint32 id = type->classId.id;
+  if(id >= methods.size()) {
+    return false;
+  }
+
+  auto method = methods[id];
+  if(method == &Serializer::serializeObject) {
+    kind = FRAME_OBJECT;
+    return true;
+  }
+  if(method == &Serializer::serializeCollection) {
+    kind = FRAME_COLLECTION;
+    return true;
+  }
+  if(method == &Serializer::serializeMap) {
+    kind = FRAME_MAP;
+    return true;
+  }
+
+  return false;
+
+}
+
+void StreamingSerializer::writeValue(const oatpp::Void& value) {
+
+  /* null values go through the serializer too - type-specific constraints (ex.: Enum NotNull) are checked there */
+  if(!value) {
+    m_serializer->serialize(m_stream, value);
+    return;
+  }
+
+  const auto& methods = m_serializer->m_methods;
+  const v_uint32 id = value.getValueType()->classId.id;
+  if(id < methods.size() && methods[id] == &Serializer::serializeAny) {
+    auto anyHandle = static_cast<data::mapping::type::AnyHandle*>(value.get());
+    writeValue(oatpp::Void(anyHandle->ptr, anyHandle->type));
+    return;
+  }
+
+  FrameKind kind;
+  if(!isStructural(value.getValueType(), kind)) {
+    m_serializer->serialize(m_stream, value);
+    return;
+  }
+
+  Frame frame;
+  frame.kind = kind;
+  frame.value = value;
+  frame.fields = nullptr;
+  frame.fieldIndex = 0;
+  frame.arrayWriter = nullptr;
+  frame.arrayPosition = 0;
+  frame.first = true;
+
+  const void* dispatcher = value.getValueType()->polymorphicDispatcher;
+
+  switch(kind) {
+
+    case FRAME_OBJECT:
+      frame.fields = &static_cast<const data::mapping::type::__class::AbstractObject::PolymorphicDispatcher*>(dispatcher)
+        ->getProperties()->getEncodedProperties(&Serializer::encodeFieldName, m_serializer->getConfig()->escapeFlags);
+      m_stream->writeCharSimple('{');
+      break;
+
+    case FRAME_COLLECTION:
+      frame.arrayWriter = m_serializer->getArrayWriter(value.getValueType());
+      if(!frame.arrayWriter) {
+        frame.collectionIterator = static_cast<const data::mapping::type::__class::Collection::PolymorphicDispatcher*>(dispatcher)
+          ->beginIteration(value);
+      }
+      m_stream->writeCharSimple('[');
+      break;
+
+    case FRAME_MAP: {
+      auto mapDispatcher = static_cast<const data::mapping::type::__class::Map::PolymorphicDispatcher*>(dispatcher);
+      if(mapDispatcher->getKeyType()->classId != oatpp::String::Class::CLASS_ID){
+        throw std::runtime_error("[oatpp::parser::json::mapping::StreamingSerializer::writeValue()]: Invalid json map key. Key should be String");
+      }
+      frame.mapIterator = mapDispatcher->beginIteration(value);
+      m_stream->writeCharSimple('{');
+      break;
+    }
+
+  }
+
+  m_stack.push_back(std::move(frame));
+
+}
+
+void StreamingSerializer::writeSeparator(Frame& frame) {
+  if(frame.first) {
+    frame.first = false;
+  } else {
+    m_stream->writeCharSimple(',');
+  }
+}
+
+void StreamingSerializer::produce() {
+
+  if(m_stack.empty()) {
+    if(m_started) {
+      m_finished = true;
+    } else {
+      m_started = true;
+      writeValue(m_root);
+    }
+    return;
+  }
+
+  const auto& config = m_serializer->getConfig();
+  Frame& frame = m_stack.back();
+
+  /* Take the value and advance the frame before writing -
+   * writing a structural value pushes a new frame and invalidates the reference. */
+
+  switch(frame.kind) {
+
+    case FRAME_OBJECT: {
+      auto object = static_cast<oatpp::BaseObject*>(frame.value.get());
+      while(frame.fieldIndex < frame.fields->size()) {
+        const auto& entry = (*frame.fields)[frame.fieldIndex ++];
+        auto field = entry.property;
+        oatpp::Void value;
+        if(field->info.typeSelector && field->type == oatpp::Any::Class::getType()) {
+          const auto& any = field->get(object).cast<oatpp::Any>();
+          value = any.retrieve(field->info.typeSelector->selectType(object));
+        } else {
+          value = field->getView(object);
+        }
+        if (value || config->includeNullFields || (field->info.required && config->alwaysIncludeRequired)) {
+          writeSeparator(frame);
+          m_stream->writeSimple(entry.encodedName.data(), entry.encodedName.size());
+          writeValue(value);
+          return;
+        }
+      }
+      m_stream->writeCharSimple('}');
+      break;
+    }
+
+    case FRAME_COLLECTION: {
+      if(frame.arrayWriter) {
+        if(!frame.arrayWriter(m_serializer.get(), m_stream, frame.value.get(), frame.arrayPosition, ARRAY_BATCH_SIZE, frame.first)) {
+          return;
+        }
+        m_stream->writeCharSimple(']');
+        break;
+      }
+      auto& iterator = frame.collectionIterator;
+      while(!iterator->finished()) {
+        oatpp::Void value = iterator->get();
+        iterator->next();
+        if(value || config->includeNullFields || config->alwaysIncludeNullCollectionElements) {
+          writeSeparator(frame);
+          writeValue(value);
+          return;
+        }
+      }
+      m_stream->writeCharSimple(']');
+      break;
+    }
+
+    case FRAME_MAP: {
+      auto& iterator = frame.mapIterator;
+      while(!iterator->finished()) {
+        oatpp::Void value = iterator->getValue();
+        if(value || config->includeNullFields || config->alwaysIncludeNullCollectionElements) {
+          writeSeparator(frame);
+          const auto& untypedKey = iterator->getKey();
+          const auto& key = oatpp::String(std::static_pointer_cast<std::string>(untypedKey.getPtr()));
+          Serializer::serializeString(m_stream, key->data(), key->size(), config->escapeFlags);
+          m_stream->writeCharSimple(':');
+          iterator->next();
+          writeValue(value);
+          return;
+        }
+        iterator->next();
+      }
+      m_stream->writeCharSimple('}');
+      break;
+    }
+
+  }
+
+  m_stack.pop_back();
+
+}
+
+v_io_size StreamingSerializer::read(void *buffer, v_buff_size count, async::Action& action) {
+
+  (void) action;
+
+  while(m_buffer.getCurrentPosition() - m_bufferPosition < count && !m_finished) {
+    produce();
+  }
+
+  v_buff_size available = m_buffer.getCurrentPosition() - m_bufferPosition;
+  v_buff_size size = available < count ? available : count;
+
+  if(size > 0) {
+    std::memcpy(buffer, m_buffer.getData() + m_bufferPosition, size);
+    m_bufferPosition += size;
+    if(m_bufferPosition == m_buffer.getCurrentPosition()) {
+      m_buffer.setCurrentPosition(0);
+      m_bufferPosition = 0;
+    }
+  }
+
+  return size;
+
+}
+
+}}}}
@@ -0,0 +1,113 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_parser_json_mapping_StreamingSerializer_hpp
+#define oatpp_parser_json_mapping_StreamingSerializer_hpp
+
+#include "./Serializer.hpp"
+
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace parser { namespace json { namespace mapping {
+
+/**
+ * Incremental json serializer. <br>
+ * Produces json chunk by chunk on &l:StreamingSerializer::read (); calls, keeping a resumable traversal stack
+ * of objects, collections and maps. Leaf values are serialized with the regular &id:oatpp::parser::json::mapping::Serializer;,
+ * so memory is bounded by the requested chunk size plus the largest leaf value. <br>
+ * Extends &id:oatpp::data::mapping::ObjectMapper::Writer;.
+ */
+class StreamingSerializer : public oatpp::base::Countable, public oatpp::data::mapping::ObjectMapper::Writer {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+  typedef oatpp::data::mapping::type::BaseObject::Properties Properties;
+private:
+
+  /*
+   * Number of typed array items written per produce() call.
+   */
+  static constexpr v_buff_size ARRAY_BATCH_SIZE = 256;
+
+
+  enum FrameKind : v_int32 {
+    FRAME_OBJECT,
+    FRAME_COLLECTION,
+    FRAME_MAP
+  };
+
+  struct Frame {
+    FrameKind kind;
+    oatpp::Void value;
+    const std::vector<Properties::EncodedProperty>* fields;
+    size_t fieldIndex;
+    std::unique_ptr<oatpp::data::mapping::type::__class::Collection::Iterator> collectionIterator;
+    std::unique_ptr<oatpp::data::mapping::type::__class::Map::Iterator> mapIterator;
+    Serializer::ArrayWriter arrayWriter;
+    v_buff_size arrayPosition;
+    bool first;
+  };
+
+private:
+  std::shared_ptr<Serializer> m_serializer;
+  oatpp::Void m_root;
+  bool m_started;
+  bool m_finished;
+  std::vector<Frame> m_stack;
+private:
+  oatpp::data::stream::BufferOutputStream m_buffer;
+  v_buff_size m_bufferPosition;
+  std::unique_ptr<Beautifier> m_beautifier;
+  oatpp::data::stream::ConsistentOutputStream* m_stream;
+private:
+  bool isStructural(const Type* type, FrameKind& kind) const;
+  void writeValue(const oatpp::Void& value);
+  void writeSeparator(Frame& frame);
+  void produce();
+public:
+
+  /**
+   * Constructor.
+   * @param serializer - &id:oatpp::parser::json::mapping::Serializer; used for config and for leaf values.
+   * @param variant - object to serialize.
+   */
+  StreamingSerializer(const std::shared_ptr<Serializer>& serializer, const oatpp::Void& variant);
+
+  /**
+   * Read next chunk of json.
+   * @param buffer - pointer to buffer.
+   * @param count - size of the buffer in bytes.
+   * @param action - not used. Serializer never waits.
+   * @return - actual number of bytes written to buffer. 0 - to indicate end-of-file.
+   */
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
+
+};
+
+}}}}
+
+#endif /* oatpp_parser_json_mapping_StreamingSerializer_hpp */
@@ -61,6 +61,10 @@ v_io_size HttpRequestExecutor::ConnectionProxy::write(const void *data, v_buff_s
   return m_connectionHandle.object->write(data,count, action);
 }
 
+v_io_size HttpRequestExecutor::ConnectionProxy::writev(const data::stream::IOVector* vectors, v_buff_size count, async::Action& action) {
+  return m_connectionHandle.object->writev(vectors, count, action);
+}
+
 void HttpRequestExecutor::ConnectionProxy::setInputStreamIOMode(data::stream::IOMode ioMode) {
   m_connectionHandle.object->setInputStreamIOMode(ioMode);
 }
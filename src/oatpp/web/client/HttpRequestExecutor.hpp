@@ -59,6 +59,7 @@ public:
 
     v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
     v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
+    v_io_size writev(const data::stream::IOVector* vectors, v_buff_size count, async::Action& action) override;
 
     void setInputStreamIOMode(data::stream::IOMode ioMode) override;
     data::stream::IOMode getInputStreamIOMode() override;
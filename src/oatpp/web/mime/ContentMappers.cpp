@@ -0,0 +1,101 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ContentMappers.hpp"
+
+namespace oatpp { namespace web { namespace mime {
+
+ContentMappers::ContentMappers(const std::shared_ptr<ObjectMapper>& defaultMapper) {
+  if(defaultMapper) {
+    setDefaultMapper(defaultMapper);
+  }
+}
+
+std::shared_ptr<ContentMappers> ContentMappers::createShared(const std::shared_ptr<ObjectMapper>& defaultMapper) {
+  return std::make_shared<ContentMappers>(defaultMapper);
+}
+
+void ContentMappers::putMapper(const std::shared_ptr<ObjectMapper>& mapper) {
+  if(!mapper) {
+    throw std::runtime_error("[oatpp::web::mime::ContentMappers::putMapper()]: Error. Mapper is null.");
+  }
+  m_mappers[oatpp::String(mapper->getInfo().http_content_type)] = mapper;
+}
+
+void ContentMappers::setDefaultMapper(const std::shared_ptr<ObjectMapper>& mapper) {
+  putMapper(mapper);
+  m_defaultMapper = mapper;
+}
+
+std::shared_ptr<ContentMappers::ObjectMapper> ContentMappers::getMapper(const oatpp::String& contentType) const {
+  if(!contentType) {
+    return nullptr;
+  }
+  auto it = m_mappers.find(contentType);
+  if(it != m_mappers.end()) {
+    return it->second;
+  }
+  return nullptr;
+}
+
+const std::shared_ptr<ContentMappers::ObjectMapper>& ContentMappers::getDefaultMapper() const {
+  return m_defaultMapper;
+}
+
+const std::shared_ptr<ContentMappers::ObjectMapper>& ContentMappers::selectMapperForContent(const oatpp::String& contentType) const {
+
+  if(!contentType || m_mappers.empty()) {
+    return m_defaultMapper;
+  }
+
+  const char* data = contentType->data();
+  v_buff_size start = 0;
+  v_buff_size end = (v_buff_size) contentType->size();
+
+  for(v_buff_size i = 0; i < end; i ++) {
+    if(data[i] == ';') {
+      end = i;
+      break;
+    }
+  }
+  while(start < end && (data[start] == ' ' || data[start] == '\t')) start ++;
+  while(end > start && (data[end - 1] == ' ' || data[end - 1] == '\t')) end --;
+
+  /* non-owning key - no allocations on lookup */
+  auto it = m_mappers.find(data::share::StringKeyLabelCI(nullptr, data + start, end - start));
+  if(it != m_mappers.end()) {
+    return it->second;
+  }
+
+  return m_defaultMapper;
+
+}
+
+void ContentMappers::clear() {
+  m_mappers.clear();
+  m_defaultMapper = nullptr;
+}
+
+}}}
@@ -0,0 +1,111 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_mime_ContentMappers_hpp
+#define oatpp_web_mime_ContentMappers_hpp
+
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/share/MemoryLabel.hpp"
+
+#include <unordered_map>
+
+namespace oatpp { namespace web { namespace mime {
+
+/**
+ * Set of &id:oatpp::data::mapping::ObjectMapper; indexed by their content type. <br>
+ * Used to select ObjectMapper for the request body by the `Content-Type` header. <br>
+ * *Note:* mappers should be added before the server starts - lookups are not synchronized with modifications.
+ */
+class ContentMappers {
+public:
+  typedef oatpp::data::mapping::ObjectMapper ObjectMapper;
+private:
+  std::unordered_map<data::share::StringKeyLabelCI, std::shared_ptr<ObjectMapper>> m_mappers;
+  std::shared_ptr<ObjectMapper> m_defaultMapper;
+public:
+
+  /**
+   * Default constructor.
+   */
+  ContentMappers() = default;
+
+  /**
+   * Constructor.
+   * @param defaultMapper - default &id:oatpp::data::mapping::ObjectMapper;. Can be `nullptr`.
+   */
+  ContentMappers(const std::shared_ptr<ObjectMapper>& defaultMapper);
+
+  /**
+   * Create shared ContentMappers.
+   * @param defaultMapper - default &id:oatpp::data::mapping::ObjectMapper;. Can be `nullptr`.
+   * @return - `std::shared_ptr` to ContentMappers.
+   */
+  static std::shared_ptr<ContentMappers> createShared(const std::shared_ptr<ObjectMapper>& defaultMapper = nullptr);
+
+  /**
+   * Add mapper. Mapper is indexed by its `http_content_type` - see &id:oatpp::data::mapping::ObjectMapper::Info;. <br>
+   * Mapper previously added for the same content type is replaced.
+   * @param mapper - &id:oatpp::data::mapping::ObjectMapper;.
+   */
+  void putMapper(const std::shared_ptr<ObjectMapper>& mapper);
+
+  /**
+   * Set default mapper. Mapper is also added to the set - see &l:ContentMappers::putMapper ();.
+   * @param mapper - &id:oatpp::data::mapping::ObjectMapper;.
+   */
+  void setDefaultMapper(const std::shared_ptr<ObjectMapper>& mapper);
+
+  /**
+   * Get mapper by content type.
+   * @param contentType - content type without parameters. Ex.: `"application/json"`.
+   * @return - &id:oatpp::data::mapping::ObjectMapper; or `nullptr` if there is no mapper for the content type.
+   */
+  std::shared_ptr<ObjectMapper> getMapper(const oatpp::String& contentType) const;
+
+  /**
+   * Get default mapper.
+   * @return - &id:oatpp::data::mapping::ObjectMapper;.
+   */
+  const std::shared_ptr<ObjectMapper>& getDefaultMapper() const;
+
+  /**
+   * Select mapper for content by the value of `Content-Type` header. <br>
+   * Media type parameters (ex.: `; charset=utf-8`) are ignored. <br>
+   * Default mapper is returned if content type is `nullptr` or there is no mapper for it.
+   * @param contentType - value of `Content-Type` header. Can be `nullptr`.
+   * @return - &id:oatpp::data::mapping::ObjectMapper;.
+   */
+  const std::shared_ptr<ObjectMapper>& selectMapperForContent(const oatpp::String& contentType) const;
+
+  /**
+   * Remove all mappers including the default one.
+   */
+  void clear();
+
+};
+
+}}}
+
+#endif /* oatpp_web_mime_ContentMappers_hpp */
@@ -120,6 +120,7 @@ const char* const Header::CONTENT_LENGTH = "Content-Length";
 const char* const Header::CONTENT_TYPE = "Content-Type";
 const char* const Header::CONTENT_RANGE = "Content-Range";
 const char* const Header::RANGE = "Range";
+const char* const Header::ACCEPT_RANGES = "Accept-Ranges";
 const char* const Header::HOST = "Host";
 const char* const Header::USER_AGENT = "User-Agent";
 const char* const Header::SERVER = "Server";
@@ -172,8 +173,15 @@ Range Range::parse(oatpp::parser::Caret& caret) {
   caret.findRN();
   endLabel.end();
 
-  auto start = oatpp::utils::conversion::strToInt64((const char*) startLabel.getData());
-  auto end = oatpp::utils::conversion::strToInt64((const char*) endLabel.getData());
+  /* omitted bound (ex.: "bytes=100-" or suffix range "bytes=-500") is -1 */
+  v_int64 start = -1;
+  v_int64 end = -1;
+  if(startLabel.getSize() > 0) {
+    start = oatpp::utils::conversion::strToInt64((const char*) startLabel.getData());
+  }
+  if(endLabel.getSize() > 0) {
+    end = oatpp::utils::conversion::strToInt64((const char*) endLabel.getData());
+  }
   return Range(unitsLabel.toString(), start, end);
   
 }
@@ -345,7 +353,7 @@ void Parser::parseOneHeader(Headers& headers,
 {
   caret.skipChar(' ');
   auto name = parseHeaderNameLabel(headersText, caret);
-  if(name.getData() != nullptr) {
+  if(name.getData() != nullptr && name.getSize() > 0) {
     caret.skipChar(' ');
     if(!caret.canContinueAtChar(':', 1)) {
       error = Status::CODE_400;
@@ -499,6 +499,7 @@ public:
   static const char* const CONTENT_TYPE;        // "Content-Type"
   static const char* const CONTENT_RANGE;       // "Content-Range"
   static const char* const RANGE;               // "Range"
+  static const char* const ACCEPT_RANGES;       // "Accept-Ranges"
   static const char* const HOST;                // "Host"
   static const char* const USER_AGENT;          // "User-Agent"
   static const char* const SERVER;              // "Server"
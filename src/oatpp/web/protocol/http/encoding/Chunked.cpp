@@ -24,13 +24,262 @@
 
 #include "Chunked.hpp"
 
-#include "oatpp/core/utils/ConversionUtils.hpp"
+#include "oatpp/core/base/Environment.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace encoding {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // EncoderChunked
 
+v_buff_size EncoderChunked::writeChunkHeader(p_char8 buffer, v_buff_size chunkSize, bool firstChunk) {
+
+  static const char* const HEX = "0123456789ABCDEF";
+
+  v_buff_size size = 0;
+
+  if(!firstChunk) {
+    buffer[size ++] = '\r';
+    buffer[size ++] = '\n';
+  }
+
+  v_char8 digits[16];
+  v_buff_size digitsCount = 0;
+  v_uint64 value = (v_uint64) chunkSize;
+  do {
+    digits[digitsCount ++] = HEX[value & 0x0F];
+    value >>= 4;
+  } while(value > 0);
+
+  while(digitsCount > 0) {
+    buffer[size ++] = digits[-- digitsCount];
+  }
+
+  buffer[size ++] = '\r';
+  buffer[size ++] = '\n';
+
+  if(chunkSize == 0) {
+    buffer[size ++] = '\r';
+    buffer[size ++] = '\n';
+  }
+
+  return size;
+
+}
+
+v_io_size EncoderChunked::transfer(const base::ObjectHandle<data::stream::ReadCallback>& readCallback,
+                                   const base::ObjectHandle<data::stream::WriteCallback>& writeCallback,
+                                   const void* prefix,
+                                   v_buff_size prefixSize,
+                                   void* buffer,
+                                   v_buff_size bufferSize,
+                                   const Coalescing& coalescing)
+{
+
+  v_char8 header[MAX_CHUNK_HEADER_SIZE];
+  v_char8 trailer[MAX_CHUNK_HEADER_SIZE];
+  data::stream::IOVector vectors[4];
+
+  p_char8 data = (p_char8) buffer;
+  v_buff_size minChunkSize = coalescing.minChunkSize < bufferSize ? coalescing.minChunkSize : bufferSize;
+  v_int64 maxDelay = coalescing.maxDelay.count();
+
+  bool firstChunk = true;
+  v_io_size progress = 0;
+
+  while(true) {
+
+    v_buff_size chunkSize = 0;
+    v_int64 deadline = 0;
+    bool lastChunk = false;
+
+    do {
+
+      v_io_size res = IOError::RETRY_READ;
+      while (res == IOError::RETRY_READ || res == IOError::RETRY_WRITE) {
+        res = readCallback->readSimple(data + chunkSize, bufferSize - chunkSize);
+      }
+
+      if(res <= 0) {
+        lastChunk = true;
+        break;
+      }
+
+      if(chunkSize == 0 && maxDelay > 0) {
+        deadline = base::Environment::getMicroTickCount() + maxDelay;
+      }
+      chunkSize += res;
+
+    } while(chunkSize < minChunkSize && (maxDelay <= 0 || base::Environment::getMicroTickCount() < deadline));
+
+    v_buff_size count = 0;
+
+    if(prefix != nullptr && prefixSize > 0) {
+      vectors[count ++] = {prefix, prefixSize};
+      prefix = nullptr;
+    }
+
+    if(chunkSize > 0) {
+      vectors[count ++] = {header, writeChunkHeader(header, chunkSize, firstChunk)};
+      vectors[count ++] = {data, chunkSize};
+      firstChunk = false;
+    }
+
+    /* last chunk goes out together with the last portion of data */
+    if(lastChunk) {
+      vectors[count ++] = {trailer, writeChunkHeader(trailer, 0, firstChunk)};
+    }
+
+    data::stream::InlineWriteVectorData writeData(vectors, count);
+    writeCallback->writevExactSizeDataSimple(writeData);
+
+    if(writeData.count > 0) {
+      return progress;
+    }
+
+    progress += chunkSize;
+
+    if(lastChunk) {
+      return progress;
+    }
+
+  }
+
+}
+
+async::CoroutineStarter EncoderChunked::transferAsync(const base::ObjectHandle<data::stream::ReadCallback>& readCallback,
+                                                      const base::ObjectHandle<data::stream::WriteCallback>& writeCallback,
+                                                      const std::shared_ptr<data::stream::BufferOutputStream>& prefix,
+                                                      const base::ObjectHandle<data::buffer::IOBuffer>& buffer,
+                                                      const Coalescing& coalescing)
+{
+
+  class TransferCoroutine : public oatpp::async::Coroutine<TransferCoroutine> {
+  private:
+    base::ObjectHandle<data::stream::ReadCallback> m_readCallback;
+    base::ObjectHandle<data::stream::WriteCallback> m_writeCallback;
+    std::shared_ptr<data::stream::BufferOutputStream> m_prefix;
+    base::ObjectHandle<data::buffer::IOBuffer> m_buffer;
+    v_buff_size m_minChunkSize;
+    v_int64 m_maxDelay;
+  private:
+    v_char8 m_header[MAX_CHUNK_HEADER_SIZE];
+    v_char8 m_trailer[MAX_CHUNK_HEADER_SIZE];
+    data::stream::IOVector m_vectors[4];
+    data::stream::InlineWriteVectorData m_writeData;
+    v_buff_size m_chunkSize;
+    v_int64 m_deadline;
+    bool m_firstChunk;
+    bool m_lastChunk;
+  private:
+
+    static bool isWaitAction(const Action& action) {
+      switch(action.getType()) {
+        case Action::TYPE_REPEAT:
+        case Action::TYPE_WAIT_REPEAT:
+        case Action::TYPE_IO_WAIT:
+        case Action::TYPE_IO_REPEAT:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+  public:
+
+    TransferCoroutine(const base::ObjectHandle<data::stream::ReadCallback>& readCallback,
+                      const base::ObjectHandle<data::stream::WriteCallback>& writeCallback,
+                      const std::shared_ptr<data::stream::BufferOutputStream>& prefix,
+                      const base::ObjectHandle<data::buffer::IOBuffer>& buffer,
+                      const Coalescing& coalescing)
+      : m_readCallback(readCallback)
+      , m_writeCallback(writeCallback)
+      , m_prefix(prefix)
+      , m_buffer(buffer)
+      , m_minChunkSize(coalescing.minChunkSize < buffer->getSize() ? coalescing.minChunkSize : buffer->getSize())
+      , m_maxDelay(coalescing.maxDelay.count())
+      , m_chunkSize(0)
+      , m_deadline(0)
+      , m_firstChunk(true)
+      , m_lastChunk(false)
+    {}
+
+    Action act() override {
+
+      async::Action action;
+      auto res = m_readCallback->read((p_char8) m_buffer->getData() + m_chunkSize, m_buffer->getSize() - m_chunkSize, action);
+
+      if(!action.isNone()) {
+        /* body has no data ready - don't hold the pending chunk */
+        if(m_chunkSize > 0 && isWaitAction(action)) {
+          return writeChunk(false);
+        }
+        return action;
+      }
+
+      if(res == IOError::RETRY_READ || res == IOError::RETRY_WRITE) {
+        if(m_chunkSize > 0) {
+          return writeChunk(false);
+        }
+        return repeat();
+      }
+
+      if(res <= 0) {
+        return writeChunk(true);
+      }
+
+      if(m_chunkSize == 0 && m_maxDelay > 0) {
+        m_deadline = base::Environment::getMicroTickCount() + m_maxDelay;
+      }
+      m_chunkSize += res;
+
+      if(m_chunkSize < m_minChunkSize && (m_maxDelay <= 0 || base::Environment::getMicroTickCount() < m_deadline)) {
+        return repeat();
+      }
+
+      return writeChunk(false);
+
+    }
+
+    Action writeChunk(bool lastChunk) {
+
+      v_buff_size count = 0;
+
+      if(m_prefix && m_prefix->getCurrentPosition() > 0) {
+        m_vectors[count ++] = {m_prefix->getData(), m_prefix->getCurrentPosition()};
+      }
+      m_prefix.reset();
+
+      if(m_chunkSize > 0) {
+        m_vectors[count ++] = {m_header, writeChunkHeader(m_header, m_chunkSize, m_firstChunk)};
+        m_vectors[count ++] = {m_buffer->getData(), m_chunkSize};
+        m_firstChunk = false;
+      }
+
+      if(lastChunk) {
+        m_vectors[count ++] = {m_trailer, writeChunkHeader(m_trailer, 0, m_firstChunk)};
+      }
+
+      m_writeData.set(m_vectors, count);
+      m_chunkSize = 0;
+      m_lastChunk = lastChunk;
+
+      return yieldTo(&TransferCoroutine::flushData);
+
+    }
+
+    Action flushData() {
+      if(m_lastChunk) {
+        return m_writeCallback->writevExactSizeDataAsyncInline(m_writeData, finish());
+      }
+      return m_writeCallback->writevExactSizeDataAsyncInline(m_writeData, yieldTo(&TransferCoroutine::act));
+    }
+
+  };
+
+  return TransferCoroutine::start(readCallback, writeCallback, prefix, buffer, coalescing);
+
+}
+
 v_io_size EncoderChunked::suggestInputStreamReadSize() {
   return 32767;
 }
@@ -59,17 +308,7 @@ v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
 
     if(m_writeChunkHeader) {
 
-      async::Action action;
-      data::stream::BufferOutputStream stream(16);
-      if(!m_firstChunk) {
-        stream.write("\r\n", 2, action);
-      }
-
-      stream << utils::conversion::primitiveToStr(dataIn.bytesLeft, "%X");
-      stream.write("\r\n", 2, action);
-
-      m_chunkHeader = stream.toString();
-      dataOut.set((p_char8) m_chunkHeader->data(), m_chunkHeader->size());
+      dataOut.set(m_chunkHeader, writeChunkHeader(m_chunkHeader, dataIn.bytesLeft, m_firstChunk));
 
       m_firstChunk = false;
       m_writeChunkHeader = false;
@@ -87,16 +326,7 @@ v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
 
   if(m_writeChunkHeader){
 
-    async::Action action;
-    data::stream::BufferOutputStream stream(16);
-    if(!m_firstChunk) {
-      stream.write("\r\n", 2, action);
-    }
-
-    stream.write("0\r\n\r\n", 5, action);
-
-    m_chunkHeader = stream.toString();
-    dataOut.set((p_char8) m_chunkHeader->data(), m_chunkHeader->size());
+    dataOut.set(m_chunkHeader, writeChunkHeader(m_chunkHeader, 0, m_firstChunk));
 
     m_firstChunk = false;
     m_writeChunkHeader = false;
@@ -114,72 +344,153 @@ v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // DecoderChunked
 
+namespace {
+
+/* hex digit value or -1 */
+const v_int8 HEX_VALUES[256] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1, -1,
+  -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+/* 15 hex digits - chunk size fits v_io_size */
+constexpr v_buff_size MAX_SIZE_DIGITS = 15;
+
+}
+
 DecoderChunked::DecoderChunked()
-  : m_chunkHeaderBuffer(16)
-  , m_currentChunkSize(-1)
-  , m_firstChunk(true)
-  , m_finished(false)
+  : m_state(STATE_SIZE)
+  , m_currentChunkSize(0)
+  , m_lineLength(0)
   , m_lastFlush(0)
 {}
 
 v_io_size DecoderChunked::suggestInputStreamReadSize() {
-  if(m_currentChunkSize > 0) {
-    return m_currentChunkSize;
-  }
-  return 1;
-}
 
-v_int32 DecoderChunked::readHeader(data::buffer::InlineReadData& dataIn) {
-
-  async::Action action;
+  /* Min number of bytes left in the chunked body - never read past the end of the body */
+  switch(m_state) {
+    case STATE_SIZE: return m_currentChunkSize > 0 ? m_currentChunkSize + 9 : (m_lineLength == 0 ? 5 : 4);
+    case STATE_EXTENSION: return m_currentChunkSize > 0 ? m_currentChunkSize + 9 : 4;
+    case STATE_SIZE_LF: return m_currentChunkSize > 0 ? m_currentChunkSize + 8 : 3;
+    case STATE_DATA: return m_currentChunkSize + 7;
+    case STATE_DATA_CR: return 7;
+    case STATE_DATA_LF: return 6;
+    case STATE_TRAILER: return m_lineLength == 0 ? 2 : 4;
+    case STATE_TRAILER_LF: return m_lineLength == 0 ? 1 : 3;
+    default:
+      return 0;
+  }
 
-  while(dataIn.bytesLeft > 0 && m_currentChunkSize < 0) {
+}
 
-    if (m_chunkHeaderBuffer.getCurrentPosition() < 12) {
+v_int32 DecoderChunked::readFraming(data::buffer::InlineReadData& dataIn) {
 
-      m_chunkHeaderBuffer.write(dataIn.currBufferPtr, 1, action);
-      dataIn.inc(1);
+  p_char8 data = (p_char8) dataIn.currBufferPtr;
+  v_buff_size size = dataIn.bytesLeft;
+  v_buff_size i = 0;
+  v_int32 result = Error::OK;
 
-      auto pos = m_chunkHeaderBuffer.getCurrentPosition();
+  for(; i < size && m_state != STATE_DATA && m_state != STATE_FINISHED; i ++) {
 
-      if(m_currentChunkSize == -1) {
+    v_char8 c = data[i];
 
-        if (pos > 2 && m_chunkHeaderBuffer.getData()[pos - 2] == '\r' && m_chunkHeaderBuffer.getData()[pos - 1] == '\n') {
+    switch(m_state) {
 
-          if(m_firstChunk) {
-            m_currentChunkSize = strtol((const char *) m_chunkHeaderBuffer.getData(), nullptr, 16);
-          } else {
-            // skip "/r/n" before chunk size
-            m_currentChunkSize = strtol((const char *) (m_chunkHeaderBuffer.getData() + 2), nullptr, 16);
+      case STATE_SIZE: {
+        v_int32 digit = HEX_VALUES[c];
+        if(digit >= 0) {
+          if(m_lineLength == MAX_SIZE_DIGITS) {
+            result = ERROR_CHUNK_HEADER_TOO_LONG;
           }
+          m_currentChunkSize = (m_currentChunkSize << 4) | digit;
+          m_lineLength ++;
+        } else if(m_lineLength == 0) {
+          result = ERROR_CHUNK_HEADER_INVALID;
+        } else if(c == '\r') {
+          m_state = STATE_SIZE_LF;
+        } else if(c == ';' || c == ' ' || c == '\t') {
+          m_state = STATE_EXTENSION;
+        } else {
+          result = ERROR_CHUNK_HEADER_INVALID;
+        }
+        break;
+      }
 
-          if (m_currentChunkSize > 0) {
-            return Error::OK;
-          } else {
-            m_currentChunkSize = -2;
-          }
+      case STATE_EXTENSION:
+        if(c == '\r') {
+          m_state = STATE_SIZE_LF;
+        } else if(++ m_lineLength > MAX_LINE_LENGTH) {
+          result = ERROR_CHUNK_HEADER_TOO_LONG;
+        }
+        break;
+
+      case STATE_SIZE_LF:
+        if(c != '\n') {
+          result = ERROR_CHUNK_HEADER_INVALID;
+        }
+        m_lineLength = 0;
+        m_state = m_currentChunkSize > 0 ? STATE_DATA : STATE_TRAILER;
+        break;
 
+      case STATE_DATA_CR:
+        if(c != '\r') {
+          result = ERROR_CHUNK_HEADER_INVALID;
         }
+        m_state = STATE_DATA_LF;
+        break;
 
-      } else if(m_currentChunkSize == -2) {
+      case STATE_DATA_LF:
+        if(c != '\n') {
+          result = ERROR_CHUNK_HEADER_INVALID;
+        }
+        m_currentChunkSize = 0;
+        m_lineLength = 0;
+        m_state = STATE_SIZE;
+        break;
+
+      case STATE_TRAILER:
+        if(c == '\r') {
+          m_state = STATE_TRAILER_LF;
+        } else if(++ m_lineLength > MAX_LINE_LENGTH) {
+          result = ERROR_CHUNK_HEADER_TOO_LONG;
+        }
+        break;
 
-        if (pos > 4 &&
-            m_chunkHeaderBuffer.getData()[pos - 4] == '\r' && m_chunkHeaderBuffer.getData()[pos - 3] == '\n' &&
-            m_chunkHeaderBuffer.getData()[pos - 2] == '\r' && m_chunkHeaderBuffer.getData()[pos - 1] == '\n') {
-          m_currentChunkSize = 0;
-          m_finished = true;
-          return Error::OK;
+      case STATE_TRAILER_LF:
+        if(c != '\n') {
+          result = ERROR_CHUNK_HEADER_INVALID;
         }
+        m_state = m_lineLength == 0 ? STATE_FINISHED : STATE_TRAILER;
+        m_lineLength = 0;
+        break;
 
-      }
+      default:
+        break;
+
+    }
 
-    } else {
-      return ERROR_CHUNK_HEADER_TOO_LONG;
+    if(result != Error::OK) {
+      m_state = STATE_FINISHED;
+      break;
     }
 
   }
 
-  return Error::PROVIDE_DATA_IN;
+  dataIn.inc(i);
+  return result;
 
 }
 
@@ -195,30 +506,26 @@ v_int32 DecoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
       dataIn.inc(m_lastFlush);
       m_currentChunkSize -= m_lastFlush;
       if(m_currentChunkSize == 0) {
-        m_currentChunkSize = -1;
+        m_state = STATE_DATA_CR;
       }
       m_lastFlush = 0;
     }
 
-    if (m_finished) {
-      dataOut.set(nullptr, 0);
-      return Error::FINISHED;
-    }
-
-    if (dataIn.bytesLeft == 0) {
-      return Error::PROVIDE_DATA_IN;
+    if(m_state != STATE_DATA) {
+      v_int32 res = readFraming(dataIn);
+      if(res != Error::OK) {
+        return res;
+      }
     }
 
-    if(m_currentChunkSize < 0) {
-      return readHeader(dataIn);
-    } else if(m_currentChunkSize == 0) {
-      m_chunkHeaderBuffer.setCurrentPosition(0);
+    if(m_state == STATE_FINISHED) {
       dataOut.set(nullptr, 0);
-      m_finished = true;
       return Error::FINISHED;
     }
 
-    m_chunkHeaderBuffer.setCurrentPosition(0);
+    if(dataIn.bytesLeft == 0) {
+      return Error::PROVIDE_DATA_IN;
+    }
 
     m_lastFlush = dataIn.bytesLeft;
     if(m_lastFlush > m_currentChunkSize) {
@@ -230,9 +537,8 @@ v_int32 DecoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
 
   }
 
-  m_chunkHeaderBuffer.setCurrentPosition(0);
   dataOut.set(nullptr, 0);
-  m_finished = true;
+  m_state = STATE_FINISHED;
   return Error::FINISHED;
 
 }
@@ -28,20 +28,108 @@
 #include "EncoderProvider.hpp"
 #include "oatpp/core/data/stream/BufferStream.hpp"
 
+#include <chrono>
+
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace encoding {
 
 /**
  * Chunked-encoding buffer processor. &id:oatpp::data::buffer::Processor;.
  */
 class EncoderChunked : public data::buffer::Processor {
+public:
+
+  /**
+   * Max size of chunk framing produced by &l:EncoderChunked::writeChunkHeader ();.
+   */
+  static constexpr v_buff_size MAX_CHUNK_HEADER_SIZE = 24;
+
+  /**
+   * Chunk coalescing options for &l:EncoderChunked::transfer (); and &l:EncoderChunked::transferAsync ();. <br>
+   * Small portions of data provided by the body (ex.: SSE events, NDJSON lines) are gathered into one chunk
+   * until the chunk reaches `minChunkSize` or `maxDelay` elapses since the first byte of the chunk was read.
+   * Deadline is checked when the body provides data. In Async mode the pending chunk is also flushed
+   * as soon as the body has no data ready.
+   */
+  struct Coalescing {
+
+    /**
+     * Constructor.
+     * @param pMinChunkSize - min size of the chunk. `0` - coalescing is disabled.
+     * @param pMaxDelay - max time to hold data in the pending chunk. `0` - no deadline.
+     */
+    Coalescing(v_buff_size pMinChunkSize = 0,
+               const std::chrono::duration<v_int64, std::micro>& pMaxDelay = std::chrono::duration<v_int64, std::micro>(0))
+      : minChunkSize(pMinChunkSize)
+      , maxDelay(pMaxDelay)
+    {}
+
+    /**
+     * Min size of the chunk. Limited by the size of the transfer buffer.
+     */
+    v_buff_size minChunkSize;
+
+    /**
+     * Max time to hold data in the pending chunk.
+     */
+    std::chrono::duration<v_int64, std::micro> maxDelay;
+
+  };
+
 private:
-  oatpp::String m_chunkHeader;
+  v_char8 m_chunkHeader[MAX_CHUNK_HEADER_SIZE];
   bool m_writeChunkHeader = true;
   bool m_firstChunk = true;
   bool m_finished = false;
   v_io_size m_lastFlush = 0;
 public:
 
+  /**
+   * Write chunk framing to buffer: `[CRLF]<hex-size>CRLF`. <br>
+   * CRLF terminating the previous chunk is prepended for all chunks except the first one.
+   * For `chunkSize == 0` the last-chunk `[CRLF]0CRLFCRLF` is written.
+   * @param buffer - buffer of at least &l:EncoderChunked::MAX_CHUNK_HEADER_SIZE; bytes.
+   * @param chunkSize - size of the chunk data.
+   * @param firstChunk - is it the first chunk in the body.
+   * @return - number of bytes written to buffer.
+   */
+  static v_buff_size writeChunkHeader(p_char8 buffer, v_buff_size chunkSize, bool firstChunk);
+
+  /**
+   * Transfer data from `readCallback` to `writeCallback` chunk-encoded. <br>
+   * Chunk framing and chunk data are put out with a single vectored write (&id:oatpp::data::stream::WriteCallback::writev;) -
+   * chunk data is not copied.
+   * @param readCallback - &id:oatpp::data::stream::ReadCallback;.
+   * @param writeCallback - &id:oatpp::data::stream::WriteCallback;.
+   * @param prefix - data to put out before the first chunk (ex.: response headers). Sent together with the first chunk. May be `nullptr`.
+   * @param prefixSize - size of the prefix.
+   * @param buffer - buffer to read chunk data to.
+   * @param bufferSize - size of the buffer. Max chunk size.
+   * @param coalescing - &l:EncoderChunked::Coalescing;. Disabled by default.
+   * @return - number of body bytes transferred.
+   */
+  static v_io_size transfer(const base::ObjectHandle<data::stream::ReadCallback>& readCallback,
+                            const base::ObjectHandle<data::stream::WriteCallback>& writeCallback,
+                            const void* prefix,
+                            v_buff_size prefixSize,
+                            void* buffer,
+                            v_buff_size bufferSize,
+                            const Coalescing& coalescing = Coalescing());
+
+  /**
+   * Same as &l:EncoderChunked::transfer (); but Async.
+   * @param readCallback - &id:oatpp::data::stream::ReadCallback;.
+   * @param writeCallback - &id:oatpp::data::stream::WriteCallback;.
+   * @param prefix - data to put out before the first chunk (ex.: response headers). May be `nullptr`.
+   * @param buffer - &id:oatpp::data::buffer::IOBuffer; to read chunk data to.
+   * @param coalescing - &l:EncoderChunked::Coalescing;. Disabled by default.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  static async::CoroutineStarter transferAsync(const base::ObjectHandle<data::stream::ReadCallback>& readCallback,
+                                               const base::ObjectHandle<data::stream::WriteCallback>& writeCallback,
+                                               const std::shared_ptr<data::stream::BufferOutputStream>& prefix,
+                                               const base::ObjectHandle<data::buffer::IOBuffer>& buffer,
+                                               const Coalescing& coalescing = Coalescing());
+
   /**
    * If the client is using the input stream to read data and push it to the processor,
    * the client MAY ask the processor for a suggested read size.
@@ -65,15 +153,43 @@ public:
  */
 class DecoderChunked : public data::buffer::Processor {
 public:
+
+  /**
+   * Chunk-size line (including chunk extensions) or trailer line is too long.
+   */
   static constexpr v_int32 ERROR_CHUNK_HEADER_TOO_LONG = 100;
+
+  /**
+   * Malformed chunk framing.
+   */
+  static constexpr v_int32 ERROR_CHUNK_HEADER_INVALID = 101;
+
+  /**
+   * Max length of chunk-size line or trailer line.
+   */
+  static constexpr v_buff_size MAX_LINE_LENGTH = 1024;
+
+private:
+
+  enum State : v_int32 {
+    STATE_SIZE = 0,
+    STATE_EXTENSION = 1,
+    STATE_SIZE_LF = 2,
+    STATE_DATA = 3,
+    STATE_DATA_CR = 4,
+    STATE_DATA_LF = 5,
+    STATE_TRAILER = 6,
+    STATE_TRAILER_LF = 7,
+    STATE_FINISHED = 8
+  };
+
 private:
-  data::stream::BufferOutputStream m_chunkHeaderBuffer;
+  v_int32 m_state;
   v_io_size m_currentChunkSize;
-  bool m_firstChunk;
-  bool m_finished;
+  v_buff_size m_lineLength;
   v_io_size m_lastFlush;
 private:
-  v_int32 readHeader(data::buffer::InlineReadData& dataIn);
+  v_int32 readFraming(data::buffer::InlineReadData& dataIn);
 public:
 
   /**
@@ -49,33 +49,34 @@ private:
     std::shared_ptr<data::stream::InputStream> m_bodyStream;
     std::shared_ptr<data::stream::IOStream> m_connection;
     std::shared_ptr<data::mapping::ObjectMapper> m_objectMapper;
-    std::shared_ptr<data::stream::BufferOutputStream> m_outputStream;
+    std::shared_ptr<data::mapping::ObjectMapper::Reader> m_reader;
   public:
     
     ToDtoDecoder(const BodyDecoder* decoder,
                  Headers& headers,
                  const std::shared_ptr<data::stream::InputStream>& bodyStream,
                  const std::shared_ptr<data::stream::IOStream>& connection,
-                 const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper)
+                 const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper,
+                 const std::shared_ptr<data::mapping::Arena>& arena)
       : m_decoder(decoder)
       , m_headers(headers)
       , m_bodyStream(bodyStream)
       , m_connection(connection)
       , m_objectMapper(objectMapper)
-      , m_outputStream(std::make_shared<data::stream::BufferOutputStream>())
-    {}
+      , m_reader(objectMapper->createReader(Wrapper::Class::getType()))
+    {
+      m_reader->setArena(arena);
+    }
     
     oatpp::async::Action act() override {
-      return m_decoder->decodeAsync(m_headers, m_bodyStream, m_outputStream, m_connection)
+      return m_decoder->decodeAsync(m_headers, m_bodyStream, m_reader, m_connection)
         .next(this->yieldTo(&ToDtoDecoder::onDecoded));
     }
     
     oatpp::async::Action onDecoded() {
-      auto body = m_outputStream->toString();
-      oatpp::parser::Caret caret(body);
-      auto dto = m_objectMapper->readFromCaret<Wrapper>(caret);
-      if(caret.hasError()) {
-        return this->template error<oatpp::async::Error>(caret.getErrorMessage());
+      auto dto = m_reader->finish().template cast<Wrapper>();
+      if(m_reader->hasError()) {
+        return this->template error<oatpp::async::Error>(m_reader->getErrorMessage()->c_str());
       }
       return this->_return(dto);
     }
@@ -131,21 +132,31 @@ public:
   }
 
   /**
-   * Read body stream, decode, and deserialize it as DTO Object (see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/)).
+   * Read body stream, decode, and deserialize it as DTO Object (see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/)). <br>
+   * Decoded chunks are pushed directly to &id:oatpp::data::mapping::ObjectMapper::Reader; - body is not accumulated in memory.
    * @tparam Wrapper - ObjectWrapper type.
    * @param headers - Headers map. &id:oatpp::web::protocol::http::Headers;.
    * @param bodyStream - pointer to &id:oatpp::data::stream::InputStream;.
    * @param connection
    * @param objectMapper - pointer to &id:oatpp::data::mapping::ObjectMapper;.
+   * @param arena - &id:oatpp::data::mapping::Arena; to allocate DTO graph from. `nullptr` - allocate on the heap.
    * @return - deserialized DTO object.
    */
   template<class Wrapper>
   Wrapper decodeToDto(const Headers& headers,
                       data::stream::InputStream* bodyStream,
                       data::stream::IOStream* connection,
-                      data::mapping::ObjectMapper* objectMapper) const
+                      data::mapping::ObjectMapper* objectMapper,
+                      const std::shared_ptr<data::mapping::Arena>& arena = nullptr) const
   {
-    return objectMapper->readFromString<Wrapper>(decodeToString(headers, bodyStream, connection));
+    auto reader = objectMapper->createReader(Wrapper::Class::getType());
+    reader->setArena(arena);
+    decode(headers, bodyStream, reader.get(), connection);
+    auto dto = reader->finish().template cast<Wrapper>();
+    if(reader->hasError()) {
+      throw oatpp::parser::ParsingError(reader->getErrorMessage(), reader->getErrorCode(), reader->getErrorPosition());
+    }
+    return dto;
   }
 
   /**
@@ -167,6 +178,7 @@ public:
    * @param bodyStream - `std::shared_ptr` to &id:oatpp::data::stream::InputStream;.
    * @param connection
    * @param objectMapper - `std::shared_ptr` to &id:oatpp::data::mapping::ObjectMapper;.
+   * @param arena - &id:oatpp::data::mapping::Arena; to allocate DTO graph from. `nullptr` - allocate on the heap.
    * @return - &id:oatpp::async::CoroutineStarterForResult;.
    */
   template<class Wrapper>
@@ -174,9 +186,10 @@ public:
   decodeToDtoAsync(const Headers& headers,
                    const std::shared_ptr<data::stream::InputStream>& bodyStream,
                    const std::shared_ptr<data::stream::IOStream>& connection,
-                   const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper) const
+                   const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper,
+                   const std::shared_ptr<data::mapping::Arena>& arena = nullptr) const
   {
-    return ToDtoDecoder<Wrapper>::startForResult(this, headers, bodyStream, connection, objectMapper);
+    return ToDtoDecoder<Wrapper>::startForResult(this, headers, bodyStream, connection, objectMapper, arena);
   }
   
 };
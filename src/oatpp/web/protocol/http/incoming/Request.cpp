@@ -138,6 +138,14 @@ const data::Bundle& Request::getBundle() const {
   return m_bundle;
 }
 
+void Request::setArena(const std::shared_ptr<data::mapping::Arena>& arena) {
+  m_arena = arena;
+}
+
+const std::shared_ptr<data::mapping::Arena>& Request::getArena() const {
+  return m_arena;
+}
+
 void Request::transferBody(const base::ObjectHandle<data::stream::WriteCallback>& writeCallback) const {
   m_bodyDecoder->decode(m_headers, m_bodyStream.get(), writeCallback.get(), m_connection.get());
 }
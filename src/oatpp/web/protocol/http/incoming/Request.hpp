@@ -56,6 +56,8 @@ private:
 
   data::Bundle m_bundle;
 
+  std::shared_ptr<data::mapping::Arena> m_arena;
+
 public:
   
   Request(const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
@@ -232,6 +234,20 @@ public:
    */
   const data::Bundle& getBundle() const;
 
+  /**
+   * Set request-scoped &id:oatpp::data::mapping::Arena;. <br>
+   * When set, DTOs read with &l:Request::readBodyToDto (); and &l:Request::readBodyToDtoAsync (); are allocated from the arena.
+   * Arena memory is released at once when the last object of the DTO graph is destroyed.
+   * @param arena - arena or `nullptr` to allocate DTOs on the heap.
+   */
+  void setArena(const std::shared_ptr<data::mapping::Arena>& arena);
+
+  /**
+   * Get request-scoped arena.
+   * @return - arena or `nullptr`.
+   */
+  const std::shared_ptr<data::mapping::Arena>& getArena() const;
+
   /**
    * Transfer body. <br>
    * Read body chunk by chunk and pass chunks to the `writeCallback`.
@@ -259,7 +275,7 @@ public:
    */
   template<class Wrapper>
   Wrapper readBodyToDto(const base::ObjectHandle<data::mapping::ObjectMapper>& objectMapper) const {
-    return objectMapper->readFromString<Wrapper>(m_bodyDecoder->decodeToString(m_headers, m_bodyStream.get(), m_connection.get()));
+    return m_bodyDecoder->decodeToDto<Wrapper>(m_headers, m_bodyStream.get(), m_connection.get(), objectMapper.get(), m_arena);
   }
   
   // Async
@@ -294,7 +310,7 @@ public:
   template<class Wrapper>
   oatpp::async::CoroutineStarterForResult<const Wrapper&>
   readBodyToDtoAsync(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper) const {
-    return m_bodyDecoder->decodeToDtoAsync<Wrapper>(m_headers, m_bodyStream, m_connection, objectMapper);
+    return m_bodyDecoder->decodeToDtoAsync<Wrapper>(m_headers, m_bodyStream, m_connection, objectMapper, m_arena);
   }
   
 };
@@ -46,14 +46,11 @@ v_io_size RequestHeadersReader::readHeadersSectionIterative(ReadHeadersIteration
 
     m_bufferStream->setCurrentPosition(m_bufferStream->getCurrentPosition() + res);
 
-    for(v_buff_size i = 0; i < res; i ++) {
-      iteration.accumulator <<= 8;
-      iteration.accumulator |= bufferData[i];
-      if(iteration.accumulator == SECTION_END) {
-        stream->commitReadOffset(i + 1);
-        iteration.done = true;
-        return res;
-      }
+    auto sectionSize = iteration.scanner.scan(bufferData, res);
+    if(sectionSize >= 0) {
+      stream->commitReadOffset(sectionSize);
+      iteration.done = true;
+      return res;
     }
 
     stream->commitReadOffset(res);
@@ -97,7 +94,7 @@ RequestHeadersReader::Result RequestHeadersReader::readHeaders(data::stream::Inp
     http::Status status;
     http::Parser::parseRequestStartingLine(result.startingLine, nullptr, caret, status);
     if(status.code == 0) {
-      http::Parser::parseHeaders(result.headers, nullptr, caret, status);
+      iteration.scanner.parseHeaders(result.headers, nullptr, caret, status);
     }
   }
   
@@ -157,7 +154,7 @@ RequestHeadersReader::readHeadersAsync(const std::shared_ptr<data::stream::Input
       http::Status status;
       http::Parser::parseRequestStartingLine(m_result.startingLine, nullptr, caret, status);
       if(status.code == 0) {
-        http::Parser::parseHeaders(m_result.headers, nullptr, caret, status);
+        m_iteration.scanner.parseHeaders(m_result.headers, nullptr, caret, status);
         if(status.code == 0) {
           return _return(m_result);
         } else {
@@ -25,6 +25,7 @@
 #ifndef oatpp_web_protocol_http_incoming_RequestHeadersReader_hpp
 #define oatpp_web_protocol_http_incoming_RequestHeadersReader_hpp
 
+#include "oatpp/web/protocol/http/utils/HeadersScanner.hpp"
 #include "oatpp/web/protocol/http/Http.hpp"
 #include "oatpp/core/async/Coroutine.hpp"
 #include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
@@ -41,8 +42,6 @@ public:
    * Convenience typedef for &id:oatpp::async::Action;.
    */
   typedef oatpp::async::Action Action;
-private:
-  static constexpr v_uint32 SECTION_END = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
 public:
 
   /**
@@ -64,7 +63,7 @@ public:
 private:
 
   struct ReadHeadersIteration {
-    v_uint32 accumulator = 0;
+    utils::HeadersScanner scanner;
     bool done = false;
   };
 
@@ -49,15 +49,12 @@ v_io_size ResponseHeadersReader::readHeadersSectionIterative(ReadHeadersIteratio
 
     bufferStream->writeSimple(bufferData, res);
 
-    for(v_buff_size i = 0; i < res; i ++) {
-      iteration.accumulator <<= 8;
-      iteration.accumulator |= bufferData[i];
-      if(iteration.accumulator == SECTION_END) {
-        result.bufferPosStart = i + 1;
-        result.bufferPosEnd = res;
-        iteration.done = true;
-        return res;
-      }
+    auto sectionSize = iteration.scanner.scan(bufferData, res);
+    if(sectionSize >= 0) {
+      result.bufferPosStart = sectionSize;
+      result.bufferPosEnd = res;
+      iteration.done = true;
+      return res;
     }
 
   }
@@ -99,7 +96,7 @@ ResponseHeadersReader::Result ResponseHeadersReader::readHeaders(const std::shar
     http::Status status;
     http::Parser::parseResponseStartingLine(result.startingLine, headersText.getPtr(), caret, status);
     if(status.code == 0) {
-      http::Parser::parseHeaders(result.headers, headersText.getPtr(), caret, status);
+      iteration.scanner.parseHeaders(result.headers, headersText.getPtr(), caret, status);
     }
   }
   
@@ -158,7 +155,7 @@ ResponseHeadersReader::readHeadersAsync(const std::shared_ptr<oatpp::data::strea
       http::Status status;
       http::Parser::parseResponseStartingLine(m_result.startingLine, headersText.getPtr(), caret, status);
       if(status.code == 0) {
-        http::Parser::parseHeaders(m_result.headers, headersText.getPtr(), caret, status);
+        m_iteration.scanner.parseHeaders(m_result.headers, headersText.getPtr(), caret, status);
         if(status.code == 0) {
           return _return(m_result);
         } else {
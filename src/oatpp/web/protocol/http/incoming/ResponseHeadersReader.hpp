@@ -25,6 +25,7 @@
 #ifndef oatpp_web_protocol_http_incoming_ResponseHeadersReader_hpp
 #define oatpp_web_protocol_http_incoming_ResponseHeadersReader_hpp
 
+#include "oatpp/web/protocol/http/utils/HeadersScanner.hpp"
 #include "oatpp/web/protocol/http/Http.hpp"
 #include "oatpp/core/async/Coroutine.hpp"
 
@@ -39,8 +40,6 @@ public:
    * Convenience typedef for &id:oatpp::async::Action;.
    */
   typedef oatpp::async::Action Action;
-private:
-  static constexpr v_uint32 SECTION_END = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
 public:
 
   /**
@@ -70,7 +69,7 @@ public:
 private:
 
   struct ReadHeadersIteration {
-    v_uint32 accumulator = 0;
+    utils::HeadersScanner scanner;
     v_buff_size progress = 0;
     bool done = false;
   };
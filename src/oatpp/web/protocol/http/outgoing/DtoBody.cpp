@@ -0,0 +1,105 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "DtoBody.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+DtoBody::DtoBody(const std::shared_ptr<data::mapping::ObjectMapper::Writer>& writer,
+                 const data::share::StringKeyLabel& contentType,
+                 v_buff_size prefetchSize)
+  : m_writer(writer)
+  , m_contentType(contentType)
+  , m_prefetchPosition(0)
+  , m_writerFinished(false)
+{
+
+  /* Serialize upfront - for small DTOs serialization errors are reported right here as with the plain buffer body */
+
+  v_char8 buffer[4096];
+  while(m_prefetch.getCurrentPosition() < prefetchSize) {
+    auto res = m_writer->readSimple(buffer, 4096);
+    if(res <= 0) {
+      m_writerFinished = true;
+      break;
+    }
+    m_prefetch.writeSimple(buffer, res);
+  }
+
+}
+
+std::shared_ptr<DtoBody> DtoBody::createShared(const std::shared_ptr<data::mapping::ObjectMapper::Writer>& writer,
+                                               const data::share::StringKeyLabel& contentType,
+                                               v_buff_size prefetchSize)
+{
+  return std::make_shared<DtoBody>(writer, contentType, prefetchSize);
+}
+
+v_io_size DtoBody::read(void *buffer, v_buff_size count, async::Action& action) {
+
+  v_buff_size prefetched = m_prefetch.getCurrentPosition() - m_prefetchPosition;
+
+  if(prefetched > 0) {
+    if(prefetched > count) {
+      prefetched = count;
+    }
+    std::memcpy(buffer, m_prefetch.getData() + m_prefetchPosition, prefetched);
+    m_prefetchPosition += prefetched;
+    return prefetched;
+  }
+
+  if(m_writerFinished) {
+    return 0;
+  }
+
+  auto res = m_writer->read(buffer, count, action);
+  if(res == 0) {
+    m_writerFinished = true;
+  }
+  return res;
+
+}
+
+void DtoBody::declareHeaders(Headers& headers) {
+  if (m_contentType) {
+    headers.putIfNotExists(Header::CONTENT_TYPE, m_contentType);
+  }
+}
+
+p_char8 DtoBody::getKnownData() {
+  if(m_writerFinished) {
+    return m_prefetch.getData();
+  }
+  return nullptr;
+}
+
+v_int64 DtoBody::getKnownSize() {
+  if(m_writerFinished) {
+    return m_prefetch.getCurrentPosition();
+  }
+  return -1;
+}
+
+}}}}}
@@ -0,0 +1,111 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_protocol_http_outgoing_DtoBody_hpp
+#define oatpp_web_protocol_http_outgoing_DtoBody_hpp
+
+#include "./Body.hpp"
+#include "oatpp/web/protocol/http/Http.hpp"
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+/**
+ * Implementation of &id:oatpp::web::protocol::http::outgoing::Body; class.
+ * Serializes DTO incrementally while the body is being sent - see &id:oatpp::data::mapping::ObjectMapper::Writer;. <br>
+ * The first `prefetchSize` bytes are serialized upfront. If the whole DTO fits, body has known size
+ * and is sent with `Content-Length`. Otherwise the rest is serialized chunk by chunk as the body is read,
+ * and the body is sent with chunked transfer-encoding.
+ */
+class DtoBody : public oatpp::base::Countable, public Body {
+public:
+  /**
+   * Default prefetch size.
+   */
+  static constexpr v_buff_size DEFAULT_PREFETCH_SIZE = 64 * 1024;
+private:
+  std::shared_ptr<data::mapping::ObjectMapper::Writer> m_writer;
+  oatpp::data::share::StringKeyLabel m_contentType;
+  data::stream::BufferOutputStream m_prefetch;
+  v_buff_size m_prefetchPosition;
+  bool m_writerFinished;
+public:
+
+  /**
+   * Constructor.
+   * @param writer - &id:oatpp::data::mapping::ObjectMapper::Writer;.
+   * @param contentType - type of the content.
+   * @param prefetchSize - max size of the data to serialize upfront.
+   */
+  DtoBody(const std::shared_ptr<data::mapping::ObjectMapper::Writer>& writer,
+          const data::share::StringKeyLabel& contentType,
+          v_buff_size prefetchSize);
+public:
+
+  /**
+   * Create shared DtoBody.
+   * @param writer - &id:oatpp::data::mapping::ObjectMapper::Writer;.
+   * @param contentType - type of the content.
+   * @param prefetchSize - max size of the data to serialize upfront.
+   * @return - `std::shared_ptr` to DtoBody.
+   */
+  static std::shared_ptr<DtoBody> createShared(const std::shared_ptr<data::mapping::ObjectMapper::Writer>& writer,
+                                               const data::share::StringKeyLabel& contentType = data::share::StringKeyLabel(),
+                                               v_buff_size prefetchSize = DEFAULT_PREFETCH_SIZE);
+
+  /**
+   * Read operation callback.
+   * @param buffer - pointer to buffer.
+   * @param count - size of the buffer in bytes.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes written to buffer. 0 - to indicate end-of-file.
+   */
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
+
+  /**
+   * Declare `Content-Type` header.
+   * @param headers - &id:oatpp::web::protocol::http::Headers;.
+   */
+  void declareHeaders(Headers& headers) override;
+
+  /**
+   * Pointer to the body known data.
+   * @return - `p_char8`. `nullptr` if DTO didn't fit into the prefetch buffer.
+   */
+  p_char8 getKnownData() override;
+
+  /**
+   * Return known size of the body.
+   * @return - `v_int64`. `-1` if DTO didn't fit into the prefetch buffer.
+   */
+  v_int64 getKnownSize() override;
+
+};
+
+}}}}}
+
+#endif /* oatpp_web_protocol_http_outgoing_DtoBody_hpp */
@@ -0,0 +1,304 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "FileBody.hpp"
+
+#include "oatpp/network/tcp/Connection.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+int getFileDescriptor(std::FILE* file) {
+#if defined(WIN32) || defined(_WIN32)
+  return _fileno(file);
+#else
+  return fileno(file);
+#endif
+}
+
+}
+
+FileBody::FileBody(const oatpp::String& filename,
+                   const data::share::StringKeyLabel& contentType,
+                   const oatpp::String& range)
+  : m_stream(filename->c_str())
+  , m_contentType(contentType)
+  , m_fileSize(0)
+  , m_rangeStart(0)
+  , m_size(0)
+  , m_progress(0)
+  , m_isRange(false)
+  , m_isRangeSatisfiable(true)
+{
+
+  std::FILE* file = m_stream.getFile();
+  if(std::fseek(file, 0, SEEK_END) == 0) {
+    m_fileSize = std::ftell(file);
+  }
+  if(m_fileSize < 0) {
+    m_fileSize = 0;
+  }
+
+  m_size = m_fileSize;
+
+  if(range) {
+    applyRange(range);
+  }
+
+  std::fseek(file, (long) m_rangeStart, SEEK_SET);
+
+}
+
+void FileBody::applyRange(const oatpp::String& range) {
+
+  /* multiple ranges are not supported - the whole file is sent */
+  if(range->find(',') != std::string::npos) {
+    return;
+  }
+
+  auto parsed = Range::parse(range);
+  if(!parsed.isValid() || parsed.units != Range::UNIT_BYTES) {
+    return;
+  }
+
+  v_int64 start = parsed.start;
+  v_int64 end = parsed.end;
+
+  if(start < 0) {
+    /* suffix range - last `end` bytes of the file */
+    if(end < 0) {
+      return;
+    }
+    start = end == 0 ? m_fileSize : (end < m_fileSize ? m_fileSize - end : 0);
+    end = m_fileSize - 1;
+  } else {
+    if(end >= 0 && end < start) {
+      /* malformed range - ignore */
+      return;
+    }
+    if(end < 0 || end >= m_fileSize) {
+      end = m_fileSize - 1;
+    }
+  }
+
+  m_isRange = true;
+
+  if(start >= m_fileSize) {
+    m_isRangeSatisfiable = false;
+    m_rangeStart = 0;
+    m_size = 0;
+    return;
+  }
+
+  m_rangeStart = start;
+  m_size = end - start + 1;
+
+}
+
+std::shared_ptr<FileBody> FileBody::createShared(const oatpp::String& filename,
+                                                 const data::share::StringKeyLabel& contentType,
+                                                 const oatpp::String& range)
+{
+  return std::make_shared<FileBody>(filename, contentType, range);
+}
+
+v_io_size FileBody::read(void *buffer, v_buff_size count, async::Action& action) {
+
+  v_int64 bytesLeft = m_size - m_progress;
+  if(bytesLeft <= 0) {
+    return 0;
+  }
+
+  if(count > bytesLeft) {
+    count = (v_buff_size) bytesLeft;
+  }
+
+  auto res = m_stream.read(buffer, count, action);
+  if(res > 0) {
+    m_progress += res;
+  }
+  return res;
+
+}
+
+void FileBody::declareHeaders(Headers& headers) {
+
+  if(m_contentType) {
+    headers.putIfNotExists(Header::CONTENT_TYPE, m_contentType);
+  }
+
+  headers.putIfNotExists(Header::ACCEPT_RANGES, Range::UNIT_BYTES);
+
+  if(m_isRange) {
+    if(m_isRangeSatisfiable) {
+      headers.putIfNotExists(Header::CONTENT_RANGE,
+                             ContentRange(ContentRange::UNIT_BYTES, m_rangeStart, m_rangeStart + m_size - 1, m_fileSize, true).toString());
+    } else {
+      headers.putIfNotExists(Header::CONTENT_RANGE, "bytes */" + utils::conversion::int64ToStr(m_fileSize));
+    }
+  }
+
+}
+
+p_char8 FileBody::getKnownData() {
+  return nullptr;
+}
+
+v_int64 FileBody::getKnownSize() {
+  return m_size;
+}
+
+v_int64 FileBody::getFileSize() const {
+  return m_fileSize;
+}
+
+bool FileBody::isRange() const {
+  return m_isRange;
+}
+
+bool FileBody::isRangeSatisfiable() const {
+  return m_isRangeSatisfiable;
+}
+
+const Status& FileBody::getStatus() const {
+  if(!m_isRange) {
+    return Status::CODE_200;
+  }
+  if(m_isRangeSatisfiable) {
+    return Status::CODE_206;
+  }
+  return Status::CODE_416;
+}
+
+v_io_size FileBody::transfer(data::stream::OutputStream* stream, void* buffer, v_buff_size bufferSize) {
+
+  auto connection = dynamic_cast<network::tcp::Connection*>(stream);
+
+  if(connection == nullptr || !network::tcp::Connection::isSendFileSupported()) {
+    return data::stream::transfer(this, stream, 0, buffer, bufferSize);
+  }
+
+  int fileDescriptor = getFileDescriptor(m_stream.getFile());
+  v_int64 initialProgress = m_progress;
+
+  while(m_progress < m_size) {
+
+    async::Action action;
+    auto res = connection->sendFile(fileDescriptor, m_rangeStart + m_progress, (v_buff_size) (m_size - m_progress), action);
+
+    if(!action.isNone()) {
+      OATPP_LOGE("[oatpp::web::protocol::http::outgoing::FileBody::transfer()]", "Error. transfer() is called on a stream in Async mode.");
+      throw std::runtime_error("[oatpp::web::protocol::http::outgoing::FileBody::transfer()]: Error. transfer() is called on a stream in Async mode.");
+    }
+
+    if(res > 0) {
+      m_progress += res;
+    } else if(res == IOError::ZERO_VALUE) {
+      /* file got shorter than declared Content-Length - the response can't be completed */
+      throw std::runtime_error("[oatpp::web::protocol::http::outgoing::FileBody::transfer()]: Error. Unexpected end of file.");
+    } else if(res != IOError::RETRY_WRITE && res != IOError::RETRY_READ) {
+      break;
+    }
+
+  }
+
+  return m_progress - initialProgress;
+
+}
+
+async::CoroutineStarter FileBody::transferAsync(const std::shared_ptr<FileBody>& body,
+                                                const std::shared_ptr<data::stream::OutputStream>& stream)
+{
+
+  class TransferCoroutine : public oatpp::async::Coroutine<TransferCoroutine> {
+  private:
+    std::shared_ptr<FileBody> m_body;
+    std::shared_ptr<data::stream::OutputStream> m_stream;
+    network::tcp::Connection* m_connection;
+    int m_fileDescriptor;
+  public:
+
+    TransferCoroutine(const std::shared_ptr<FileBody>& body,
+                      const std::shared_ptr<data::stream::OutputStream>& stream)
+      : m_body(body)
+      , m_stream(stream)
+      , m_connection(dynamic_cast<network::tcp::Connection*>(stream.get()))
+      , m_fileDescriptor(-1)
+    {}
+
+    Action act() override {
+
+      if(m_connection == nullptr || !network::tcp::Connection::isSendFileSupported()) {
+        return data::stream::transferAsync(m_body, m_stream, 0, data::buffer::IOBuffer::createShared())
+          .next(finish());
+      }
+
+      m_fileDescriptor = getFileDescriptor(m_body->m_stream.getFile());
+      return yieldTo(&TransferCoroutine::sendFile);
+
+    }
+
+    Action sendFile() {
+
+      if(m_body->m_progress >= m_body->m_size) {
+        return finish();
+      }
+
+      Action action;
+      auto res = m_connection->sendFile(m_fileDescriptor,
+                                        m_body->m_rangeStart + m_body->m_progress,
+                                        (v_buff_size) (m_body->m_size - m_body->m_progress),
+                                        action);
+
+      if(!action.isNone()) {
+        return action;
+      }
+
+      if(res > 0) {
+        m_body->m_progress += res;
+        return repeat();
+      }
+
+      switch(res) {
+        case IOError::RETRY_READ:
+        case IOError::RETRY_WRITE:
+          return repeat();
+        case IOError::ZERO_VALUE:
+          return error<data::stream::AsyncTransferError>("[oatpp::web::protocol::http::outgoing::FileBody::transferAsync()]: Error. Unexpected end of file.");
+        default:
+          return error<data::stream::AsyncTransferError>("[oatpp::web::protocol::http::outgoing::FileBody::transferAsync()]: Error. BROKEN_PIPE.");
+      }
+
+    }
+
+  };
+
+  return TransferCoroutine::start(body, stream);
+
+}
+
+}}}}}
@@ -0,0 +1,156 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_protocol_http_outgoing_FileBody_hpp
+#define oatpp_web_protocol_http_outgoing_FileBody_hpp
+
+#include "./Body.hpp"
+
+#include "oatpp/core/data/stream/FileStream.hpp"
+#include "oatpp/core/data/buffer/IOBuffer.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+/**
+ * Implementation of &id:oatpp::web::protocol::http::outgoing::Body; class.
+ * Sends file (or a single byte range of the file) as http body. <br>
+ * When the target stream is a plain &id:oatpp::network::tcp::Connection; the file is sent with `sendfile(2)` -
+ * file data is not copied to user space. For other streams (proxies, virtual connections, etc.) file data is read
+ * with &l:FileBody::read (); and sent with a regular buffered copy.
+ */
+class FileBody : public oatpp::base::Countable, public Body {
+private:
+  data::stream::FileInputStream m_stream;
+  data::share::StringKeyLabel m_contentType;
+  v_int64 m_fileSize;
+  v_int64 m_rangeStart;
+  v_int64 m_size;
+  v_int64 m_progress;
+  bool m_isRange;
+  bool m_isRangeSatisfiable;
+private:
+  void applyRange(const oatpp::String& range);
+public:
+
+  /**
+   * Constructor.
+   * @param filename - file to send.
+   * @param contentType - type of the content. May be empty.
+   * @param range - value of the request `Range` header. `nullptr` - send the whole file.
+   * Only a single `bytes` range is supported - the whole file is sent for unsupported or malformed ranges.
+   * @throws - `std::runtime_error` if file can't be opened.
+   */
+  FileBody(const oatpp::String& filename,
+           const data::share::StringKeyLabel& contentType,
+           const oatpp::String& range);
+
+  /**
+   * Create shared FileBody.
+   * @param filename - file to send.
+   * @param contentType - type of the content.
+   * @param range - value of the request `Range` header. `nullptr` - send the whole file.
+   * @return - `std::shared_ptr` to FileBody.
+   * @throws - `std::runtime_error` if file can't be opened.
+   */
+  static std::shared_ptr<FileBody> createShared(const oatpp::String& filename,
+                                                const data::share::StringKeyLabel& contentType = data::share::StringKeyLabel(),
+                                                const oatpp::String& range = nullptr);
+
+  /**
+   * Read operation callback. Reads file data within the selected range.
+   * @param buffer - pointer to buffer.
+   * @param count - size of the buffer in bytes.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes written to buffer. 0 - to indicate end-of-file.
+   */
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
+
+  /**
+   * Declare `Content-Type`, `Accept-Ranges` and `Content-Range` (for range requests) headers.
+   * @param headers - &id:oatpp::web::protocol::http::Headers;.
+   */
+  void declareHeaders(Headers& headers) override;
+
+  /**
+   * File data is not in memory.
+   * @return - always `nullptr`.
+   */
+  p_char8 getKnownData() override;
+
+  /**
+   * Size of the data to send - size of the file or size of the selected range.
+   * @return - `v_int64`.
+   */
+  v_int64 getKnownSize() override;
+
+  /**
+   * Size of the whole file.
+   * @return
+   */
+  v_int64 getFileSize() const;
+
+  /**
+   * Check if a valid single byte range was requested.
+   * @return
+   */
+  bool isRange() const;
+
+  /**
+   * Check if the requested range can be served. Unsatisfiable range results in empty body.
+   * @return
+   */
+  bool isRangeSatisfiable() const;
+
+  /**
+   * Get status suitable for this body - `200`, `206` (Partial Content) or `416` (Range Not Satisfiable).
+   * @return - &id:oatpp::web::protocol::http::Status;.
+   */
+  const Status& getStatus() const;
+
+  /**
+   * Send body data to the stream. Uses `sendfile(2)` when stream is a plain &id:oatpp::network::tcp::Connection;.
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @param buffer - buffer for the fallback copy.
+   * @param bufferSize - size of the buffer.
+   * @return - number of bytes sent.
+   * @throws - `std::runtime_error` if the file ends before the declared body size is sent.
+   */
+  v_io_size transfer(data::stream::OutputStream* stream, void* buffer, v_buff_size bufferSize);
+
+  /**
+   * Same as &l:FileBody::transfer (); but Async.
+   * @param body - `std::shared_ptr` to FileBody.
+   * @param stream - `std::shared_ptr` to &id:oatpp::data::stream::OutputStream;.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  static async::CoroutineStarter transferAsync(const std::shared_ptr<FileBody>& body,
+                                               const std::shared_ptr<data::stream::OutputStream>& stream);
+
+};
+
+}}}}}
+
+#endif /* oatpp_web_protocol_http_outgoing_FileBody_hpp */
@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include "./Response.hpp"
+#include "./FileBody.hpp"
 
 #include "oatpp/web/protocol/http/encoding/Chunked.hpp"
 #include "oatpp/core/utils/ConversionUtils.hpp"
@@ -105,9 +106,18 @@ std::shared_ptr<const Response::ConnectionHandler::ParameterMap> Response::getCo
   return m_connectionUpgradeParameters;
 }
 
+void Response::setChunkCoalescing(const encoding::EncoderChunked::Coalescing& coalescing) {
+  m_chunkCoalescing = coalescing;
+}
+
+const encoding::EncoderChunked::Coalescing& Response::getChunkCoalescing() const {
+  return m_chunkCoalescing;
+}
+
 void Response::send(data::stream::OutputStream* stream,
                     data::stream::BufferOutputStream* headersWriteBuffer,
-                    http::encoding::EncoderProvider* contentEncoderProvider)
+                    http::encoding::EncoderProvider* contentEncoderProvider,
+                    v_buff_size pipelineHoldThreshold)
 {
 
   v_int64 bodySize = -1;
@@ -135,7 +145,9 @@ void Response::send(data::stream::OutputStream* stream,
     m_headers.put_LockFree(Header::CONTENT_LENGTH, "0");
   }
 
-  headersWriteBuffer->setCurrentPosition(0);
+  if(pipelineHoldThreshold < 0) {
+    headersWriteBuffer->setCurrentPosition(0);
+  }
 
   headersWriteBuffer->writeSimple("HTTP/1.1 ", 9);
   headersWriteBuffer->writeAsString(m_status.code);
@@ -157,24 +169,36 @@ void Response::send(data::stream::OutputStream* stream,
           headersWriteBuffer->flushToStream(stream);
           /* Reuse headers buffer */
           /* Transfer without chunked encoder */
-          data::stream::transfer(m_body, stream, 0, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity());
-        } else { 
-          if (bodySize + headersWriteBuffer->getCurrentPosition() < headersWriteBuffer->getCapacity()) {
-            headersWriteBuffer->writeSimple(m_body->getKnownData(), bodySize);
-            headersWriteBuffer->flushToStream(stream);
+          auto fileBody = std::dynamic_pointer_cast<FileBody>(m_body);
+          if(fileBody) {
+            fileBody->transfer(stream, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity());
           } else {
-            headersWriteBuffer->flushToStream(stream);
-            stream->writeExactSizeDataSimple(m_body->getKnownData(), bodySize);
+            data::stream::transfer(m_body, stream, 0, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity());
           }
+        } else if (bodySize + headersWriteBuffer->getCurrentPosition() < headersWriteBuffer->getCapacity()) {
+          headersWriteBuffer->writeSimple(m_body->getKnownData(), bodySize);
+          if(headersWriteBuffer->getCurrentPosition() < pipelineHoldThreshold) {
+            return; // hold the response
+          }
+          headersWriteBuffer->flushToStream(stream);
+        } else {
+          /* Headers and body go out with a single vectored write - no copy */
+          data::stream::IOVector vectors[2] = {
+            {headersWriteBuffer->getData(), headersWriteBuffer->getCurrentPosition()},
+            {m_body->getKnownData(), bodySize}
+          };
+          data::stream::InlineWriteVectorData writeData(vectors, 2);
+          stream->writevExactSizeDataSimple(writeData);
         }
       } else {
 
-        headersWriteBuffer->flushToStream(stream);
-
-        http::encoding::EncoderChunked chunkedEncoder;
-
-        /* Reuse headers buffer */
-        data::stream::transfer(m_body, stream, 0, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity(), &chunkedEncoder);
+        /* Headers go out together with the first chunk. Reuse headers buffer - chunk data is read right after the headers */
+        headersWriteBuffer->reserveBytesUpfront(data::buffer::IOBuffer::BUFFER_SIZE);
+        auto prefixSize = headersWriteBuffer->getCurrentPosition();
+        http::encoding::EncoderChunked::transfer(m_body, stream,
+                                                 headersWriteBuffer->getData(), prefixSize,
+                                                 headersWriteBuffer->getData() + prefixSize, headersWriteBuffer->getCapacity() - prefixSize,
+                                                 m_chunkCoalescing);
 
       }
 
@@ -196,15 +220,21 @@ void Response::send(data::stream::OutputStream* stream,
     }
 
   } else {
+    if(headersWriteBuffer->getCurrentPosition() < pipelineHoldThreshold) {
+      return; // hold the response
+    }
     headersWriteBuffer->flushToStream(stream);
   }
 
+  headersWriteBuffer->setCurrentPosition(0);
+
 }
 
 oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Response>& _this,
                                                    const std::shared_ptr<data::stream::OutputStream>& stream,
                                                    const std::shared_ptr<oatpp::data::stream::BufferOutputStream>& headersWriteBuffer,
-                                                   const std::shared_ptr<http::encoding::EncoderProvider>& contentEncoder)
+                                                   const std::shared_ptr<http::encoding::EncoderProvider>& contentEncoder,
+                                                   v_buff_size pipelineHoldThreshold)
 {
 
   class SendAsyncCoroutine : public oatpp::async::Coroutine<SendAsyncCoroutine> {
@@ -213,16 +243,21 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
     std::shared_ptr<data::stream::OutputStream> m_stream;
     std::shared_ptr<oatpp::data::stream::BufferOutputStream> m_headersWriteBuffer;
     std::shared_ptr<http::encoding::EncoderProvider> m_contentEncoderProvider;
+    v_buff_size m_pipelineHoldThreshold;
+    data::stream::IOVector m_vectors[2];
+    data::stream::InlineWriteVectorData m_writeData;
   public:
 
     SendAsyncCoroutine(const std::shared_ptr<Response>& _this,
                        const std::shared_ptr<data::stream::OutputStream>& stream,
                        const std::shared_ptr<oatpp::data::stream::BufferOutputStream>& headersWriteBuffer,
-                       const std::shared_ptr<http::encoding::EncoderProvider>& contentEncoderProvider)
+                       const std::shared_ptr<http::encoding::EncoderProvider>& contentEncoderProvider,
+                       v_buff_size pipelineHoldThreshold)
       : m_this(_this)
       , m_stream(stream)
       , m_headersWriteBuffer(headersWriteBuffer)
       , m_contentEncoderProvider(contentEncoderProvider)
+      , m_pipelineHoldThreshold(pipelineHoldThreshold)
     {}
 
     Action act() override {
@@ -252,7 +287,9 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
         m_this->m_headers.put_LockFree(Header::CONTENT_LENGTH, "0");
       }
 
-      m_headersWriteBuffer->setCurrentPosition(0);
+      if(m_pipelineHoldThreshold < 0) {
+        m_headersWriteBuffer->setCurrentPosition(0);
+      }
 
       m_headersWriteBuffer->writeSimple("HTTP/1.1 ", 9);
       m_headersWriteBuffer->writeAsString(m_this->m_status.code);
@@ -270,25 +307,39 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
 
           if (bodySize >= 0) {
 
-            if (bodySize + m_headersWriteBuffer->getCurrentPosition() < m_headersWriteBuffer->getCapacity()) {
-
-              m_headersWriteBuffer->writeSimple(m_this->m_body->getKnownData(), bodySize);
+            if(m_this->m_body->getKnownData() == nullptr) {
+              auto fileBody = std::dynamic_pointer_cast<FileBody>(m_this->m_body);
+              if(fileBody) {
+                return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
+                  .next(FileBody::transferAsync(fileBody, m_stream))
+                  .next(yieldTo(&SendAsyncCoroutine::onSent));
+              }
               return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-                .next(finish());
-
-            } else {
+                .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, data::buffer::IOBuffer::createShared()))
+                .next(yieldTo(&SendAsyncCoroutine::onSent));
+            }
 
+            if (bodySize + m_headersWriteBuffer->getCurrentPosition() < m_headersWriteBuffer->getCapacity()) {
+              m_headersWriteBuffer->writeSimple(m_this->m_body->getKnownData(), bodySize);
+              if(m_headersWriteBuffer->getCurrentPosition() < m_pipelineHoldThreshold) {
+                return finish(); // hold the response
+              }
               return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-                .next(m_stream->writeExactSizeDataAsync(m_this->m_body->getKnownData(), bodySize))
-                .next(finish());
+                .next(yieldTo(&SendAsyncCoroutine::onSent));
             }
 
+            /* Headers and body go out with a single vectored write - no copy */
+            m_vectors[0] = {m_headersWriteBuffer->getData(), m_headersWriteBuffer->getCurrentPosition()};
+            m_vectors[1] = {m_this->m_body->getKnownData(), bodySize};
+            m_writeData.set(m_vectors, 2);
+            return yieldTo(&SendAsyncCoroutine::writeVectors);
+
           } else {
 
-            auto chunkedEncoder = std::make_shared<http::encoding::EncoderChunked>();
-            return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-              .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, data::buffer::IOBuffer::createShared(), chunkedEncoder))
-              .next(finish());
+            /* Headers go out together with the first chunk */
+            return http::encoding::EncoderChunked::transferAsync(m_this->m_body, m_stream, m_headersWriteBuffer, data::buffer::IOBuffer::createShared(),
+                                                                 m_this->m_chunkCoalescing)
+              .next(yieldTo(&SendAsyncCoroutine::onSent));
 
           }
 
@@ -303,22 +354,34 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
           }));
 
           return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-            .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, data::buffer::IOBuffer::createShared(), pipeline)
-            . next(finish()));
+            .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, data::buffer::IOBuffer::createShared(), pipeline))
+            .next(yieldTo(&SendAsyncCoroutine::onSent));
 
         }
 
       } else {
 
+        if(m_headersWriteBuffer->getCurrentPosition() < m_pipelineHoldThreshold) {
+          return finish(); // hold the response
+        }
         return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-          .next(finish());
+          .next(yieldTo(&SendAsyncCoroutine::onSent));
       }
 
     }
 
+    Action writeVectors() {
+      return m_stream->writevExactSizeDataAsyncInline(m_writeData, yieldTo(&SendAsyncCoroutine::onSent));
+    }
+
+    Action onSent() {
+      m_headersWriteBuffer->setCurrentPosition(0);
+      return finish();
+    }
+
   };
 
-  return SendAsyncCoroutine::start(_this, stream, headersWriteBuffer, contentEncoder);
+  return SendAsyncCoroutine::start(_this, stream, headersWriteBuffer, contentEncoder, pipelineHoldThreshold);
 
 }
 
@@ -27,6 +27,7 @@
 
 #include "oatpp/web/protocol/http/outgoing/Body.hpp"
 #include "oatpp/web/protocol/http/encoding/EncoderProvider.hpp"
+#include "oatpp/web/protocol/http/encoding/Chunked.hpp"
 #include "oatpp/web/protocol/http/Http.hpp"
 
 #include "oatpp/network/ConnectionHandler.hpp"
@@ -60,6 +61,7 @@ private:
   std::shared_ptr<ConnectionHandler> m_connectionUpgradeHandler;
   std::shared_ptr<const ConnectionHandler::ParameterMap> m_connectionUpgradeParameters;
   data::Bundle m_bundle;
+  encoding::EncoderChunked::Coalescing m_chunkCoalescing;
 public:
   /**
    * Constructor.
@@ -199,15 +201,37 @@ public:
    */
   std::shared_ptr<const ConnectionHandler::ParameterMap> getConnectionUpgradeParameters();
 
+  /**
+   * Set chunk coalescing for the body of unknown size sent with chunked transfer-encoding. <br>
+   * Use it for streaming bodies producing many small portions of data (ex.: SSE, NDJSON)
+   * to put out fewer, larger chunks. See &id:oatpp::web::protocol::http::encoding::EncoderChunked::Coalescing;.
+   * @param coalescing - &id:oatpp::web::protocol::http::encoding::EncoderChunked::Coalescing;.
+   */
+  void setChunkCoalescing(const encoding::EncoderChunked::Coalescing& coalescing);
+
+  /**
+   * Get chunk coalescing options.
+   * @return - &id:oatpp::web::protocol::http::encoding::EncoderChunked::Coalescing;.
+   */
+  const encoding::EncoderChunked::Coalescing& getChunkCoalescing() const;
+
   /**
    * Write this Response to stream.
    * @param stream - pointer to &id:oatpp::data::stream::OutputStream;.
    * @param headersWriteBuffer - pointer to &id:oatpp::data::stream::BufferOutputStream;.
    * @param contentEncoder - pointer to &id:oatpp::web::protocol::http::encoding::EncoderProvider;.
+   * @param pipelineHoldThreshold - write coalescing for pipelined requests: <br>
+   * <ul>
+   *   <li>`-1` - `headersWriteBuffer` is cleared before the response is written.</li>
+   *   <li>`>= 0` - response is written after the responses held in `headersWriteBuffer` by previous calls and is put out together with them.
+   *   Response is held in the buffer as well (nothing is written to stream) if it fits the buffer completely and the buffer holds less than
+   *   `pipelineHoldThreshold` bytes. Otherwise the buffer is empty after the call.</li>
+   * </ul>
    */
   void send(data::stream::OutputStream* stream,
             data::stream::BufferOutputStream* headersWriteBuffer,
-            http::encoding::EncoderProvider* contentEncoderProvider);
+            http::encoding::EncoderProvider* contentEncoderProvider,
+            v_buff_size pipelineHoldThreshold = -1);
 
   /**
    * Same as &l:Response::send (); but async.
@@ -215,12 +239,14 @@ public:
    * @param stream - `std::shared_ptr` to &id:oatpp::data::stream::OutputStream;.
    * @param headersWriteBuffer - `std::shared_ptr` to &id:oatpp::data::stream::BufferOutputStream;.
    * @param contentEncoderProvider - `std::shared_ptr` to &id:oatpp::web::protocol::http::encoding::EncoderProvider;.
+   * @param pipelineHoldThreshold - write coalescing for pipelined requests. See &l:Response::send ();.
    * @return - &id:oatpp::async::CoroutineStarter;.
    */
   static oatpp::async::CoroutineStarter sendAsync(const std::shared_ptr<Response>& _this,
                                                   const std::shared_ptr<data::stream::OutputStream>& stream,
                                                   const std::shared_ptr<data::stream::BufferOutputStream>& headersWriteBuffer,
-                                                  const std::shared_ptr<http::encoding::EncoderProvider>& contentEncoderProvider);
+                                                  const std::shared_ptr<http::encoding::EncoderProvider>& contentEncoderProvider,
+                                                  v_buff_size pipelineHoldThreshold = -1);
   
 };
   
@@ -25,6 +25,8 @@
 #include "./ResponseFactory.hpp"
 
 #include "./BufferBody.hpp"
+#include "./DtoBody.hpp"
+#include "./FileBody.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
 
@@ -42,11 +44,19 @@ std::shared_ptr<Response>
 ResponseFactory::createResponse(const Status& status,
                                 const oatpp::Void& dto,
                                 const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper) {
-  return Response::createShared(status, BufferBody::createShared(
-    objectMapper->writeToString(dto),
+  return Response::createShared(status, DtoBody::createShared(
+    objectMapper->createWriter(dto),
     objectMapper->getInfo().http_content_type
   ));
 }
 
+std::shared_ptr<Response>
+ResponseFactory::createFileResponse(const oatpp::String& filename,
+                                    const oatpp::String& range,
+                                    const data::share::StringKeyLabel& contentType) {
+  auto body = FileBody::createShared(filename, contentType, range);
+  return Response::createShared(body->getStatus(), body);
+}
+
   
 }}}}}
@@ -54,7 +54,14 @@ public:
   static std::shared_ptr<Response> createResponse(const Status& status, const oatpp::String& text);
 
   /**
-   * Create &id:oatpp::web::protocol::http::outgoing::Response; with &id:oatpp::web::protocol::http::outgoing::DtoBody;.
+   * Create &id:oatpp::web::protocol::http::outgoing::Response; with &id:oatpp::web::protocol::http::outgoing::DtoBody;. <br>
+   * Only the first &id:oatpp::web::protocol::http::outgoing::DtoBody::DEFAULT_PREFETCH_SIZE; bytes are serialized here.
+   * A larger DTO is serialized while the response is being sent, so:
+   * <ul>
+   *   <li>Serialization errors in its remaining part happen after the response headers are sent -
+   *   the error can't be reported to the client and the connection is dropped.</li>
+   *   <li>The DTO is read at send time - don't modify it after the response is created.</li>
+   * </ul>
    * @param status - &id:oatpp::web::protocol::http::Status;.
    * @param dto - see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/).
    * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper;.
@@ -63,6 +70,19 @@ public:
   static std::shared_ptr<Response> createResponse(const Status& status,
                                                   const oatpp::Void& dto,
                                                   const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper);
+
+  /**
+   * Create &id:oatpp::web::protocol::http::outgoing::Response; with &id:oatpp::web::protocol::http::outgoing::FileBody;. <br>
+   * Response status is `200`, `206` (Partial Content) or `416` (Range Not Satisfiable) depending on the requested range.
+   * @param filename - file to send.
+   * @param range - value of the request `Range` header. `nullptr` - send the whole file.
+   * @param contentType - type of the content. May be empty.
+   * @return - `std::shared_ptr` to &id:oatpp::web::protocol::http::outgoing::Response;.
+   * @throws - `std::runtime_error` if file can't be opened.
+   */
+  static std::shared_ptr<Response> createFileResponse(const oatpp::String& filename,
+                                                      const oatpp::String& range = nullptr,
+                                                      const data::share::StringKeyLabel& contentType = data::share::StringKeyLabel());
   
 };
   
@@ -0,0 +1,213 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HeadersScanner.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define OATPP_HEADERS_SCANNER_SSE2
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #endif
+#endif
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace utils {
+
+#ifdef OATPP_HEADERS_SCANNER_SSE2
+namespace {
+
+  v_int32 countTrailingZeros(v_uint32 mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (v_int32) index;
+#else
+    return __builtin_ctz(mask);
+#endif
+  }
+
+}
+#endif
+
+HeadersScanner::HeadersScanner() {
+  reset();
+}
+
+void HeadersScanner::reset() {
+  m_accumulator = 0;
+  m_scannedSize = 0;
+  m_done = false;
+  m_lineEndsCount = 0;
+}
+
+v_buff_size HeadersScanner::findNewLine(const v_char8* data, v_buff_size from, v_buff_size size) {
+
+#ifdef OATPP_HEADERS_SCANNER_SSE2
+  const __m128i newLine = _mm_set1_epi8('\n');
+  while(from + 16 <= size) {
+    __m128i block = _mm_loadu_si128((const __m128i*) (data + from));
+    v_uint32 mask = (v_uint32) _mm_movemask_epi8(_mm_cmpeq_epi8(block, newLine));
+    if(mask != 0) {
+      return from + countTrailingZeros(mask);
+    }
+    from += 16;
+  }
+#endif
+
+  if(from >= size) {
+    return -1;
+  }
+
+  auto found = (const v_char8*) std::memchr(data + from, '\n', size - from);
+  if(found == nullptr) {
+    return -1;
+  }
+  return found - data;
+
+}
+
+void HeadersScanner::addLineEnd(v_buff_size position) {
+  if(m_lineEndsCount < MAX_INDEXED_LINES) {
+    m_lineEnds[m_lineEndsCount ++] = position;
+  }
+}
+
+v_buff_size HeadersScanner::scan(const v_char8* data, v_buff_size size) {
+
+  if(m_done) {
+    return 0;
+  }
+
+  /* First bytes of the chunk may complete a line end or the section end started in the previous chunk */
+  v_buff_size head = size < 3 ? size : 3;
+  for(v_buff_size i = 0; i < head; i ++) {
+    m_accumulator = (m_accumulator << 8) | data[i];
+    if((m_accumulator & 0xFFFF) == (('\r' << 8) | '\n')) {
+      addLineEnd(m_scannedSize + i - 1);
+      if(m_accumulator == SECTION_END) {
+        m_done = true;
+        m_scannedSize += i + 1;
+        return i + 1;
+      }
+    }
+  }
+
+  v_buff_size pos = findNewLine(data, head, size);
+  while(pos >= 0) {
+    if(data[pos - 1] == '\r') {
+      addLineEnd(m_scannedSize + pos - 1);
+      if(data[pos - 2] == '\n' && data[pos - 3] == '\r') {
+        m_done = true;
+        m_scannedSize += pos + 1;
+        return pos + 1;
+      }
+    }
+    pos = findNewLine(data, pos + 1, size);
+  }
+
+  if(size > 3) {
+    m_accumulator = ((v_uint32) data[size - 4] << 24) | ((v_uint32) data[size - 3] << 16) |
+                    ((v_uint32) data[size - 2] << 8) | data[size - 1];
+  }
+  m_scannedSize += size;
+
+  return -1;
+
+}
+
+bool HeadersScanner::isDone() const {
+  return m_done;
+}
+
+void HeadersScanner::parseHeaders(Headers& headers,
+                                  const std::shared_ptr<std::string>& headersText,
+                                  oatpp::parser::Caret& caret,
+                                  Status& error) const
+{
+
+  const char* data = caret.getData();
+  v_buff_size pos = caret.getPosition();
+
+  v_int32 line = 0;
+  while(line < m_lineEndsCount && m_lineEnds[line] < pos) {
+    line ++;
+  }
+
+  while(line < m_lineEndsCount) {
+
+    v_buff_size lineEnd = m_lineEnds[line];
+
+    if(pos == lineEnd) {
+      caret.setPosition(pos);
+      caret.skipRN();
+      return;
+    }
+
+    /* Same rules as in Parser::parseOneHeader but all lookups are bounded by the known line end */
+
+    while(pos < lineEnd && data[pos] == ' ') pos ++;
+
+    v_buff_size namePos = pos;
+    while(pos < lineEnd && data[pos] != ':' && data[pos] != ' ') pos ++;
+    if(pos == lineEnd) {
+      /* Unusual line - let the generic parser handle it along with the rest of the section */
+      caret.setPosition(namePos);
+      Parser::parseHeaders(headers, headersText, caret, error);
+      return;
+    }
+
+    if(pos == namePos) {
+      /* Empty header name */
+      caret.setPosition(pos);
+      error = Status::CODE_431;
+      return;
+    }
+
+    oatpp::data::share::StringKeyLabelCI name(headersText, &data[namePos], pos - namePos);
+
+    while(pos < lineEnd && data[pos] == ' ') pos ++;
+    if(data[pos] != ':') {
+      caret.setPosition(pos);
+      error = Status::CODE_400;
+      return;
+    }
+    pos ++;
+    while(pos < lineEnd && data[pos] == ' ') pos ++;
+
+    headers.put_LockFree(name, oatpp::data::share::StringKeyLabel(headersText, &data[pos], lineEnd - pos));
+
+    pos = lineEnd + 2;
+    line ++;
+
+  }
+
+  /* Section has more lines than indexed by the scanner */
+  caret.setPosition(pos);
+  Parser::parseHeaders(headers, headersText, caret, error);
+
+}
+
+}}}}}
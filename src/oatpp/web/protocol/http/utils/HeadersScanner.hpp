@@ -0,0 +1,103 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_protocol_http_utils_HeadersScanner_hpp
+#define oatpp_web_protocol_http_utils_HeadersScanner_hpp
+
+#include "oatpp/web/protocol/http/Http.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace utils {
+
+/**
+ * Incremental scanner of http headers section. <br>
+ * Looks for the end of headers section (`\r\n\r\n`) in data chunks as they arrive and
+ * records positions of line ends on the way, so that headers can be tokenized without scanning the same bytes again. <br>
+ * Uses SSE2 to search for `\n` when available.
+ */
+class HeadersScanner {
+public:
+
+  /**
+   * Max number of line ends recorded by the scanner.
+   * Lines beyond this number are parsed by &id:oatpp::web::protocol::http::Parser;.
+   */
+  static constexpr v_int32 MAX_INDEXED_LINES = 64;
+
+private:
+  static constexpr v_uint32 SECTION_END = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
+private:
+  static v_buff_size findNewLine(const v_char8* data, v_buff_size from, v_buff_size size);
+private:
+  void addLineEnd(v_buff_size position);
+private:
+  v_uint32 m_accumulator;
+  v_buff_size m_scannedSize;
+  bool m_done;
+  v_buff_size m_lineEnds[MAX_INDEXED_LINES];
+  v_int32 m_lineEndsCount;
+public:
+
+  /**
+   * Constructor.
+   */
+  HeadersScanner();
+
+  /**
+   * Reset scanner state to start scanning new headers section.
+   */
+  void reset();
+
+  /**
+   * Scan next chunk of headers section.
+   * @param data - chunk data. Chunk is expected to follow previously scanned chunk in the headers section.
+   * @param size - chunk size.
+   * @return - number of bytes of the chunk which belong to the headers section if section end is found (including `\r\n\r\n`). <br>
+   * `-1` - if section end is not found in this chunk.
+   */
+  v_buff_size scan(const v_char8* data, v_buff_size size);
+
+  /**
+   * Check if the end of headers section is found.
+   * @return
+   */
+  bool isDone() const;
+
+  /**
+   * Parse headers using line ends recorded during scan.
+   * Behaves like &id:oatpp::web::protocol::http::Parser::parseHeaders;.
+   * @param headers - &id:oatpp::web::protocol::http::Headers; to put parsed headers to.
+   * @param headersText - memory handle of the headers section. May be `nullptr`.
+   * @param caret - caret over the scanned headers section positioned at the beginning of the first header line.
+   * @param error - out parameter. &id:oatpp::web::protocol::http::Status;.
+   */
+  void parseHeaders(Headers& headers,
+                    const std::shared_ptr<std::string>& headersText,
+                    oatpp::parser::Caret& caret,
+                    Status& error) const;
+
+};
+
+}}}}}
+
+#endif // oatpp_web_protocol_http_utils_HeadersScanner_hpp
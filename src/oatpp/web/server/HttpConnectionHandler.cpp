@@ -66,15 +66,35 @@ v_uint64 HttpConnectionHandler::getConnectionsCount() {
   return m_connections.size();
 }
 
+HttpWorkerPool* HttpConnectionHandler::getWorkerPool() {
+  return m_workerPool.get();
+}
+
 HttpConnectionHandler::HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components)
   : m_components(components)
   , m_continue(true)
 {}
 
+HttpConnectionHandler::HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components,
+                                             const std::shared_ptr<HttpWorkerPool::Config>& workerPoolConfig)
+  : m_components(components)
+  , m_continue(true)
+{
+  if(workerPoolConfig) {
+    m_workerPool.reset(new HttpWorkerPool(*workerPoolConfig));
+  }
+}
+
 std::shared_ptr<HttpConnectionHandler> HttpConnectionHandler::createShared(const std::shared_ptr<HttpRouter>& router){
   return std::make_shared<HttpConnectionHandler>(router);
 }
 
+std::shared_ptr<HttpConnectionHandler> HttpConnectionHandler::createShared(const std::shared_ptr<HttpRouter>& router,
+                                                                           const std::shared_ptr<HttpWorkerPool::Config>& workerPoolConfig)
+{
+  return std::make_shared<HttpConnectionHandler>(router, workerPoolConfig);
+}
+
 void HttpConnectionHandler::setErrorHandler(const std::shared_ptr<handler::ErrorHandler>& errorHandler){
   m_components->errorHandler = errorHandler;
   if(!m_components->errorHandler) {
@@ -101,6 +121,14 @@ void HttpConnectionHandler::handleConnection(const provider::ResourceHandle<data
     connection.object->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
     connection.object->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
 
+    if(m_workerPool) {
+      if(!m_workerPool->submit(HttpProcessor::Task(m_components, connection, this))) {
+        /* Rejected. Task is destroyed here and the connection is closed */
+        connection.invalidator->invalidate(connection.object);
+      }
+      return;
+    }
+
     /* Create working thread */
     std::thread thread(&HttpProcessor::Task::run, std::move(HttpProcessor::Task(m_components, connection, this)));
 
@@ -130,6 +158,10 @@ void HttpConnectionHandler::stop() {
   while(getConnectionsCount() > 0) {
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
   }
+
+  if(m_workerPool) {
+    m_workerPool->stop();
+  }
 }
 
 }}}
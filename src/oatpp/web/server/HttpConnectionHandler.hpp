@@ -26,6 +26,7 @@
 #define oatpp_web_server_HttpConnectionHandler_hpp
 
 #include "oatpp/web/server/HttpProcessor.hpp"
+#include "oatpp/web/server/HttpWorkerPool.hpp"
 #include "oatpp/network/ConnectionHandler.hpp"
 #include "oatpp/core/concurrency/SpinLock.hpp"
 
@@ -35,7 +36,9 @@ namespace oatpp { namespace web { namespace server {
 
 /**
  * Simple ConnectionHandler (&id:oatpp::network::ConnectionHandler;) for handling HTTP communication. <br>
- * Will create one thread per each connection to handle communication.
+ * Will create one thread per each connection to handle communication. <br>
+ * If &id:oatpp::web::server::HttpWorkerPool::Config; is provided, connections are served by the fixed-size
+ * &id:oatpp::web::server::HttpWorkerPool; instead.
  */
 class HttpConnectionHandler : public base::Countable, public network::ConnectionHandler, public HttpProcessor::TaskProcessingListener {
 protected:
@@ -50,6 +53,7 @@ private:
   std::atomic_bool m_continue;
   std::unordered_map<v_uint64, provider::ResourceHandle<data::stream::IOStream>> m_connections;
   oatpp::concurrency::SpinLock m_connectionsLock;
+  std::unique_ptr<HttpWorkerPool> m_workerPool;
 public:
 
   /**
@@ -58,6 +62,24 @@ public:
    */
   HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components);
 
+  /**
+   * Constructor.
+   * @param components - &id:oatpp::web::server::HttpProcessor::Components;.
+   * @param workerPoolConfig - &id:oatpp::web::server::HttpWorkerPool::Config;. If `nullptr` - one thread per connection is used.
+   */
+  HttpConnectionHandler(const std::shared_ptr<HttpProcessor::Components>& components,
+                        const std::shared_ptr<HttpWorkerPool::Config>& workerPoolConfig);
+
+  /**
+   * Constructor.
+   * @param router - &id:oatpp::web::server::HttpRouter; to route incoming requests.
+   * @param workerPoolConfig - &id:oatpp::web::server::HttpWorkerPool::Config;.
+   */
+  HttpConnectionHandler(const std::shared_ptr<HttpRouter>& router,
+                        const std::shared_ptr<HttpWorkerPool::Config>& workerPoolConfig)
+    : HttpConnectionHandler(std::make_shared<HttpProcessor::Components>(router), workerPoolConfig)
+  {}
+
   /**
    * Constructor.
    * @param router - &id:oatpp::web::server::HttpRouter; to route incoming requests.
@@ -85,6 +107,15 @@ public:
    */
   static std::shared_ptr<HttpConnectionHandler> createShared(const std::shared_ptr<HttpRouter>& router);
 
+  /**
+   * Create shared HttpConnectionHandler serving connections by the fixed-size worker pool.
+   * @param router - &id:oatpp::web::server::HttpRouter; to route incoming requests.
+   * @param workerPoolConfig - &id:oatpp::web::server::HttpWorkerPool::Config;.
+   * @return - `std::shared_ptr` to HttpConnectionHandler.
+   */
+  static std::shared_ptr<HttpConnectionHandler> createShared(const std::shared_ptr<HttpRouter>& router,
+                                                             const std::shared_ptr<HttpWorkerPool::Config>& workerPoolConfig);
+
   /**
    * Set root error handler for all requests coming through this Connection Handler.
    * All unhandled errors will be handled by this error handler.
@@ -123,6 +154,12 @@ public:
    * @return
    */
   v_uint64 getConnectionsCount();
+
+  /**
+   * Get worker pool.
+   * @return - &id:oatpp::web::server::HttpWorkerPool;. `nullptr` if connections are served one thread per connection.
+   */
+  HttpWorkerPool* getWorkerPool();
   
 };
   
@@ -46,6 +46,7 @@ HttpProcessor::Components::Components(const std::shared_ptr<HttpRouter>& pRouter
   , requestInterceptors(pRequestInterceptors)
   , responseInterceptors(pResponseInterceptors)
   , config(pConfig)
+  , bufferPool(data::buffer::BufferPool::createShared())
 {}
 
 HttpProcessor::Components::Components(const std::shared_ptr<HttpRouter>& pRouter)
@@ -125,12 +126,58 @@ HttpProcessor::processNextRequest(ProcessingResources& resources,
 
 }
 
+bool HttpProcessor::isRequestHeadBuffered(data::stream::InputStreamBufferedProxy* inStream) {
+
+  auto available = inStream->availableToRead();
+  if(available < 4) {
+    return false;
+  }
+
+  /* same size as the inStream buffer - see ProcessingResources and Coroutine::acquireBuffers() */
+  v_char8 buffer[4096];
+  if(available > (v_io_size) sizeof(buffer)) {
+    available = sizeof(buffer);
+  }
+
+  /* data is already buffered - peek doesn't touch the connection */
+  async::Action action;
+  auto size = inStream->peek(buffer, available, action);
+
+  for(v_io_size i = 3; i < size; i ++) {
+    if(buffer[i] == '\n' && buffer[i - 1] == '\r' && buffer[i - 2] == '\n' && buffer[i - 3] == '\r') {
+      return true;
+    }
+  }
+
+  return false;
+
+}
+
+v_buff_size HttpProcessor::getPipelineHoldThreshold(const std::shared_ptr<Config>& config,
+                                                    data::stream::InputStreamBufferedProxy* inStream,
+                                                    ConnectionState connectionState)
+{
+  /*
+   * Response may wait to be put out together with the following ones only if the whole head of the following request
+   * is buffered. Otherwise the next headers read goes to the connection and held responses would never be sent.
+   */
+  if(config->pipelineFlushThreshold > 0 && connectionState == ConnectionState::ALIVE && isRequestHeadBuffered(inStream)) {
+    return config->pipelineFlushThreshold;
+  }
+  return 0;
+}
+
 HttpProcessor::ConnectionState HttpProcessor::processNextRequest(ProcessingResources& resources) {
 
   oatpp::web::protocol::http::HttpError::Info error;
   auto headersReadResult = resources.headersReader.readHeaders(resources.inStream.get(), error);
 
   if(error.ioStatus <= 0) {
+    /* deliver responses held for pipelined requests */
+    if(resources.headersOutBuffer.getCurrentPosition() > 0) {
+      resources.headersOutBuffer.flushToStream(resources.connection.object.get());
+      resources.headersOutBuffer.setCurrentPosition(0);
+    }
     return ConnectionState::DEAD;
   }
 
@@ -194,7 +241,8 @@ HttpProcessor::ConnectionState HttpProcessor::processNextRequest(ProcessingResou
   auto contentEncoderProvider =
     protocol::http::utils::CommunicationUtils::selectEncoder(request, resources.components->contentEncodingProviders);
 
-  response->send(resources.connection.object.get(), &resources.headersOutBuffer, contentEncoderProvider.get());
+  response->send(resources.connection.object.get(), &resources.headersOutBuffer, contentEncoderProvider.get(),
+                 getPipelineHoldThreshold(resources.components->config, resources.inStream.get(), connectionState));
 
   /* Delegate connection handling to another handler only after the response is sent to the client */
   if(connectionState == ConnectionState::DELEGATED) {
@@ -221,6 +269,7 @@ HttpProcessor::Task::Task(const std::shared_ptr<Components>& components,
   : m_components(components)
   , m_connection(connection)
   , m_taskListener(taskListener)
+  , m_pollable(true)
 {
   m_taskListener->onTaskStart(m_connection);
 }
@@ -229,6 +278,8 @@ HttpProcessor::Task::Task(HttpProcessor::Task &&other)
   : m_components(std::move(other.m_components))
   , m_connection(std::move(other.m_connection))
   , m_taskListener(other.m_taskListener)
+  , m_resources(std::move(other.m_resources))
+  , m_pollable(other.m_pollable)
 {
   other.m_taskListener = nullptr;
 }
@@ -243,6 +294,8 @@ HttpProcessor::Task &HttpProcessor::Task::operator=(HttpProcessor::Task &&other)
   m_components = std::move(other.m_components);
   m_connection = std::move(other.m_connection);
   m_taskListener = other.m_taskListener;
+  m_resources = std::move(other.m_resources);
+  m_pollable = other.m_pollable;
   other.m_taskListener = nullptr;
   return *this;
 }
@@ -269,6 +322,72 @@ void HttpProcessor::Task::run(){
 
 }
 
+v_io_handle HttpProcessor::Task::findIOHandle() {
+
+  /*
+   * Probe the connection in non-blocking mode. Streams report the handle to wait on via the async action.
+   * Probed before every park - streams buffering internally (ex.: TLS) may have data while the handle isn't readable.
+   */
+  async::Action action;
+  v_char8 byte;
+
+  m_resources->inStream->setInputStreamIOMode(data::stream::IOMode::ASYNCHRONOUS);
+  auto res = m_resources->inStream->peek(&byte, 1, action);
+  m_resources->inStream->setInputStreamIOMode(data::stream::IOMode::BLOCKING);
+
+  if(action.getType() == async::Action::TYPE_IO_WAIT) {
+    return action.getIOHandle();
+  }
+
+  if(res == IOError::RETRY_READ || res == IOError::RETRY_WRITE) {
+    /* Stream is not backed by a pollable handle. Don't probe it again */
+    m_pollable = false;
+  }
+
+  return INVALID_IO_HANDLE;
+
+}
+
+HttpProcessor::ConnectionState HttpProcessor::Task::iterate(v_io_handle& ioHandle) {
+
+  if(!m_resources) {
+    m_connection.object->initContexts();
+    m_resources = std::make_shared<ProcessingResources>(m_components, m_connection);
+  }
+
+  try {
+
+    while(true) {
+
+      auto connectionState = HttpProcessor::processNextRequest(*m_resources);
+      if(connectionState != ConnectionState::ALIVE) {
+        return connectionState;
+      }
+
+      /* Pipelined request is already buffered */
+      if(m_resources->inStream->availableToRead() > 0) {
+        continue;
+      }
+
+      if(m_pollable) {
+        /* Data buffered by the probe is served on the next iteration */
+        auto handle = findIOHandle();
+        if(handle != INVALID_IO_HANDLE) {
+          ioHandle = handle;
+          return ConnectionState::ALIVE;
+        }
+      }
+
+    }
+
+  } catch (...) {
+    // DO NOTHING
+  }
+
+  return ConnectionState::DEAD;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // HttpProcessor::Coroutine
 
@@ -277,18 +396,61 @@ HttpProcessor::Coroutine::Coroutine(const std::shared_ptr<Components>& component
                                     TaskProcessingListener* taskListener)
   : m_components(components)
   , m_connection(connection)
-  , m_headersInBuffer(components->config->headersInBufferInitial)
-  , m_headersReader(&m_headersInBuffer, components->config->headersReaderChunkSize, components->config->headersReaderMaxSize)
-  , m_headersOutBuffer(std::make_shared<oatpp::data::stream::BufferOutputStream>(components->config->headersOutBufferInitial))
-  , m_inStream(data::stream::InputStreamBufferedProxy::createShared(m_connection.object, std::make_shared<std::string>(data::buffer::IOBuffer::BUFFER_SIZE, 0)))
+  , m_headersReader(nullptr, components->config->headersReaderChunkSize, components->config->headersReaderMaxSize)
   , m_connectionState(ConnectionState::ALIVE)
+  , m_firstByte(0)
+  , m_hasHeldResponses(false)
   , m_taskListener(taskListener)
 {
+  acquireBuffers(false);
   m_taskListener->onTaskStart(m_connection);
 }
 
 HttpProcessor::Coroutine::~Coroutine() {
   m_taskListener->onTaskEnd(m_connection);
+  releaseBuffers();
+}
+
+void HttpProcessor::Coroutine::acquireBuffers(bool hasFirstByte) {
+
+  auto& pool = m_components->bufferPool;
+  auto& config = m_components->config;
+
+  m_headersInBuffer = pool->acquireStream(config->headersInBufferInitial);
+  m_headersReader = RequestHeadersReader(m_headersInBuffer.get(), config->headersReaderChunkSize, config->headersReaderMaxSize);
+  m_headersOutBuffer = pool->acquireStream(config->headersOutBufferInitial);
+  m_inStreamMemory = pool->acquireMemory(data::buffer::IOBuffer::BUFFER_SIZE);
+
+  if(hasFirstByte) {
+    (*m_inStreamMemory)[0] = (char) m_firstByte;
+    m_inStream = data::stream::InputStreamBufferedProxy::createShared(m_connection.object, m_inStreamMemory, 0, 1, true);
+  } else {
+    m_inStream = data::stream::InputStreamBufferedProxy::createShared(m_connection.object, m_inStreamMemory);
+  }
+
+}
+
+void HttpProcessor::Coroutine::releaseBuffers() {
+
+  auto& pool = m_components->bufferPool;
+
+  /* Request headers point to the headers-in buffer - pool it only if nobody else holds the request */
+  bool requestReleased = !m_currentRequest || m_currentRequest.use_count() == 1;
+
+  m_currentRequest.reset();
+  m_currentResponse.reset();
+  m_inStream.reset();
+
+  if(requestReleased) {
+    pool->releaseStream(m_headersInBuffer);
+  } else {
+    m_headersInBuffer.reset();
+  }
+  m_headersReader = RequestHeadersReader(nullptr, m_components->config->headersReaderChunkSize, m_components->config->headersReaderMaxSize);
+
+  pool->releaseStream(m_headersOutBuffer);
+  pool->releaseMemory(m_inStreamMemory);
+
 }
 
 HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::act() {
@@ -376,15 +538,28 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponseFormed() {
   auto contentEncoderProvider =
     protocol::http::utils::CommunicationUtils::selectEncoder(m_currentRequest, m_components->contentEncodingProviders);
 
-  return protocol::http::outgoing::Response::sendAsync(m_currentResponse, m_connection.object, m_headersOutBuffer, contentEncoderProvider)
+  auto pipelineHoldThreshold = getPipelineHoldThreshold(m_components->config, m_inStream.get(), m_connectionState);
+
+  /* Held responses go out together with this one */
+  m_hasHeldResponses = false;
+
+  return protocol::http::outgoing::Response::sendAsync(m_currentResponse, m_connection.object, m_headersOutBuffer, contentEncoderProvider, pipelineHoldThreshold)
          .next(yieldTo(&HttpProcessor::Coroutine::onRequestDone));
 
 }
   
 HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onRequestDone() {
 
+  m_hasHeldResponses = m_headersOutBuffer->getCurrentPosition() > 0;
+
   switch (m_connectionState) {
     case ConnectionState::ALIVE:
+      if(m_components->config->hibernateIdleConnections &&
+         m_inStream->availableToRead() == 0 &&
+         m_currentRequest.use_count() == 1)
+      {
+        return yieldTo(&HttpProcessor::Coroutine::readNextRequest);
+      }
       return yieldTo(&HttpProcessor::Coroutine::parseHeaders);
 
     /* Delegate connection handling to another handler only after the response is sent to the client */
@@ -409,6 +584,73 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onRequestDone() {
 
 }
   
+HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::readNextRequest() {
+
+  /* Same read the headers reader does first - hibernate only if the connection has nothing to give yet */
+  async::Action action;
+  v_char8 byte;
+  auto res = m_inStream->peek(&byte, 1, action);
+
+  if(action.isError()) {
+    return action;
+  }
+
+  /* Read has to wait - IO_WAIT for sockets, WAIT_LIST for virtual connections */
+  if(!action.isNone()) {
+    return yieldTo(&HttpProcessor::Coroutine::hibernate);
+  }
+
+  if(res > 0) {
+    return yieldTo(&HttpProcessor::Coroutine::parseHeaders);
+  }
+
+  if(res == IOError::RETRY_READ || res == IOError::RETRY_WRITE) {
+    return repeat();
+  }
+
+  /* connection is closed by the client */
+  return finish();
+
+}
+
+HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::hibernate() {
+  /* Next request hasn't arrived - give buffers back to the pool until its first byte does */
+  releaseBuffers();
+  return yieldTo(&HttpProcessor::Coroutine::waitForRequest);
+}
+
+HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::waitForRequest() {
+
+  async::Action action;
+  auto res = m_connection.object->read(&m_firstByte, 1, action);
+
+  if(!action.isNone()) {
+    return action;
+  }
+
+  if(res == 1) {
+    acquireBuffers(true);
+    return yieldTo(&HttpProcessor::Coroutine::parseHeaders);
+  }
+
+  if(res == IOError::RETRY_READ || res == IOError::RETRY_WRITE) {
+    return repeat();
+  }
+
+  /* connection is closed by the client */
+  return finish();
+
+}
+
+HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::flushHeldResponsesOr(Error* error) {
+  /* Connection is about to be dropped - deliver responses held for pipelined requests first */
+  if(m_hasHeldResponses) {
+    m_hasHeldResponses = false;
+    return data::stream::BufferOutputStream::flushToStreamAsync(m_headersOutBuffer, m_connection.object).next(finish());
+  }
+  return error;
+}
+
 HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::handleError(Error* error) {
 
   if(error) {
@@ -416,13 +658,13 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::handleError(Error* er
     if(error->is<oatpp::AsyncIOError>()) {
       auto aioe = static_cast<oatpp::AsyncIOError*>(error);
       if(aioe->getCode() == oatpp::IOError::BROKEN_PIPE) {
-        return aioe; // do not report BROKEN_PIPE error
+        return flushHeldResponsesOr(aioe); // do not report BROKEN_PIPE error
       }
     }
 
     if(m_currentResponse) {
       //OATPP_LOGE("[oatpp::web::server::HttpProcessor::Coroutine::handleError()]", "Unhandled error. '%s'. Dropping connection", error->what());
-      return error;
+      return flushHeldResponsesOr(error);
     }
 
     oatpp::web::protocol::http::HttpError httpError(protocol::http::Status::CODE_500, error->what());
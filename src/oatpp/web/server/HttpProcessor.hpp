@@ -40,6 +40,7 @@
 #include "oatpp/web/protocol/http/utils/CommunicationUtils.hpp"
 
 #include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp/core/data/buffer/BufferPool.hpp"
 #include "oatpp/core/async/Processor.hpp"
 
 namespace oatpp { namespace web { namespace server {
@@ -80,6 +81,22 @@ public:
      */
     v_buff_size headersReaderMaxSize = 4096;
 
+    /**
+     * Give per-connection buffers back to &l:HttpProcessor::Components::bufferPool; while idle keep-alive connection
+     * waits for the first byte of the next request. Applies to &l:HttpProcessor::Coroutine; only.
+     */
+    bool hibernateIdleConnections = true;
+
+    /**
+     * Write coalescing for pipelined requests. While the complete head of the following request is already buffered,
+     * small responses are held in the headers-out buffer and put out together with the following ones. Held responses
+     * are flushed once the buffer holds this many bytes, or as soon as the next request head has to be read from the
+     * connection. `0` - responses are not held. <br>
+     * *Note:* held responses still wait for the endpoint of the following request - including its body reads - so with
+     * slow endpoints set it to `0`.
+     */
+    v_buff_size pipelineFlushThreshold = 4096;
+
   };
 
 public:
@@ -154,6 +171,11 @@ public:
      */
     std::shared_ptr<Config> config;
 
+    /**
+     * Pool of per-connection buffers shared by all connections. &id:oatpp::data::buffer::BufferPool;.
+     */
+    std::shared_ptr<data::buffer::BufferPool> bufferPool;
+
   };
 
 private:
@@ -177,6 +199,10 @@ private:
   processNextRequest(ProcessingResources& resources,
                      const std::shared_ptr<protocol::http::incoming::Request>& request,
                      ConnectionState& connectionState);
+  static bool isRequestHeadBuffered(data::stream::InputStreamBufferedProxy* inStream);
+  static v_buff_size getPipelineHoldThreshold(const std::shared_ptr<Config>& config,
+                                              data::stream::InputStreamBufferedProxy* inStream,
+                                              ConnectionState connectionState);
   static ConnectionState processNextRequest(ProcessingResources& resources);
 
 public:
@@ -202,6 +228,10 @@ public:
     std::shared_ptr<Components> m_components;
     provider::ResourceHandle<oatpp::data::stream::IOStream> m_connection;
     TaskProcessingListener* m_taskListener;
+    std::shared_ptr<ProcessingResources> m_resources;
+    bool m_pollable;
+  private:
+    v_io_handle findIOHandle();
   public:
 
     /**
@@ -240,6 +270,17 @@ public:
      */
     void run();
 
+    /**
+     * Serve requests while the connection has data to read. <br>
+     * Returns when the connection is closed or when the client is idle, so that the caller can release the thread
+     * and wait for the next request on the connection I/O handle. <br>
+     * Connections whose I/O handle can't be determined are served until closed.
+     * @param ioHandle - out parameter. I/O handle to wait for readability on. Valid only if `ConnectionState::ALIVE` is returned.
+     * @return - &id:oatpp::web::protocol::http::utils::CommunicationUtils::ConnectionState;.
+     * `ConnectionState::ALIVE` means that the connection is idle and `iterate()` should be called again when `ioHandle` is readable.
+     */
+    ConnectionState iterate(v_io_handle& ioHandle);
+
   };
   
 public:
@@ -251,16 +292,23 @@ public:
   private:
     std::shared_ptr<Components> m_components;
     provider::ResourceHandle<oatpp::data::stream::IOStream> m_connection;
-    oatpp::data::stream::BufferOutputStream m_headersInBuffer;
+    std::shared_ptr<oatpp::data::stream::BufferOutputStream> m_headersInBuffer;
     RequestHeadersReader m_headersReader;
     std::shared_ptr<oatpp::data::stream::BufferOutputStream> m_headersOutBuffer;
+    std::shared_ptr<std::string> m_inStreamMemory;
     std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy> m_inStream;
     ConnectionState m_connectionState;
+    v_char8 m_firstByte;
+    bool m_hasHeldResponses;
   private:
     oatpp::web::server::HttpRouter::BranchRouter::Route m_currentRoute;
     std::shared_ptr<protocol::http::incoming::Request> m_currentRequest;
     std::shared_ptr<protocol::http::outgoing::Response> m_currentResponse;
     TaskProcessingListener* m_taskListener;
+  private:
+    void acquireBuffers(bool hasFirstByte);
+    void releaseBuffers();
+    Action flushHeldResponsesOr(Error* error);
   public:
 
     /**
@@ -284,6 +332,9 @@ public:
     Action onResponse(const std::shared_ptr<protocol::http::outgoing::Response>& response);
     Action onResponseFormed();
     Action onRequestDone();
+    Action readNextRequest();
+    Action hibernate();
+    Action waitForRequest();
     
     Action handleError(Error* error) override;
     
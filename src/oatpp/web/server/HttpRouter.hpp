@@ -30,13 +30,17 @@
 #include "oatpp/web/server/api/ApiController.hpp"
 #include "oatpp/web/server/api/Endpoint.hpp"
 #include "oatpp/web/url/mapping/Router.hpp"
+#include "oatpp/web/url/mapping/TreeRouter.hpp"
 
 namespace oatpp { namespace web { namespace server {
 
 /**
  * HttpRouter is responsible for routing http requests by method and path-pattern.
+ * @tparam RouterEndpoint - endpoint of the route.
+ * @tparam BranchRouterType - router used for each http method. Should have the same interface as &id:oatpp::web::url::mapping::Router;.
+ * Default is &id:oatpp::web::url::mapping::TreeRouter;.
  */
-template<typename RouterEndpoint>
+template<typename RouterEndpoint, typename BranchRouterType = web::url::mapping::TreeRouter<RouterEndpoint>>
 class HttpRouterTemplate : public oatpp::base::Countable {
 private:
   /**
@@ -46,9 +50,9 @@ private:
 public:
 
   /**
-   * &id:oatpp::web::url::mapping::Router;
+   * &id:oatpp::web::url::mapping::TreeRouter; by default.
    */
-  typedef web::url::mapping::Router<RouterEndpoint> BranchRouter;
+  typedef BranchRouterType BranchRouter;
 
   /**
    * Http method to &l:HttpRouter::BranchRouter; map.
@@ -0,0 +1,347 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HttpWorkerPool.hpp"
+
+#include "oatpp/core/concurrency/Thread.hpp"
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+  #define OATPP_HTTP_WORKER_POOL_EPOLL
+  #include <sys/epoll.h>
+  #include <sys/eventfd.h>
+  #include <unistd.h>
+  #include <cstring>
+  #include <cerrno>
+#endif
+
+namespace oatpp { namespace web { namespace server {
+
+HttpWorkerPool::HttpWorkerPool(const Config& config)
+  : m_config(config)
+  , m_running(true)
+  , m_rejectedCount(0)
+  , m_eventQueueHandle(INVALID_IO_HANDLE)
+  , m_wakeupHandle(INVALID_IO_HANDLE)
+{
+
+  if(m_config.workersCount <= 0) {
+    m_config.workersCount = oatpp::concurrency::getHardwareConcurrency();
+  }
+
+  if(m_config.queueCapacity <= 0) {
+    m_config.queueCapacity = 1;
+  }
+
+#ifdef OATPP_HTTP_WORKER_POOL_EPOLL
+
+  if(m_config.parkIdleConnections) {
+
+    m_eventQueueHandle = ::epoll_create1(0);
+    if(m_eventQueueHandle == -1) {
+      OATPP_LOGE("[oatpp::web::server::HttpWorkerPool::HttpWorkerPool()]", "Error. Call to ::epoll_create1() failed. errno=%d", errno);
+      throw std::runtime_error("[oatpp::web::server::HttpWorkerPool::HttpWorkerPool()]: Error. Call to ::epoll_create1() failed.");
+    }
+
+    m_wakeupHandle = ::eventfd(0, EFD_NONBLOCK);
+    if(m_wakeupHandle == -1) {
+      ::close(m_eventQueueHandle);
+      OATPP_LOGE("[oatpp::web::server::HttpWorkerPool::HttpWorkerPool()]", "Error. Call to ::eventfd() failed. errno=%d", errno);
+      throw std::runtime_error("[oatpp::web::server::HttpWorkerPool::HttpWorkerPool()]: Error. Call to ::eventfd() failed.");
+    }
+
+    struct epoll_event event;
+    std::memset(&event, 0, sizeof(struct epoll_event));
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+
+    if(::epoll_ctl(m_eventQueueHandle, EPOLL_CTL_ADD, m_wakeupHandle, &event) != 0) {
+      ::close(m_wakeupHandle);
+      ::close(m_eventQueueHandle);
+      OATPP_LOGE("[oatpp::web::server::HttpWorkerPool::HttpWorkerPool()]", "Error. Call to ::epoll_ctl() failed. errno=%d", errno);
+      throw std::runtime_error("[oatpp::web::server::HttpWorkerPool::HttpWorkerPool()]: Error. Call to ::epoll_ctl() failed.");
+    }
+
+    m_parkingThread = std::thread(&HttpWorkerPool::parkingLoop, this);
+
+  }
+
+#else
+  m_config.parkIdleConnections = false;
+#endif
+
+  /* Get hardware concurrency -1 in order to have 1cpu free of workers. */
+  v_int32 concurrency = oatpp::concurrency::getHardwareConcurrency();
+  if (concurrency > 1) {
+    concurrency -= 1;
+  }
+
+  m_workers.reserve(m_config.workersCount);
+  for(v_int32 i = 0; i < m_config.workersCount; i ++) {
+    m_workers.push_back(std::thread(&HttpWorkerPool::workerLoop, this));
+    /* Set thread affinity group CPUs [0..cpu_count - 1]. Leave one cpu free of workers */
+    oatpp::concurrency::setThreadAffinityToCpuRange(m_workers.back().native_handle(),
+                                                    0,
+                                                    concurrency - 1 /* -1 because 0-based index */);
+  }
+
+}
+
+HttpWorkerPool::~HttpWorkerPool() {
+  stop();
+}
+
+HttpWorkerPool::Task* HttpWorkerPool::popTask() {
+
+  std::unique_lock<std::mutex> lock(m_queueMutex);
+  m_queueNotEmpty.wait(lock, [this]{
+    return !m_queue.empty() || !m_running.load();
+  });
+
+  if(!m_running.load()) {
+    return nullptr;
+  }
+
+  Task* task = m_queue.front();
+  m_queue.pop_front();
+  if((v_buff_size) m_queue.size() < m_config.queueCapacity) {
+    lock.unlock();
+    m_queueNotFull.notify_one();
+  }
+
+  return task;
+
+}
+
+void HttpWorkerPool::workerLoop() {
+
+  while(true) {
+
+    Task* task = popTask();
+    if(task == nullptr) {
+      return;
+    }
+
+    if(!m_config.parkIdleConnections) {
+      task->run();
+      delete task;
+      continue;
+    }
+
+    v_io_handle ioHandle;
+    auto connectionState = task->iterate(ioHandle);
+
+    if(connectionState == HttpProcessor::ConnectionState::ALIVE && m_running.load()) {
+      park(task, ioHandle);
+    } else {
+      delete task;
+    }
+
+  }
+
+}
+
+bool HttpWorkerPool::submit(Task&& task) {
+
+  {
+
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+
+    if((v_buff_size) m_queue.size() >= m_config.queueCapacity) {
+
+      if(m_config.overflowPolicy == OverflowPolicy::REJECT) {
+        m_rejectedCount ++;
+        return false;
+      }
+
+      m_queueNotFull.wait(lock, [this]{
+        return (v_buff_size) m_queue.size() < m_config.queueCapacity || !m_running.load();
+      });
+
+    }
+
+    if(!m_running.load()) {
+      return false;
+    }
+
+    m_queue.push_back(new Task(std::move(task)));
+
+  }
+
+  m_queueNotEmpty.notify_one();
+  return true;
+
+}
+
+void HttpWorkerPool::resume(Task* task) {
+
+  /* Resumed connections are already admitted - they don't respect the queue capacity */
+  {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    m_queue.push_back(task);
+  }
+
+  m_queueNotEmpty.notify_one();
+
+}
+
+void HttpWorkerPool::park(Task* task, v_io_handle ioHandle) {
+
+#ifdef OATPP_HTTP_WORKER_POOL_EPOLL
+
+  {
+    std::lock_guard<std::mutex> lock(m_parkedMutex);
+    m_parked.insert(task);
+  }
+
+  struct epoll_event event;
+  std::memset(&event, 0, sizeof(struct epoll_event));
+  event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  event.data.ptr = task;
+
+  /* The handle stays registered (disabled by EPOLLONESHOT) after it was reported. Re-arm it, or add it if it's new */
+  auto res = ::epoll_ctl(m_eventQueueHandle, EPOLL_CTL_MOD, ioHandle, &event);
+  if(res != 0 && errno == ENOENT) {
+    res = ::epoll_ctl(m_eventQueueHandle, EPOLL_CTL_ADD, ioHandle, &event);
+  }
+
+  if(res != 0) {
+    OATPP_LOGW("[oatpp::web::server::HttpWorkerPool::park()]", "Warning. Can't park connection. errno=%d", errno);
+    {
+      std::lock_guard<std::mutex> lock(m_parkedMutex);
+      m_parked.erase(task);
+    }
+    resume(task);
+  }
+
+#else
+  (void) ioHandle;
+  resume(task);
+#endif
+
+}
+
+void HttpWorkerPool::parkingLoop() {
+
+#ifdef OATPP_HTTP_WORKER_POOL_EPOLL
+
+  constexpr v_int32 MAX_EVENTS = 256;
+  struct epoll_event events[MAX_EVENTS];
+
+  while(m_running.load()) {
+
+    auto eventsCount = ::epoll_wait(m_eventQueueHandle, events, MAX_EVENTS, -1);
+
+    if(eventsCount < 0) {
+      if(errno == EINTR) {
+        continue;
+      }
+      OATPP_LOGE("[oatpp::web::server::HttpWorkerPool::parkingLoop()]", "Error. Call to ::epoll_wait() failed. errno=%d", errno);
+      return;
+    }
+
+    for(v_int32 i = 0; i < eventsCount; i ++) {
+
+      Task* task = (Task*) events[i].data.ptr;
+
+      if(task == nullptr) {
+        eventfd_t value;
+        ::eventfd_read(m_wakeupHandle, &value);
+        continue;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m_parkedMutex);
+        m_parked.erase(task);
+      }
+
+      resume(task);
+
+    }
+
+  }
+
+#endif
+
+}
+
+void HttpWorkerPool::stop() {
+
+  {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if(!m_running.load()) {
+      return;
+    }
+    m_running.store(false);
+  }
+
+  m_queueNotEmpty.notify_all();
+  m_queueNotFull.notify_all();
+
+  for(auto& worker : m_workers) {
+    worker.join();
+  }
+  m_workers.clear();
+
+#ifdef OATPP_HTTP_WORKER_POOL_EPOLL
+  if(m_parkingThread.joinable()) {
+    ::eventfd_write(m_wakeupHandle, 1);
+    m_parkingThread.join();
+  }
+#endif
+
+  for(auto task : m_queue) {
+    delete task;
+  }
+  m_queue.clear();
+
+  for(auto task : m_parked) {
+    delete task;
+  }
+  m_parked.clear();
+
+#ifdef OATPP_HTTP_WORKER_POOL_EPOLL
+  if(m_wakeupHandle != INVALID_IO_HANDLE) {
+    ::close(m_wakeupHandle);
+    ::close(m_eventQueueHandle);
+    m_wakeupHandle = INVALID_IO_HANDLE;
+    m_eventQueueHandle = INVALID_IO_HANDLE;
+  }
+#endif
+
+}
+
+v_int32 HttpWorkerPool::getWorkersCount() const {
+  return m_config.workersCount;
+}
+
+v_buff_size HttpWorkerPool::getParkedCount() {
+  std::lock_guard<std::mutex> lock(m_parkedMutex);
+  return m_parked.size();
+}
+
+v_int64 HttpWorkerPool::getRejectedCount() const {
+  return m_rejectedCount.load();
+}
+
+}}}
@@ -0,0 +1,166 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_server_HttpWorkerPool_hpp
+#define oatpp_web_server_HttpWorkerPool_hpp
+
+#include "oatpp/web/server/HttpProcessor.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <unordered_set>
+#include <vector>
+
+namespace oatpp { namespace web { namespace server {
+
+/**
+ * Fixed-size pool of threads serving &id:oatpp::web::server::HttpProcessor::Task;s. <br>
+ * New connections are put to the bounded queue. When the queue is full the submitter is either blocked or the
+ * connection is rejected - see &l:HttpWorkerPool::OverflowPolicy;. <br>
+ * Idle keep-alive connections are parked in the epoll set (Linux only) and do not occupy worker threads until
+ * the next request arrives.
+ */
+class HttpWorkerPool {
+public:
+
+  /**
+   * What to do with a new connection when the queue is full.
+   */
+  enum class OverflowPolicy : v_int32 {
+
+    /**
+     * Block submitter until there is a free slot in the queue.
+     */
+    BLOCK = 0,
+
+    /**
+     * Reject connection.
+     */
+    REJECT = 1
+
+  };
+
+  /**
+   * Worker pool config.
+   */
+  struct Config {
+
+    /**
+     * Number of worker threads. `0` - hardware concurrency.
+     */
+    v_int32 workersCount = 0;
+
+    /**
+     * Max number of new connections waiting in the queue for a free worker.
+     */
+    v_buff_size queueCapacity = 1024;
+
+    /**
+     * &l:HttpWorkerPool::OverflowPolicy;.
+     */
+    OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK;
+
+    /**
+     * Park idle keep-alive connections instead of blocking a worker on them. Has effect on Linux only.
+     */
+    bool parkIdleConnections = true;
+
+  };
+
+private:
+  typedef HttpProcessor::Task Task;
+private:
+  void workerLoop();
+  void parkingLoop();
+  void park(Task* task, v_io_handle ioHandle);
+  void resume(Task* task);
+  Task* popTask();
+private:
+  Config m_config;
+  std::atomic<bool> m_running;
+  std::mutex m_queueMutex;
+  std::condition_variable m_queueNotEmpty;
+  std::condition_variable m_queueNotFull;
+  std::deque<Task*> m_queue;
+  std::vector<std::thread> m_workers;
+  std::atomic<v_int64> m_rejectedCount;
+private:
+  std::mutex m_parkedMutex;
+  std::unordered_set<Task*> m_parked;
+  v_io_handle m_eventQueueHandle;
+  v_io_handle m_wakeupHandle;
+  std::thread m_parkingThread;
+public:
+
+  /**
+   * Constructor. Starts worker threads.
+   * @param config - &l:HttpWorkerPool::Config;.
+   */
+  HttpWorkerPool(const Config& config);
+
+  HttpWorkerPool(const HttpWorkerPool&) = delete;
+  HttpWorkerPool& operator=(const HttpWorkerPool&) = delete;
+
+  /**
+   * Destructor. Stops and joins all threads. Tasks which were not served are destroyed.
+   */
+  ~HttpWorkerPool();
+
+  /**
+   * Submit task for execution.
+   * @param task - &id:oatpp::web::server::HttpProcessor::Task;.
+   * @return - `true` if task is accepted, `false` if task is rejected due to the queue overflow or the pool is stopped.
+   */
+  bool submit(Task&& task);
+
+  /**
+   * Stop worker threads and wait for them to exit. Tasks which were not served are destroyed.
+   */
+  void stop();
+
+  /**
+   * Get number of worker threads.
+   * @return
+   */
+  v_int32 getWorkersCount() const;
+
+  /**
+   * Get number of connections currently parked.
+   * @return
+   */
+  v_buff_size getParkedCount();
+
+  /**
+   * Get number of tasks rejected due to queue overflow.
+   * @return
+   */
+  v_int64 getRejectedCount() const;
+
+};
+
+}}}
+
+#endif // oatpp_web_server_HttpWorkerPool_hpp
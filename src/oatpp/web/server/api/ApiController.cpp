@@ -83,6 +83,10 @@ const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& ApiController::getDef
   return m_defaultObjectMapper;
 }
 
+const std::shared_ptr<mime::ContentMappers>& ApiController::getContentMappers() const {
+  return m_contentMappers;
+}
+
 // Helper methods
 
 std::shared_ptr<ApiController::OutgoingResponse> ApiController::createResponse(const Status& status,
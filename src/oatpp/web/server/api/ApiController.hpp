@@ -29,6 +29,7 @@
 
 #include "oatpp/web/server/handler/AuthorizationHandler.hpp"
 #include "oatpp/web/server/handler/ErrorHandler.hpp"
+#include "oatpp/web/mime/ContentMappers.hpp"
 #include "oatpp/web/server/handler/AuthorizationHandler.hpp"
 #include "oatpp/web/protocol/http/incoming/Response.hpp"
 #include "oatpp/web/protocol/http/outgoing/Request.hpp"
@@ -353,12 +354,14 @@ protected:
   std::shared_ptr<handler::ErrorHandler> m_errorHandler;
   std::shared_ptr<handler::AuthorizationHandler> m_defaultAuthorizationHandler;
   std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_defaultObjectMapper;
+  std::shared_ptr<mime::ContentMappers> m_contentMappers;
   std::unordered_map<std::string, std::shared_ptr<Endpoint::Info>> m_endpointInfo;
   std::unordered_map<std::string, std::shared_ptr<RequestHandler>> m_endpointHandlers;
   const oatpp::String m_routerPrefix;
 public:
   ApiController(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& defaultObjectMapper, const oatpp::String &routerPrefix = nullptr)
     : m_defaultObjectMapper(defaultObjectMapper)
+    , m_contentMappers(mime::ContentMappers::createShared(defaultObjectMapper))
     , m_routerPrefix(routerPrefix)
   {}
 public:
@@ -411,6 +414,13 @@ public:
   std::shared_ptr<handler::AuthorizationObject> handleDefaultAuthorization(const String &authHeader) const;
   
   const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& getDefaultObjectMapper() const;
+
+  /**
+   * Get ObjectMappers used to deserialize `BODY_DTO` by the request `Content-Type`. <br>
+   * Contains the default ObjectMapper. Add more mappers here to accept other content types.
+   * @return - &id:oatpp::web::mime::ContentMappers;.
+   */
+  const std::shared_ptr<mime::ContentMappers>& getContentMappers() const;
   
   // Helper methods
   
@@ -33,14 +33,18 @@
 #include <unordered_map>
 
 namespace oatpp { namespace web { namespace url { namespace mapping {
+
+class PatternTree; // FWD
   
 class Pattern : public base::Countable{
+  friend PatternTree;
 private:
   typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
 public:
   
   class MatchMap {
     friend Pattern;
+    friend PatternTree;
   public:
     typedef std::unordered_map<StringKeyLabel, StringKeyLabel> Variables;
   private:
@@ -0,0 +1,222 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PatternTree.hpp"
+
+#include <algorithm>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+v_int32 PatternTree::add(const std::shared_ptr<Pattern>& pattern) {
+
+  v_int32 index = (v_int32) m_variableNames.size();
+  m_variableNames.emplace_back();
+  auto& variableNames = m_variableNames.back();
+
+  Node* node = &m_root;
+  if(node->minIndex == NO_INDEX) {
+    node->minIndex = index;
+  }
+
+  if(pattern) {
+
+    for (const std::shared_ptr<Pattern::Part>& part : *pattern->m_parts) {
+
+      if (part->function == Pattern::Part::FUNCTION_CONST) {
+        auto& child = node->constChildren[StringKeyLabel(part->text)];
+        if (!child) {
+          child.reset(new Node());
+        }
+        node = child.get();
+      } else if (part->function == Pattern::Part::FUNCTION_VAR) {
+        variableNames.push_back(StringKeyLabel(part->text));
+        if (!node->varChild) {
+          node->varChild.reset(new Node());
+        }
+        node = node->varChild.get();
+      } else if (part->function == Pattern::Part::FUNCTION_ANY_END) {
+        if (node->anyEndIndex == NO_INDEX) {
+          node->anyEndIndex = index;
+        }
+        return index;
+      }
+
+      if (node->minIndex == NO_INDEX) {
+        node->minIndex = index;
+      }
+
+    }
+
+  }
+
+  if(node->terminalIndex == NO_INDEX) {
+    node->terminalIndex = index;
+  }
+
+  return index;
+
+}
+
+const PatternTree::Node* PatternTree::findConstChild(const Node* node, const char* data, v_buff_size size) {
+  if(node->constChildren.empty()) {
+    return nullptr;
+  }
+  auto it = node->constChildren.find(StringKeyLabel(nullptr, data, size));
+  if(it != node->constChildren.end()) {
+    return it->second.get();
+  }
+  return nullptr;
+}
+
+void PatternTree::accept(MatchState& state, v_int32 index, const Label& tail) {
+  if(index < state.bestIndex) {
+    state.bestIndex = index;
+    state.bestCaptures = state.captures;
+    state.bestTail = tail;
+  }
+}
+
+void PatternTree::matchNode(const Node* node, v_buff_size position, bool checkEnds, MatchState& state) {
+
+  const char* data = state.data;
+  const v_buff_size size = state.size;
+
+  v_buff_size pos = position;
+  while(pos < size && data[pos] == '/') {
+    pos ++;
+  }
+
+  if(checkEnds) {
+    if(pos == size && node->terminalIndex < state.bestIndex) {
+      accept(state, node->terminalIndex, {-1, 0});
+    }
+    if(node->anyEndIndex < state.bestIndex) {
+      if(pos < size) {
+        accept(state, node->anyEndIndex, {pos, size - pos});
+      } else {
+        accept(state, node->anyEndIndex, {-1, 0});
+      }
+    }
+  }
+
+  if(pos == size) {
+    return;
+  }
+
+  v_buff_size segmentEnd = pos;
+  v_buff_size queryPos = -1;
+  while(segmentEnd < size && data[segmentEnd] != '/') {
+    if(queryPos < 0 && data[segmentEnd] == '?') {
+      queryPos = segmentEnd;
+    }
+    segmentEnd ++;
+  }
+
+  /* constant part followed by query - matches only if pattern ends here or continues with '*' */
+  if(queryPos >= 0) {
+    for(v_buff_size i = queryPos; i < segmentEnd; i ++) {
+      if(data[i] == '?') {
+        auto child = findConstChild(node, &data[pos], i - pos);
+        if(child != nullptr) {
+          v_int32 index = std::min(child->terminalIndex, child->anyEndIndex);
+          if(index < state.bestIndex) {
+            accept(state, index, {i, size - i});
+          }
+        }
+      }
+    }
+  }
+
+  const Node* varChild = node->varChild.get();
+
+  /* variable followed by query - matches only if pattern ends here or continues with '*' */
+  if(varChild != nullptr && queryPos >= 0) {
+    v_int32 index = std::min(varChild->terminalIndex, varChild->anyEndIndex);
+    if(index < state.bestIndex) {
+      state.captures.push_back({pos, queryPos - pos});
+      accept(state, index, {queryPos, size - queryPos});
+      state.captures.pop_back();
+    }
+  }
+
+  const Node* constChild = findConstChild(node, &data[pos], segmentEnd - pos);
+
+  /* visit the branch containing the earliest added pattern first - the other one may be pruned then */
+  bool varFirst = varChild != nullptr && (constChild == nullptr || varChild->minIndex < constChild->minIndex);
+
+  for(v_int32 step = 0; step < 2; step ++) {
+
+    if((step == 0) == varFirst) {
+      if(varChild != nullptr && varChild->minIndex < state.bestIndex) {
+        state.captures.push_back({pos, segmentEnd - pos});
+        matchNode(varChild, segmentEnd, queryPos < 0, state);
+        state.captures.pop_back();
+      }
+    } else {
+      if(constChild != nullptr && constChild->minIndex < state.bestIndex) {
+        matchNode(constChild, segmentEnd, true, state);
+      }
+    }
+
+  }
+
+}
+
+v_int32 PatternTree::match(const StringKeyLabel& url, Pattern::MatchMap& matchMap) const {
+
+  MatchState state;
+  state.data = (const char*) url.getData();
+  state.size = url.getSize();
+  state.bestIndex = NO_INDEX;
+  state.bestTail = {-1, 0};
+
+  if(m_root.minIndex == NO_INDEX) {
+    return NO_INDEX;
+  }
+
+  matchNode(&m_root, 0, true, state);
+
+  if(state.bestIndex != NO_INDEX) {
+
+    const auto& names = m_variableNames[state.bestIndex];
+    for(size_t i = 0; i < names.size() && i < state.bestCaptures.size(); i ++) {
+      const auto& capture = state.bestCaptures[i];
+      matchMap.m_variables[names[i]] = StringKeyLabel(url.getMemoryHandle(), &state.data[capture.position], capture.size);
+    }
+
+    if(state.bestTail.position >= 0) {
+      matchMap.m_tail = StringKeyLabel(url.getMemoryHandle(), &state.data[state.bestTail.position], state.bestTail.size);
+    }
+
+  }
+
+  return state.bestIndex;
+
+}
+
+v_int32 PatternTree::getPatternsCount() const {
+  return (v_int32) m_variableNames.size();
+}
+
+}}}}
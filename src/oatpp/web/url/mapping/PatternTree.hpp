@@ -0,0 +1,113 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_url_mapping_PatternTree_hpp
+#define oatpp_web_url_mapping_PatternTree_hpp
+
+#include "./Pattern.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+/**
+ * Prefix tree of &id:oatpp::web::url::mapping::Pattern;s. <br>
+ * Each pattern part is a tree edge: constant parts are looked up by the url segment,
+ * `{var}` parts share one variable branch per node, and `*` is stored as a node attribute.
+ * Url is matched in one pass without trying every pattern. <br>
+ * Result is the same as matching patterns one by one in the order they were added -
+ * the first added matching pattern wins.
+ */
+class PatternTree : public base::Countable {
+private:
+  typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+public:
+
+  /**
+   * Index returned when no pattern matched.
+   */
+  static constexpr const v_int32 NO_INDEX = 0x7FFFFFFF;
+
+private:
+
+  struct Node {
+    std::unordered_map<StringKeyLabel, std::unique_ptr<Node>> constChildren;
+    std::unique_ptr<Node> varChild;
+    v_int32 terminalIndex = NO_INDEX;
+    v_int32 anyEndIndex = NO_INDEX;
+    v_int32 minIndex = NO_INDEX;
+  };
+
+  struct Label {
+    v_buff_size position;
+    v_buff_size size;
+  };
+
+  struct MatchState {
+    const char* data;
+    v_buff_size size;
+    std::vector<Label> captures;
+    v_int32 bestIndex;
+    std::vector<Label> bestCaptures;
+    Label bestTail;
+  };
+
+private:
+  static const Node* findConstChild(const Node* node, const char* data, v_buff_size size);
+  static void accept(MatchState& state, v_int32 index, const Label& tail);
+  static void matchNode(const Node* node, v_buff_size position, bool checkEnds, MatchState& state);
+private:
+  Node m_root;
+  std::vector<std::vector<StringKeyLabel>> m_variableNames;
+public:
+
+  /**
+   * Add pattern to the tree.
+   * @param pattern - &id:oatpp::web::url::mapping::Pattern;.
+   * @return - index of the added pattern. Patterns are indexed in the order they were added starting from `0`.
+   */
+  v_int32 add(const std::shared_ptr<Pattern>& pattern);
+
+  /**
+   * Match url against all patterns in the tree.
+   * @param url - url to match.
+   * @param matchMap - &id:oatpp::web::url::mapping::Pattern::MatchMap; to put resolved path variables to.
+   * Variables and tail are labels pointing to the url memory.
+   * @return - index of the matched pattern or &l:PatternTree::NO_INDEX; if no pattern matched.
+   */
+  v_int32 match(const StringKeyLabel& url, Pattern::MatchMap& matchMap) const;
+
+  /**
+   * Get number of patterns in the tree.
+   * @return
+   */
+  v_int32 getPatternsCount() const;
+
+};
+
+}}}}
+
+#endif /* oatpp_web_url_mapping_PatternTree_hpp */
@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_url_mapping_TreeRouter_hpp
+#define oatpp_web_url_mapping_TreeRouter_hpp
+
+#include "./Router.hpp"
+#include "./PatternTree.hpp"
+
+#include "oatpp/core/Types.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+/**
+ * Class responsible to map "Path" to "Route" by "Path-Pattern". <br>
+ * Same as &id:oatpp::web::url::mapping::Router; but patterns are compiled into &id:oatpp::web::url::mapping::PatternTree;,
+ * so the path is resolved in one pass instead of trying every pattern.
+ * @tparam Endpoint - endpoint of the route.
+ */
+template<typename Endpoint>
+class TreeRouter : public base::Countable {
+private:
+
+  /**
+   * Convenience typedef &id:oatpp::data::share::StringKeyLabel;.
+   */
+  typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+public:
+
+  /**
+   * Resolved "Route" for "path-pattern". &id:oatpp::web::url::mapping::Router::Route;.
+   */
+  typedef typename Router<Endpoint>::Route Route;
+
+private:
+  PatternTree m_tree;
+  std::vector<std::shared_ptr<Pattern>> m_patterns;
+  std::vector<Endpoint> m_endpoints;
+public:
+
+  static std::shared_ptr<TreeRouter> createShared(){
+    return std::make_shared<TreeRouter>();
+  }
+
+  /**
+   * Add `path-pattern` to `endpoint` mapping.
+   * @param pathPattern - path pattern for endpoint.
+   * @param endpoint - route endpoint.
+   */
+  void route(const oatpp::String& pathPattern, const Endpoint& endpoint) {
+    auto pattern = Pattern::parse(pathPattern);
+    m_tree.add(pattern);
+    m_patterns.push_back(pattern);
+    m_endpoints.push_back(endpoint);
+  }
+
+  /**
+   * Resolve path to corresponding endpoint.
+   * @param path
+   * @return - &id:Router::Route;.
+   */
+  Route getRoute(const StringKeyLabel& path){
+    Pattern::MatchMap matchMap;
+    v_int32 index = m_tree.match(path, matchMap);
+    if(index != PatternTree::NO_INDEX) {
+      return Route(m_endpoints[index], std::move(matchMap));
+    }
+    return Route();
+  }
+
+  void logRouterMappings(const oatpp::data::share::StringKeyLabel &branch) {
+
+    for(auto& pattern : m_patterns) {
+      auto mapping = pattern->toString();
+      OATPP_LOGD("Router", "url '%s %s' -> mapped", (const char*)branch.getData(), mapping->c_str());
+    }
+
+  }
+
+};
+
+}}}}
+
+#endif /* oatpp_web_url_mapping_TreeRouter_hpp */
@@ -6,31 +6,52 @@
 #include "oatpp/web/PipelineTest.hpp"
 #include "oatpp/web/PipelineAsyncTest.hpp"
 #include "oatpp/web/protocol/http/encoding/ChunkedTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/FileBodyTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/ResponseTest.hpp"
+#include "oatpp/web/protocol/http/utils/HeadersScannerTest.hpp"
 #include "oatpp/web/server/api/ApiControllerTest.hpp"
 #include "oatpp/web/server/handler/AuthorizationHandlerTest.hpp"
 #include "oatpp/web/server/HttpRouterTest.hpp"
+#include "oatpp/web/url/mapping/PatternTreeTest.hpp"
 #include "oatpp/web/server/ServerStopTest.hpp"
+#include "oatpp/web/server/HttpProcessorTest.hpp"
 #include "oatpp/web/mime/multipart/StatefulParserTest.hpp"
+#include "oatpp/web/mime/ContentMappersTest.hpp"
 
 #include "oatpp/network/virtual_/PipeTest.hpp"
 #include "oatpp/network/virtual_/InterfaceTest.hpp"
 #include "oatpp/network/UrlTest.hpp"
+#include "oatpp/network/MultiAcceptorServerTest.hpp"
 #include "oatpp/network/ConnectionPoolTest.hpp"
 #include "oatpp/network/monitor/ConnectionMonitorTest.hpp"
 
+#include "oatpp/parser/json/UtilsTest.hpp"
 #include "oatpp/parser/json/mapping/DeserializerTest.hpp"
+#include "oatpp/parser/json/mapping/StreamingDeserializerTest.hpp"
+#include "oatpp/parser/json/mapping/StreamingSerializerTest.hpp"
+#include "oatpp/parser/json/mapping/TypedArrayTest.hpp"
 #include "oatpp/parser/json/mapping/DTOMapperPerfTest.hpp"
+#include "oatpp/parser/json/mapping/NumbersPerfTest.hpp"
 #include "oatpp/parser/json/mapping/DTOMapperTest.hpp"
 #include "oatpp/parser/json/mapping/EnumTest.hpp"
 #include "oatpp/parser/json/mapping/UnorderedSetTest.hpp"
+#include "oatpp/parser/cbor/mapping/ObjectMapperTest.hpp"
 
 #include "oatpp/encoding/UnicodeTest.hpp"
 #include "oatpp/encoding/Base64Test.hpp"
 
 #include "oatpp/core/parser/CaretTest.hpp"
+#include "oatpp/core/utils/ConversionUtilsTest.hpp"
 #include "oatpp/core/provider/PoolTest.hpp"
 #include "oatpp/core/provider/PoolTemplateTest.hpp"
 #include "oatpp/core/async/LockTest.hpp"
+#include "oatpp/core/async/MPSCQueueTest.hpp"
+#include "oatpp/core/async/FramePoolTest.hpp"
+#include "oatpp/core/async/ShardedExecutorTest.hpp"
+#include "oatpp/core/async/WorkStealingTest.hpp"
+#include "oatpp/core/async/IOWorkerPerfTest.hpp"
+#include "oatpp/core/async/IOUringWorkerTest.hpp"
+#include "oatpp/core/async/TimerWorkerTest.hpp"
 
 #include "oatpp/core/data/mapping/type/UnorderedMapTest.hpp"
 #include "oatpp/core/data/mapping/type/PairListTest.hpp"
@@ -40,11 +61,13 @@
 #include "oatpp/core/data/mapping/type/ObjectTest.hpp"
 #include "oatpp/core/data/mapping/type/StringTest.hpp"
 #include "oatpp/core/data/mapping/type/PrimitiveTest.hpp"
+#include "oatpp/core/data/mapping/type/InlineTest.hpp"
 #include "oatpp/core/data/mapping/type/ObjectWrapperTest.hpp"
 #include "oatpp/core/data/mapping/type/TypeTest.hpp"
 #include "oatpp/core/data/mapping/type/AnyTest.hpp"
 #include "oatpp/core/data/mapping/type/EnumTest.hpp"
 #include "oatpp/core/data/mapping/type/InterpretationTest.hpp"
+#include "oatpp/core/data/mapping/ArenaTest.hpp"
 #include "oatpp/core/data/mapping/TypeResolverTest.hpp"
 
 #include "oatpp/core/data/resource/InMemoryDataTest.hpp"
@@ -53,6 +76,7 @@
 #include "oatpp/core/data/share/LazyStringMapTest.hpp"
 #include "oatpp/core/data/share/StringTemplateTest.hpp"
 #include "oatpp/core/data/share/MemoryLabelTest.hpp"
+#include "oatpp/core/data/buffer/BufferPoolTest.hpp"
 #include "oatpp/core/data/buffer/ProcessorTest.hpp"
 
 #include "oatpp/core/base/CommandLineArgumentsTest.hpp"
@@ -91,6 +115,7 @@ void runTests() {
   OATPP_RUN_TEST(oatpp::test::core::data::share::StringTemplateTest);
 
   OATPP_RUN_TEST(oatpp::test::core::data::buffer::ProcessorTest);
+  OATPP_RUN_TEST(oatpp::test::core::data::buffer::BufferPoolTest);
 
   OATPP_RUN_TEST(oatpp::test::core::data::stream::BufferStreamTest);
 
@@ -100,6 +125,7 @@ void runTests() {
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::StringTest);
 
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::PrimitiveTest);
+  OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::InlineTest);
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::ListTest);
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::VectorTest);
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::UnorderedSetTest);
@@ -112,11 +138,20 @@ void runTests() {
 
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::InterpretationTest);
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::TypeResolverTest);
+  OATPP_RUN_TEST(oatpp::test::core::data::mapping::ArenaTest);
 
   OATPP_RUN_TEST(oatpp::test::core::data::resource::InMemoryDataTest);
 
   OATPP_RUN_TEST(oatpp::test::async::LockTest);
+  OATPP_RUN_TEST(oatpp::test::async::MPSCQueueTest);
+  OATPP_RUN_TEST(oatpp::test::async::FramePoolTest);
+  OATPP_RUN_TEST(oatpp::test::async::ShardedExecutorTest);
+  OATPP_RUN_TEST(oatpp::test::async::WorkStealingTest);
+  OATPP_RUN_TEST(oatpp::test::async::IOWorkerPerfTest);
+  OATPP_RUN_TEST(oatpp::test::async::IOUringWorkerTest);
+  OATPP_RUN_TEST(oatpp::test::async::TimerWorkerTest);
   OATPP_RUN_TEST(oatpp::test::parser::CaretTest);
+  OATPP_RUN_TEST(oatpp::test::core::utils::ConversionUtilsTest);
 
   OATPP_RUN_TEST(oatpp::test::core::provider::PoolTest);
   OATPP_RUN_TEST(oatpp::test::core::provider::PoolTemplateTest);
@@ -125,10 +160,17 @@ void runTests() {
 
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::UnorderedSetTest);
 
+  OATPP_RUN_TEST(oatpp::test::parser::json::UtilsTest);
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DeserializerTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::StreamingDeserializerTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::StreamingSerializerTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::TypedArrayTest);
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DTOMapperPerfTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::NumbersPerfTest);
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DTOMapperTest);
 
+  OATPP_RUN_TEST(oatpp::test::parser::cbor::mapping::ObjectMapperTest);
+
   OATPP_RUN_TEST(oatpp::test::encoding::Base64Test);
   OATPP_RUN_TEST(oatpp::test::encoding::UnicodeTest);
 
@@ -139,12 +181,18 @@ void runTests() {
   OATPP_RUN_TEST(oatpp::test::network::virtual_::InterfaceTest);
 
   OATPP_RUN_TEST(oatpp::test::web::protocol::http::encoding::ChunkedTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::FileBodyTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::ResponseTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::utils::HeadersScannerTest);
 
   OATPP_RUN_TEST(oatpp::test::web::mime::multipart::StatefulParserTest);
+  OATPP_RUN_TEST(oatpp::test::web::mime::ContentMappersTest);
 
+  OATPP_RUN_TEST(oatpp::test::web::url::mapping::PatternTreeTest);
   OATPP_RUN_TEST(oatpp::test::web::server::HttpRouterTest);
   OATPP_RUN_TEST(oatpp::test::web::server::api::ApiControllerTest);
   OATPP_RUN_TEST(oatpp::test::web::server::handler::AuthorizationHandlerTest);
+  OATPP_RUN_TEST(oatpp::test::web::server::HttpProcessorTest);
 
   {
 
@@ -156,6 +204,13 @@ void runTests() {
 
   }
 
+  {
+
+    oatpp::test::network::MultiAcceptorServerTest test_port(8000);
+    test_port.run();
+
+  }
+
   {
 
     oatpp::test::web::PipelineTest test_virtual(0, 3000);
@@ -164,6 +219,12 @@ void runTests() {
     oatpp::test::web::PipelineTest test_port(8000, 3000);
     test_port.run();
 
+    oatpp::test::web::PipelineTest test_virtual_pool(0, 3000, true);
+    test_virtual_pool.run();
+
+    oatpp::test::web::PipelineTest test_port_pool(8000, 3000, true);
+    test_port_pool.run();
+
   }
 
   {
@@ -184,6 +245,12 @@ void runTests() {
     oatpp::test::web::FullTest test_port(8000, 5);
     test_port.run();
 
+    oatpp::test::web::FullTest test_virtual_pool(0, 100, true);
+    test_virtual_pool.run();
+
+    oatpp::test::web::FullTest test_port_pool(8000, 5, true);
+    test_port_pool.run();
+
   }
 
   {
@@ -0,0 +1,202 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "FramePoolTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+#include "oatpp/core/async/utils/FramePool.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+typedef oatpp::async::utils::FramePool FramePool;
+
+class SubCoroutine : public oatpp::async::Coroutine<SubCoroutine> {
+private:
+  v_int32 m_step;
+public:
+
+  SubCoroutine(v_int32 step)
+    : m_step(step)
+  {}
+
+  Action act() override {
+    if(m_step % 3 == 0) {
+      return error<oatpp::async::Error>("expected error");
+    }
+    return finish();
+  }
+
+};
+
+class TestCoroutine : public oatpp::async::Coroutine<TestCoroutine> {
+private:
+  std::atomic<v_int32>* m_counter;
+  v_int32 m_step;
+public:
+
+  TestCoroutine(std::atomic<v_int32>* counter)
+    : m_counter(counter)
+    , m_step(0)
+  {}
+
+  Action act() override {
+    m_step ++;
+    if(m_step < 10) {
+      return SubCoroutine::start(m_step).next(yieldTo(&TestCoroutine::act));
+    }
+    (*m_counter) ++;
+    return finish();
+  }
+
+  Action handleError(Error* error) override {
+    (void) error;
+    return yieldTo(&TestCoroutine::act);
+  }
+
+};
+
+void runCoroutines(v_int32 count) {
+
+  std::atomic<v_int32> counter(0);
+
+  oatpp::async::Executor executor(1, 1, 1);
+  for(v_int32 i = 0; i < count; i ++) {
+    executor.execute<TestCoroutine>(&counter);
+  }
+
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  OATPP_ASSERT(counter.load() == count);
+
+}
+
+}
+
+void FramePoolTest::onRun() {
+
+  {
+    OATPP_LOGI(TAG, "Test blocks reuse...");
+
+    std::vector<void*> blocks;
+
+    for(v_int32 i = 0; i < 100; i ++) {
+      blocks.push_back(FramePool::allocate(40));
+    }
+    for(void* block : blocks) {
+      FramePool::deallocate(block, 40);
+    }
+    blocks.clear();
+
+    auto stats = FramePool::getStats();
+
+    for(v_int32 i = 0; i < 100; i ++) {
+      blocks.push_back(FramePool::allocate(33)); // same size class as 40
+    }
+    for(void* block : blocks) {
+      FramePool::deallocate(block, 33);
+    }
+
+    auto newStats = FramePool::getStats();
+
+    OATPP_ASSERT(newStats.allocations - stats.allocations == 100);
+    OATPP_ASSERT(newStats.deallocations - stats.deallocations == 100);
+    OATPP_ASSERT(newStats.systemAllocations == stats.systemAllocations);
+
+    void* big = FramePool::allocate(FramePool::MAX_BLOCK_SIZE + 1);
+    FramePool::deallocate(big, FramePool::MAX_BLOCK_SIZE + 1);
+
+    auto bigStats = FramePool::getStats();
+    OATPP_ASSERT(bigStats.systemAllocations - newStats.systemAllocations == 1);
+    OATPP_ASSERT(bigStats.systemDeallocations - newStats.systemDeallocations == 1);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test free blocks are returned to the system...");
+
+    const v_int32 blocksCount = FramePool::MAX_DEPOT_BLOCKS + 1000;
+    const v_buff_size blockSize = FramePool::MAX_BLOCK_SIZE - 8; // size class not used by other tests
+
+    auto stats = FramePool::getStats();
+
+    std::thread thread([blocksCount, blockSize] {
+      std::vector<void*> blocks;
+      for(v_int32 i = 0; i < blocksCount; i ++) {
+        blocks.push_back(FramePool::allocate(blockSize));
+      }
+      for(void* block : blocks) {
+        FramePool::deallocate(block, blockSize);
+      }
+    });
+    thread.join();
+
+    auto newStats = FramePool::getStats();
+    v_uint64 systemDeallocations = newStats.systemDeallocations - stats.systemDeallocations;
+
+    OATPP_LOGD(TAG, "systemDeallocations=%llu", (unsigned long long) systemDeallocations);
+    OATPP_ASSERT(systemDeallocations >= (v_uint64) (blocksCount - FramePool::MAX_DEPOT_BLOCKS));
+
+    /* pool is still functional */
+    void* block = FramePool::allocate(blockSize);
+    FramePool::deallocate(block, blockSize);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test coroutines...");
+
+    const v_int32 coroutinesCount = 1000;
+
+    runCoroutines(coroutinesCount); // warm-up
+
+    auto stats = FramePool::getStats();
+    runCoroutines(coroutinesCount);
+    auto newStats = FramePool::getStats();
+
+    v_uint64 allocations = newStats.allocations - stats.allocations;
+    v_uint64 deallocations = newStats.deallocations - stats.deallocations;
+    v_uint64 systemAllocations = newStats.systemAllocations - stats.systemAllocations;
+
+    OATPP_LOGD(TAG, "allocations=%llu, deallocations=%llu, systemAllocations=%llu",
+               (unsigned long long) allocations, (unsigned long long) deallocations, (unsigned long long) systemAllocations);
+
+    OATPP_ASSERT(allocations == deallocations);
+    OATPP_ASSERT(allocations > (v_uint64) coroutinesCount * 10);
+    OATPP_ASSERT(systemAllocations < allocations / 10);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+}
+
+}}}
@@ -0,0 +1,211 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOUringWorkerTest.hpp"
+
+#include "oatpp/core/async/worker/IOUringWorker.hpp"
+#include "oatpp/core/async/Processor.hpp"
+
+#include <thread>
+
+#ifdef OATPP_IO_URING_INTERFACE_SUPPORTED
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace test { namespace async {
+
+#ifdef OATPP_IO_URING_INTERFACE_SUPPORTED
+
+namespace {
+
+std::atomic<v_int32> coroutinesFinished(0);
+std::atomic<v_int32> coroutinesDestroyed(0);
+
+/*
+ * Read one byte from the pipe.
+ */
+class ReadByteCoroutine : public oatpp::async::Coroutine<ReadByteCoroutine> {
+private:
+  v_io_handle m_fd;
+public:
+
+  ReadByteCoroutine(v_io_handle fd)
+    : m_fd(fd)
+  {}
+
+  ~ReadByteCoroutine() {
+    ++ coroutinesDestroyed;
+  }
+
+  Action act() override {
+    v_char8 c;
+    auto res = ::read(m_fd, &c, 1);
+    if(res == 1) {
+      ++ coroutinesFinished;
+      return finish();
+    }
+    if(res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return ioWait(m_fd, Action::IOEventType::IO_EVENT_READ);
+    }
+    return error<oatpp::async::Error>("[ReadByteCoroutine::act()]: Error. Read failed.");
+  }
+
+};
+
+class TestProcessor {
+private:
+  std::atomic<bool> m_running;
+  std::thread m_thread;
+public:
+  oatpp::async::Processor processor;
+  std::shared_ptr<oatpp::async::worker::IOUringWorker> worker;
+public:
+
+  TestProcessor(v_uint32 ringEntries)
+    : m_running(true)
+    , worker(std::make_shared<oatpp::async::worker::IOUringWorker>(ringEntries))
+  {
+    processor.addWorker(worker);
+    m_thread = std::thread([this]{
+      while(m_running) {
+        processor.waitForTasks();
+        while(processor.iterate(100)) {}
+      }
+    });
+  }
+
+  ~TestProcessor() {
+    m_running = false;
+    processor.stop();
+    m_thread.join();
+    worker->stop();
+    worker->join();
+  }
+
+};
+
+bool waitFor(const std::atomic<v_int32>& counter, v_int32 value) {
+  for(v_int32 i = 0; i < 1000 && counter < value; i ++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return counter == value;
+}
+
+void testMorePollsThanRingEntries() {
+
+  const v_int32 coroutinesCount = 200;
+
+  coroutinesFinished = 0;
+  coroutinesDestroyed = 0;
+
+  int fds[2];
+  OATPP_ASSERT(::pipe(fds) == 0);
+  ::fcntl(fds[0], F_SETFL, O_NONBLOCK);
+
+  {
+
+    /* 4 submission entries, 8 completion entries - most coroutines have to wait for free space in the rings */
+    TestProcessor test(4);
+
+    for(v_int32 i = 0; i < coroutinesCount; i ++) {
+      test.processor.execute<ReadByteCoroutine>(fds[0]);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    OATPP_ASSERT(coroutinesFinished == 0);
+
+    v_char8 data[coroutinesCount];
+    OATPP_ASSERT(::write(fds[1], data, coroutinesCount) == coroutinesCount);
+
+    OATPP_ASSERT(waitFor(coroutinesFinished, coroutinesCount));
+    OATPP_ASSERT(waitFor(coroutinesDestroyed, coroutinesCount));
+
+  }
+
+  ::close(fds[0]);
+  ::close(fds[1]);
+
+}
+
+void testStopWithPollsInFlight() {
+
+  const v_int32 coroutinesCount = 20;
+
+  coroutinesFinished = 0;
+  coroutinesDestroyed = 0;
+
+  int fds[2];
+  OATPP_ASSERT(::pipe(fds) == 0);
+  ::fcntl(fds[0], F_SETFL, O_NONBLOCK);
+
+  {
+
+    TestProcessor test(oatpp::async::worker::IOUringWorker::DEFAULT_RING_ENTRIES);
+
+    for(v_int32 i = 0; i < coroutinesCount; i ++) {
+      test.processor.execute<ReadByteCoroutine>(fds[0]);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  }
+
+  /* nothing was written to the pipe - coroutines waiting for I/O are destroyed together with the worker */
+  OATPP_ASSERT(coroutinesFinished == 0);
+  OATPP_ASSERT(coroutinesDestroyed == coroutinesCount);
+
+  ::close(fds[0]);
+  ::close(fds[1]);
+
+}
+
+}
+
+void IOUringWorkerTest::onRun() {
+
+  if(!oatpp::async::worker::IOUringWorker::isSupported()) {
+    OATPP_LOGI(TAG, "Skipped. io_uring is not supported by the running kernel.");
+    return;
+  }
+
+  OATPP_LOGI(TAG, "More polls than ring entries...");
+  testMorePollsThanRingEntries();
+  OATPP_LOGI(TAG, "OK");
+
+  OATPP_LOGI(TAG, "Stop with polls in flight...");
+  testStopWithPollsInFlight();
+  OATPP_LOGI(TAG, "OK");
+
+}
+
+#else
+
+void IOUringWorkerTest::onRun() {
+  OATPP_LOGI(TAG, "Skipped. io_uring is not available on this platform.");
+}
+
+#endif
+
+}}}
@@ -0,0 +1,189 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOWorkerPerfTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <vector>
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#endif
+
+namespace oatpp { namespace test { namespace async {
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+namespace {
+
+static constexpr v_int32 NUM_PAIRS = 100;
+static constexpr v_int32 NUM_ROUNDS = 200;
+
+std::atomic<v_int32> roundsCompleted(0);
+
+/*
+ * Write one byte to the socket and wait for it to come back. Repeat NUM_ROUNDS times.
+ */
+class PingCoroutine : public oatpp::async::Coroutine<PingCoroutine> {
+private:
+  v_io_handle m_fd;
+  v_int32 m_counter;
+public:
+
+  PingCoroutine(v_io_handle fd)
+    : m_fd(fd)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    v_char8 c = 'p';
+    auto res = ::write(m_fd, &c, 1);
+    if(res == 1) {
+      return yieldTo(&PingCoroutine::readPong);
+    }
+    if(res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return ioWait(m_fd, Action::IOEventType::IO_EVENT_WRITE);
+    }
+    return error<oatpp::async::Error>("[PingCoroutine::act()]: Error. Write failed.");
+  }
+
+  Action readPong() {
+    v_char8 c;
+    auto res = ::read(m_fd, &c, 1);
+    if(res == 1) {
+      ++ roundsCompleted;
+      if(++ m_counter < NUM_ROUNDS) {
+        return yieldTo(&PingCoroutine::act);
+      }
+      ::shutdown(m_fd, SHUT_WR);
+      return finish();
+    }
+    if(res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return ioWait(m_fd, Action::IOEventType::IO_EVENT_READ);
+    }
+    return error<oatpp::async::Error>("[PingCoroutine::readPong()]: Error. Read failed.");
+  }
+
+};
+
+/*
+ * Echo every byte back until the other side shuts the socket down.
+ */
+class PongCoroutine : public oatpp::async::Coroutine<PongCoroutine> {
+private:
+  v_io_handle m_fd;
+  v_char8 m_byte;
+public:
+
+  PongCoroutine(v_io_handle fd)
+    : m_fd(fd)
+    , m_byte(0)
+  {}
+
+  Action act() override {
+    auto res = ::read(m_fd, &m_byte, 1);
+    if(res == 1) {
+      return yieldTo(&PongCoroutine::writePong);
+    }
+    if(res == 0) {
+      return finish();
+    }
+    if(errno == EAGAIN || errno == EWOULDBLOCK) {
+      return ioWait(m_fd, Action::IOEventType::IO_EVENT_READ);
+    }
+    return error<oatpp::async::Error>("[PongCoroutine::act()]: Error. Read failed.");
+  }
+
+  Action writePong() {
+    auto res = ::write(m_fd, &m_byte, 1);
+    if(res == 1) {
+      return yieldTo(&PongCoroutine::act);
+    }
+    if(res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return ioWait(m_fd, Action::IOEventType::IO_EVENT_WRITE);
+    }
+    return error<oatpp::async::Error>("[PongCoroutine::writePong()]: Error. Write failed.");
+  }
+
+};
+
+void runPingPong(const char* tag, v_int32 ioWorkerType) {
+
+  roundsCompleted = 0;
+
+  oatpp::async::Executor executor(2, 1, 1, ioWorkerType);
+  std::vector<v_io_handle> handles;
+
+  {
+
+    PerformanceChecker checker(tag);
+
+    for(v_int32 i = 0; i < NUM_PAIRS; i ++) {
+      int fds[2];
+      OATPP_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+      ::fcntl(fds[0], F_SETFL, O_NONBLOCK);
+      ::fcntl(fds[1], F_SETFL, O_NONBLOCK);
+      handles.push_back(fds[0]);
+      handles.push_back(fds[1]);
+      executor.execute<PongCoroutine>(fds[1]);
+      executor.execute<PingCoroutine>(fds[0]);
+    }
+
+    executor.waitTasksFinished();
+
+  }
+
+  executor.stop();
+  executor.join();
+
+  for(auto handle : handles) {
+    ::close(handle);
+  }
+
+  OATPP_LOGD(tag, "rounds completed=%d", roundsCompleted.load());
+  OATPP_ASSERT(roundsCompleted == NUM_PAIRS * NUM_ROUNDS);
+
+}
+
+}
+
+void IOWorkerPerfTest::onRun() {
+  runPingPong("IO_WORKER_TYPE_EVENT", oatpp::async::Executor::IO_WORKER_TYPE_EVENT);
+  runPingPong("IO_WORKER_TYPE_URING", oatpp::async::Executor::IO_WORKER_TYPE_URING);
+}
+
+#else
+
+void IOWorkerPerfTest::onRun() {
+  OATPP_LOGI(TAG, "Skipped. Socket pairs are not available on this platform.");
+}
+
+#endif
+
+}}}
@@ -0,0 +1,154 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "MPSCQueueTest.hpp"
+
+#include "oatpp/core/async/utils/MPSCQueue.hpp"
+#include "oatpp/core/async/utils/Notifier.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+struct Entry {
+  v_int32 producer;
+  v_int32 index;
+  Entry* _ref;
+};
+
+}
+
+void MPSCQueueTest::onRun() {
+
+  typedef oatpp::async::utils::MPSCQueue<Entry> Queue;
+  typedef oatpp::async::utils::FastQueue<Entry> LocalQueue;
+
+  {
+    OATPP_LOGI(TAG, "Test order...");
+
+    Queue queue;
+    OATPP_ASSERT(queue.empty());
+
+    queue.pushBack(new Entry{0, 0, nullptr});
+    queue.pushBack(new Entry{0, 1, nullptr});
+
+    LocalQueue batch;
+    batch.pushBack(new Entry{0, 2, nullptr});
+    batch.pushBack(new Entry{0, 3, nullptr});
+    queue.pushAll(batch);
+    OATPP_ASSERT(batch.first == nullptr && batch.count == 0);
+
+    queue.pushBack(new Entry{0, 4, nullptr});
+    OATPP_ASSERT(!queue.empty());
+
+    LocalQueue result;
+    result.pushBack(new Entry{-1, -1, nullptr});
+    OATPP_ASSERT(queue.popAll(result) == 5);
+    OATPP_ASSERT(queue.empty());
+    OATPP_ASSERT(result.count == 6);
+
+    result.popFrontNoData();
+    v_int32 expected = 0;
+    for(Entry* curr = result.first; curr != nullptr; curr = curr->_ref) {
+      OATPP_ASSERT(curr->index == expected);
+      expected ++;
+    }
+    OATPP_ASSERT(expected == 5);
+    OATPP_ASSERT(result.last->index == 4);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test multiple producers...");
+
+    const v_int32 producersCount = 8;
+    const v_int32 entriesCount = 50000;
+
+    Queue queue;
+    oatpp::async::utils::Notifier notifier;
+    std::vector<std::thread> producers;
+
+    for(v_int32 p = 0; p < producersCount; p ++) {
+      producers.push_back(std::thread([p, &queue, &notifier]{
+        for(v_int32 i = 0; i < entriesCount; i ++) {
+          if(i % 10 == 0) {
+            LocalQueue batch;
+            for(v_int32 j = 0; j < 10 && i < entriesCount; j ++, i ++) {
+              batch.pushBack(new Entry{p, i, nullptr});
+            }
+            i --;
+            queue.pushAll(batch);
+          } else {
+            queue.pushBack(new Entry{p, i, nullptr});
+          }
+          notifier.notify();
+        }
+      }));
+    }
+
+    std::vector<v_int32> lastIndex(producersCount, -1);
+    v_int32 received = 0;
+
+    while(received < producersCount * entriesCount) {
+
+      LocalQueue batch;
+      if(queue.popAll(batch) == 0) {
+        notifier.announceWait();
+        if(queue.empty()) {
+          notifier.wait(std::chrono::milliseconds(100));
+        } else {
+          notifier.cancelWait();
+        }
+        continue;
+      }
+
+      while(batch.first != nullptr) {
+        Entry* entry = batch.first;
+        OATPP_ASSERT(entry->index == lastIndex[entry->producer] + 1);
+        lastIndex[entry->producer] = entry->index;
+        received ++;
+        batch.popFrontNoData();
+      }
+
+    }
+
+    for(auto& t : producers) {
+      t.join();
+    }
+
+    OATPP_ASSERT(queue.empty());
+    for(v_int32 p = 0; p < producersCount; p ++) {
+      OATPP_ASSERT(lastIndex[p] == entriesCount - 1);
+    }
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+}
+
+}}}
@@ -0,0 +1,117 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ShardedExecutorTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+
+#include <thread>
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+class ShardCheckCoroutine : public oatpp::async::Coroutine<ShardCheckCoroutine> {
+private:
+  std::atomic<v_int32>* m_finished;
+  std::atomic<v_int32>* m_migrations;
+  std::thread::id m_threads[2];
+  v_int32 m_threadsCount;
+  v_int32 m_counter;
+private:
+  void checkThread() {
+    auto id = std::this_thread::get_id();
+    for(v_int32 i = 0; i < m_threadsCount; i ++) {
+      if(m_threads[i] == id) {
+        return;
+      }
+    }
+    if(m_threadsCount < 2) {
+      m_threads[m_threadsCount ++] = id;
+    } else {
+      (*m_migrations) ++;
+    }
+  }
+public:
+
+  ShardCheckCoroutine(std::atomic<v_int32>* finished, std::atomic<v_int32>* migrations)
+    : m_finished(finished)
+    , m_migrations(migrations)
+    , m_threadsCount(0)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    checkThread();
+    return yieldTo(&ShardCheckCoroutine::step);
+  }
+
+  Action step() {
+
+    /* coroutine may only be iterated by its home processor and by the timer worker of the same shard */
+    checkThread();
+
+    m_counter ++;
+    if(m_counter < 10) {
+      if(m_counter % 2 == 0) {
+        return waitRepeat(std::chrono::milliseconds(1));
+      }
+      return repeat();
+    }
+
+    (*m_finished) ++;
+    return finish();
+
+  }
+
+};
+
+}
+
+void ShardedExecutorTest::onRun() {
+
+  const v_int32 shardsCount = 4;
+  const v_int32 coroutinesCount = 1000;
+
+  std::atomic<v_int32> finished(0);
+  std::atomic<v_int32> migrations(0);
+
+  auto executor = oatpp::async::Executor::createSharded(shardsCount);
+
+  for(v_int32 i = 0; i < coroutinesCount; i ++) {
+    executor->execute<ShardCheckCoroutine>(&finished, &migrations);
+  }
+
+  executor->waitTasksFinished();
+  executor->stop();
+  executor->join();
+
+  OATPP_LOGD(TAG, "finished=%d, migrations=%d", finished.load(), migrations.load());
+
+  OATPP_ASSERT(finished.load() == coroutinesCount);
+  OATPP_ASSERT(migrations.load() == 0);
+
+}
+
+}}}
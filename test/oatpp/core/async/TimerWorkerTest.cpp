@@ -0,0 +1,193 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "TimerWorkerTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+v_int64 getMicroTickCount() {
+  return std::chrono::duration_cast<std::chrono::microseconds>
+    (std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+struct FiredTimers {
+  std::mutex mutex;
+  std::vector<v_int64> delays;
+  std::vector<v_int64> lateness;
+};
+
+/*
+ * Wait for the given delay and record when the timer fired.
+ */
+class DelayCoroutine : public oatpp::async::Coroutine<DelayCoroutine> {
+private:
+  FiredTimers* m_fired;
+  v_int64 m_delay;
+  v_int64 m_deadline;
+public:
+
+  DelayCoroutine(FiredTimers* fired, v_int64 delayMicroseconds)
+    : m_fired(fired)
+    , m_delay(delayMicroseconds)
+    , m_deadline(0)
+  {}
+
+  Action act() override {
+    m_deadline = getMicroTickCount() + m_delay;
+    return yieldTo(&DelayCoroutine::onFired);
+  }
+
+  Action onFired() {
+    if(getMicroTickCount() < m_deadline) {
+      return Action::createWaitRepeatAction(m_deadline);
+    }
+    std::lock_guard<std::mutex> lock(m_fired->mutex);
+    m_fired->delays.push_back(m_delay);
+    m_fired->lateness.push_back(getMicroTickCount() - m_deadline);
+    return finish();
+  }
+
+};
+
+/*
+ * Keep returning a time point which is already in the past until released.
+ */
+class PastTimePointCoroutine : public oatpp::async::Coroutine<PastTimePointCoroutine> {
+private:
+  std::atomic<bool>* m_released;
+public:
+
+  PastTimePointCoroutine(std::atomic<bool>* released)
+    : m_released(released)
+  {}
+
+  Action act() override {
+    if(*m_released) {
+      return finish();
+    }
+    return Action::createWaitRepeatAction(0);
+  }
+
+};
+
+class ReleaseCoroutine : public oatpp::async::Coroutine<ReleaseCoroutine> {
+private:
+  std::atomic<bool>* m_released;
+  bool m_waited;
+public:
+
+  ReleaseCoroutine(std::atomic<bool>* released)
+    : m_released(released)
+    , m_waited(false)
+  {}
+
+  Action act() override {
+    if(!m_waited) {
+      m_waited = true;
+      return waitRepeat(std::chrono::milliseconds(1));
+    }
+    *m_released = true;
+    return finish();
+  }
+
+};
+
+}
+
+void TimerWorkerTest::onRun() {
+
+  OATPP_LOGI(TAG, "Timers fire in order of their deadlines...");
+  {
+    FiredTimers fired;
+    oatpp::async::Executor executor(1, 1, 1);
+
+    const v_int64 delaysMs[] = {50, 10, 40, 20, 30};
+    for(auto delay : delaysMs) {
+      executor.execute<DelayCoroutine>(&fired, delay * 1000);
+    }
+
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+
+    OATPP_ASSERT(fired.delays.size() == 5);
+    for(size_t i = 1; i < fired.delays.size(); i ++) {
+      OATPP_ASSERT(fired.delays[i - 1] < fired.delays[i]);
+    }
+  }
+  OATPP_LOGI(TAG, "OK");
+
+  OATPP_LOGI(TAG, "Worker sleeps until the nearest deadline...");
+  {
+    FiredTimers fired;
+    oatpp::async::Executor executor(1, 1, 1);
+
+    /* long timer is pushed first - the worker must wake up earlier for the short one */
+    executor.execute<DelayCoroutine>(&fired, 1000 * 1000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    executor.execute<DelayCoroutine>(&fired, 5 * 1000);
+
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+
+    OATPP_ASSERT(fired.delays.size() == 2);
+    OATPP_ASSERT(fired.delays[0] == 5 * 1000);
+    for(auto late : fired.lateness) {
+      OATPP_LOGD(TAG, "timer fired %lld(micro) after its deadline", late);
+      /* well below the 100ms granularity used for I/O re-checks */
+      OATPP_ASSERT(late < 50 * 1000);
+    }
+  }
+  OATPP_LOGI(TAG, "OK");
+
+  OATPP_LOGI(TAG, "Time point in the past doesn't block the worker...");
+  {
+    std::atomic<bool> released(false);
+    oatpp::async::Executor executor(1, 1, 1);
+
+    executor.execute<PastTimePointCoroutine>(&released);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    /* goes through the timer worker backlog */
+    executor.execute<ReleaseCoroutine>(&released);
+
+    executor.waitTasksFinished(std::chrono::seconds(10));
+    OATPP_ASSERT(released);
+    OATPP_ASSERT(executor.getTasksCount() == 0);
+
+    executor.stop();
+    executor.join();
+  }
+  OATPP_LOGI(TAG, "OK");
+
+}
+
+}}}
@@ -0,0 +1,206 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "WorkStealingTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+#include "oatpp/core/async/Processor.hpp"
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+/* Both processors are iterated from the test thread, so the processor being iterated is simply recorded here */
+oatpp::async::Processor* currentProcessor = nullptr;
+
+struct Counters {
+  oatpp::async::Processor* victim;
+  std::atomic<bool> released{false};
+  std::atomic<v_int32> finishedOnVictim{0};
+  std::atomic<v_int32> finishedOnThief{0};
+};
+
+class SpinCoroutine : public oatpp::async::Coroutine<SpinCoroutine> {
+private:
+  Counters* m_counters;
+public:
+
+  SpinCoroutine(Counters* counters)
+    : m_counters(counters)
+  {}
+
+  Action act() override {
+    if(!m_counters->released) {
+      return repeat();
+    }
+    if(currentProcessor == m_counters->victim) {
+      m_counters->finishedOnVictim ++;
+    } else {
+      m_counters->finishedOnThief ++;
+    }
+    return finish();
+  }
+
+};
+
+class LongCoroutine : public oatpp::async::Coroutine<LongCoroutine> {
+private:
+  std::atomic<v_int32>* m_finished;
+  v_int32 m_counter;
+public:
+
+  LongCoroutine(std::atomic<v_int32>* finished)
+    : m_finished(finished)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(++ m_counter < 10000) {
+      return repeat();
+    }
+    (*m_finished) ++;
+    return finish();
+  }
+
+};
+
+void iterateAll(oatpp::async::Processor& victim, oatpp::async::Processor& thief) {
+  bool active = true;
+  while(active) {
+    currentProcessor = &victim;
+    active = victim.iterate(10);
+    currentProcessor = &thief;
+    active = thief.iterate(10) || active;
+  }
+}
+
+void testStealSubmissions() {
+
+  oatpp::async::Processor victim;
+  oatpp::async::Processor thief;
+
+  Counters counters;
+  counters.victim = &victim;
+  counters.released = true;
+
+  for(v_int32 i = 0; i < 10; i ++) {
+    victim.execute<SpinCoroutine>(&counters);
+  }
+
+  /* victim hasn't picked up its submissions yet - half of them is taken immediately */
+  OATPP_ASSERT(thief.stealTasks(victim) == 5);
+  OATPP_ASSERT(victim.getTasksCount() == 5);
+  OATPP_ASSERT(thief.getTasksCount() == 5);
+  OATPP_ASSERT(thief.getStealAttemptsCount() == 1);
+  OATPP_ASSERT(thief.getStealSuccessesCount() == 1);
+
+  iterateAll(victim, thief);
+
+  OATPP_ASSERT(counters.finishedOnVictim == 5);
+  OATPP_ASSERT(counters.finishedOnThief == 5);
+  OATPP_ASSERT(victim.getTasksCount() == 0);
+  OATPP_ASSERT(thief.getTasksCount() == 0);
+
+  victim.stop();
+  thief.stop();
+
+}
+
+void testDonateActiveCoroutines() {
+
+  oatpp::async::Processor victim;
+  oatpp::async::Processor thief;
+
+  Counters counters;
+  counters.victim = &victim;
+
+  for(v_int32 i = 0; i < 10; i ++) {
+    victim.execute<SpinCoroutine>(&counters);
+  }
+
+  /* all coroutines are now active in the victim's queue */
+  currentProcessor = &victim;
+  victim.iterate(10);
+
+  /* nothing is pending - the thief can only ask for a donation */
+  OATPP_ASSERT(thief.stealTasks(victim) == 0);
+  OATPP_ASSERT(thief.getStealSuccessesCount() == 0);
+  OATPP_ASSERT(thief.getTasksCount() == 0);
+
+  /* the victim donates half of its coroutines on its next iteration */
+  victim.iterate(1);
+  OATPP_ASSERT(victim.getTasksCount() == 5);
+  OATPP_ASSERT(thief.getTasksCount() == 5);
+  OATPP_ASSERT(thief.getStealSuccessesCount() == 1);
+
+  counters.released = true;
+  iterateAll(victim, thief);
+
+  OATPP_ASSERT(counters.finishedOnVictim == 5);
+  OATPP_ASSERT(counters.finishedOnThief == 5);
+
+  victim.stop();
+  thief.stop();
+
+}
+
+void testExecutor() {
+
+  std::atomic<v_int32> finished(0);
+
+  oatpp::async::Executor executor(2, 1, 1, oatpp::async::Executor::VALUE_SUGGESTED, true);
+
+  /* Executor balances submissions round-robin, so every other coroutine lands on the same processor */
+  for(v_int32 i = 0; i < 100; i ++) {
+    executor.execute<LongCoroutine>(&finished);
+  }
+
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  OATPP_ASSERT(finished == 100);
+  OATPP_ASSERT(executor.getStealAttemptsCount() > 0);
+
+}
+
+}
+
+void WorkStealingTest::onRun() {
+
+  OATPP_LOGI(TAG, "Steal pending submissions...");
+  testStealSubmissions();
+  OATPP_LOGI(TAG, "OK");
+
+  OATPP_LOGI(TAG, "Donate active coroutines...");
+  testDonateActiveCoroutines();
+  OATPP_LOGI(TAG, "OK");
+
+  OATPP_LOGI(TAG, "Executor with work stealing...");
+  testExecutor();
+  OATPP_LOGI(TAG, "OK");
+
+}
+
+}}}
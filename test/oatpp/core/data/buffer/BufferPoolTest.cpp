@@ -0,0 +1,105 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "BufferPoolTest.hpp"
+
+#include "oatpp/core/data/buffer/BufferPool.hpp"
+
+namespace oatpp { namespace test { namespace core { namespace data { namespace buffer {
+
+void BufferPoolTest::onRun() {
+
+  typedef oatpp::data::buffer::BufferPool BufferPool;
+
+  { // memory
+    BufferPool pool(2);
+
+    auto memory = pool.acquireMemory(3000);
+    OATPP_ASSERT(memory->size() == 4096);
+    auto data = memory->data();
+
+    pool.releaseMemory(memory);
+    OATPP_ASSERT(memory == nullptr);
+    OATPP_ASSERT(pool.getPooledCount() == 1);
+
+    memory = pool.acquireMemory(4096);
+    OATPP_ASSERT(memory->data() == data);
+    OATPP_ASSERT(pool.getPooledCount() == 0);
+
+    { // shared buffer is not pooled
+      auto copy = memory;
+      pool.releaseMemory(memory);
+      OATPP_ASSERT(pool.getPooledCount() == 0);
+    }
+
+    // out of size classes
+    memory = pool.acquireMemory(BufferPool::MAX_CLASS_SIZE + 1);
+    OATPP_ASSERT(memory->size() == BufferPool::MAX_CLASS_SIZE + 1);
+    pool.releaseMemory(memory);
+    OATPP_ASSERT(pool.getPooledCount() == 0);
+
+    // max buffers per class
+    auto m1 = pool.acquireMemory(100);
+    auto m2 = pool.acquireMemory(100);
+    auto m3 = pool.acquireMemory(100);
+    OATPP_ASSERT(m1->size() == BufferPool::MIN_CLASS_SIZE);
+    pool.releaseMemory(m1);
+    pool.releaseMemory(m2);
+    pool.releaseMemory(m3);
+    OATPP_ASSERT(pool.getPooledCount() == 2);
+  }
+
+  { // streams
+    BufferPool pool;
+
+    auto stream = pool.acquireStream(2048);
+    OATPP_ASSERT(stream->getCapacity() == 2048);
+    *stream << "Hello World!!!";
+    auto streamPtr = stream.get();
+
+    pool.releaseStream(stream);
+    OATPP_ASSERT(stream == nullptr);
+    OATPP_ASSERT(pool.getPooledCount() == 1);
+
+    stream = pool.acquireStream(1500);
+    OATPP_ASSERT(stream.get() == streamPtr);
+    OATPP_ASSERT(stream->getCurrentPosition() == 0);
+
+    // grown stream goes to the class it can serve
+    stream->reserveBytesUpfront(5000);
+    OATPP_ASSERT(stream->getCapacity() == 8192);
+    pool.releaseStream(stream);
+
+    stream = pool.acquireStream(2048);
+    OATPP_ASSERT(stream.get() != streamPtr);
+    OATPP_ASSERT(stream->getCapacity() == 2048);
+
+    auto big = pool.acquireStream(8000);
+    OATPP_ASSERT(big.get() == streamPtr);
+  }
+
+}
+
+}}}}}
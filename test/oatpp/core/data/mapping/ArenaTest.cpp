@@ -0,0 +1,259 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ArenaTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/mapping/Arena.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace core { namespace data { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class ItemDto : public oatpp::DTO {
+
+  DTO_INIT(ItemDto, DTO)
+
+  DTO_FIELD(String, name);
+  DTO_FIELD(Int32, count);
+  DTO_FIELD(Boolean, active);
+
+};
+
+class TestDto : public oatpp::DTO {
+
+  DTO_INIT(TestDto, DTO)
+
+  DTO_FIELD(String, title);
+  DTO_FIELD(Float64, score);
+  DTO_FIELD(List<Object<ItemDto>>, items);
+  DTO_FIELD(Fields<String>, tags);
+  DTO_FIELD(Any, any);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+const char* const JSON =
+  "{\"title\":\"arena\",\"score\":1.5,"
+  "\"items\":[{\"name\":\"a\",\"count\":1,\"active\":true},{\"name\":\"b\",\"count\":2,\"active\":false}],"
+  "\"tags\":{\"k1\":\"v1\",\"k2\":\"v2\"},"
+  "\"any\":\"some value\"}";
+
+oatpp::Object<TestDto> readWithArena(oatpp::parser::json::mapping::ObjectMapper& mapper,
+                                     const std::shared_ptr<oatpp::data::mapping::Arena>& arena)
+{
+  auto reader = mapper.createReader(oatpp::Object<TestDto>::Class::getType());
+  reader->setArena(arena);
+  oatpp::String json = JSON;
+  v_buff_size half = json->size() / 2;
+  oatpp::async::Action action;
+  reader->write(json->data(), half, action);
+  reader->write(json->data() + half, json->size() - half, action);
+  auto result = reader->finish();
+  OATPP_ASSERT(!reader->hasError());
+  return result.cast<oatpp::Object<TestDto>>();
+}
+
+}
+
+void ArenaTest::onRun() {
+
+  typedef oatpp::data::mapping::Arena Arena;
+
+  {
+    OATPP_LOGI(TAG, "Test raw allocations...");
+
+    Arena arena(128);
+    OATPP_ASSERT(arena.getChunksCount() == 0);
+
+    auto p1 = arena.allocate(1, 1);
+    auto p2 = arena.allocate(8, 8);
+    auto p3 = arena.allocate(16, 16);
+    OATPP_ASSERT(p1 != nullptr && p2 != nullptr && p3 != nullptr);
+    OATPP_ASSERT(reinterpret_cast<std::uintptr_t>(p2) % 8 == 0);
+    OATPP_ASSERT(reinterpret_cast<std::uintptr_t>(p3) % 16 == 0);
+    OATPP_ASSERT(arena.getChunksCount() == 1);
+
+    auto big = arena.allocate(1024, 8);
+    OATPP_ASSERT(big != nullptr);
+    OATPP_ASSERT(arena.getChunksCount() == 2);
+
+    /* big allocation doesn't break the current chunk */
+    auto p4 = arena.allocate(8, 8);
+    OATPP_ASSERT(static_cast<p_char8>(p4) > static_cast<p_char8>(p3));
+    OATPP_ASSERT(arena.getChunksCount() == 2);
+
+    for(v_int32 i = 0; i < 100; i ++) {
+      arena.allocate(8, 8);
+    }
+    OATPP_ASSERT(arena.getChunksCount() > 2);
+    OATPP_ASSERT(arena.getAllocatedBytes() == 1 + 8 + 16 + 1024 + 8 + 800);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+
+  {
+    OATPP_LOGI(TAG, "Test scopes...");
+
+    auto arena1 = Arena::createShared();
+    auto arena2 = Arena::createShared();
+
+    OATPP_ASSERT(Arena::getCurrent() == nullptr);
+
+    {
+      Arena::Scope scope1(arena1);
+      OATPP_ASSERT(Arena::getCurrent() != nullptr && *Arena::getCurrent() == arena1);
+
+      oatpp::String str1 = "hello";
+      OATPP_ASSERT(arena1->getAllocatedBytes() > 0);
+
+      {
+        Arena::Scope scope2(arena2);
+        OATPP_ASSERT(*Arena::getCurrent() == arena2);
+        oatpp::Int32 value = 10;
+        OATPP_ASSERT(arena2->getAllocatedBytes() > 0);
+
+        {
+          Arena::Scope heapScope(nullptr);
+          OATPP_ASSERT(Arena::getCurrent() == nullptr);
+        }
+
+        OATPP_ASSERT(*Arena::getCurrent() == arena2);
+      }
+
+      OATPP_ASSERT(*Arena::getCurrent() == arena1);
+    }
+
+    OATPP_ASSERT(Arena::getCurrent() == nullptr);
+
+    auto bytes = arena1->getAllocatedBytes();
+    oatpp::String str2 = "heap";
+    OATPP_ASSERT(arena1->getAllocatedBytes() == bytes);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test arena lifetime...");
+
+    std::weak_ptr<Arena> weakArena;
+    oatpp::String str;
+
+    {
+      auto arena = Arena::createShared();
+      weakArena = arena;
+      Arena::Scope scope(arena);
+      str = "value";
+    }
+
+    OATPP_ASSERT(!weakArena.expired());
+    OATPP_ASSERT(str == "value");
+
+    oatpp::String copy = str;
+    str = nullptr;
+    OATPP_ASSERT(!weakArena.expired());
+
+    copy = nullptr;
+    OATPP_ASSERT(weakArena.expired());
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test DTO deserialized into arena...");
+
+    oatpp::parser::json::mapping::ObjectMapper mapper;
+
+    auto heapDto = readWithArena(mapper, nullptr);
+
+    std::weak_ptr<Arena> weakArena;
+    oatpp::Object<TestDto> dto;
+
+    {
+      auto arena = Arena::createShared();
+      weakArena = arena;
+      dto = readWithArena(mapper, arena);
+      OATPP_ASSERT(arena->getAllocatedBytes() > 0);
+      OATPP_LOGD(TAG, "arena bytes=%d, chunks=%d", arena->getAllocatedBytes(), arena->getChunksCount());
+    }
+
+    OATPP_ASSERT(!weakArena.expired());
+    OATPP_ASSERT(mapper.writeToString(dto) == mapper.writeToString(heapDto));
+    OATPP_ASSERT(dto->items->size() == 2);
+    OATPP_ASSERT(dto->items->back()->name == "b");
+    OATPP_ASSERT(dto->any.retrieve<oatpp::String>() == "some value");
+
+    /* objects created after deserialization go to the heap and don't hold the arena */
+    dto->title = "new title";
+    dto->items->push_back(ItemDto::createShared());
+
+    auto item = dto->items->front();
+    dto = nullptr;
+    OATPP_ASSERT(!weakArena.expired());
+    OATPP_ASSERT(item->name == "a");
+
+    item = nullptr;
+    OATPP_ASSERT(weakArena.expired());
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+#endif
+
+  {
+    OATPP_LOGI(TAG, "Allocation cost with no active arena...");
+
+    const v_int32 numIterations = 1000000;
+    v_int64 checksum = 0;
+
+    {
+      PerformanceChecker checker("std::make_shared");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        checksum += (v_int64) std::make_shared<std::string>("value")->size();
+      }
+    }
+
+    {
+      PerformanceChecker checker("Arena::allocateShared - no scope");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        checksum += (v_int64) Arena::allocateShared<std::string>("value")->size();
+      }
+    }
+
+    OATPP_ASSERT(checksum == 2 * 5 * (v_int64) numIterations);
+    OATPP_LOGI(TAG, "OK");
+  }
+
+}
+
+}}}}}
@@ -0,0 +1,216 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "InlineTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/mapping/TypeResolver.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace test { namespace core { namespace data { namespace mapping { namespace  type {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class PointDto : public oatpp::DTO {
+
+  DTO_INIT(PointDto, DTO)
+
+  DTO_FIELD(Inline<Int8>, i8);
+  DTO_FIELD(Inline<UInt16>, u16);
+  DTO_FIELD(Inline<Int32>, i32) = 32;
+  DTO_FIELD(Inline<UInt64>, u64);
+  DTO_FIELD(Inline<Float32>, f32);
+  DTO_FIELD(Inline<Float64>, f64, "float-64");
+  DTO_FIELD(Inline<Boolean>, flag);
+  DTO_FIELD(Int32, boxed);
+  DTO_FIELD(Vector<Inline<Int32>>, values);
+
+  DTO_HC_EQ(i8, u16, i32, u64, f32, f64, flag, boxed)
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void InlineTest::onRun() {
+
+  {
+    OATPP_LOGI(TAG, "test value semantics...");
+
+    oatpp::Inline<oatpp::Int32> i;
+    OATPP_ASSERT(i == nullptr);
+    OATPP_ASSERT(!i.hasValue());
+    OATPP_ASSERT(i.getValue(5) == 5);
+
+    i = 10;
+    OATPP_ASSERT(i != nullptr);
+    OATPP_ASSERT(i == 10);
+    OATPP_ASSERT(*i == 10);
+
+    oatpp::Int32 boxed = i;
+    OATPP_ASSERT(boxed == 10);
+
+    i = oatpp::Int32(nullptr);
+    OATPP_ASSERT(i == nullptr);
+    OATPP_ASSERT(i.box() == nullptr);
+
+    oatpp::Inline<oatpp::Int32> a = 1, b = 1, c;
+    OATPP_ASSERT(a == b);
+    OATPP_ASSERT(a != c);
+    OATPP_ASSERT(std::hash<oatpp::Inline<oatpp::Int32>>{}(a) == std::hash<oatpp::Inline<oatpp::Int32>>{}(b));
+
+    oatpp::Inline<oatpp::Boolean> flag = true;
+    OATPP_ASSERT(flag == true);
+    OATPP_ASSERT(flag);
+
+    auto view = a.view();
+    OATPP_ASSERT(view.getValueType() == oatpp::Int32::Class::getType());
+    OATPP_ASSERT(view.getPtr().use_count() == 0); // non-owning
+    OATPP_ASSERT(*static_cast<v_int32*>(view.get()) == 1);
+
+    OATPP_ASSERT(oatpp::Void(oatpp::Int32(7)).cast<oatpp::Inline<oatpp::Int32>>() == 7);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "test properties...");
+
+    auto dto = PointDto::createShared();
+    auto& map = oatpp::Object<PointDto>::getPropertiesMap();
+    auto i32 = map.at("i32");
+    auto boxed = map.at("boxed");
+
+    OATPP_ASSERT(i32->isInline());
+    OATPP_ASSERT(!boxed->isInline());
+    OATPP_ASSERT(i32->type == oatpp::Int32::Class::getType());
+
+    auto value = i32->get(dto.get());
+    OATPP_ASSERT(value.getValueType() == oatpp::Int32::Class::getType());
+    OATPP_ASSERT(value.cast<oatpp::Int32>() == 32);
+
+    i32->set(dto.get(), oatpp::Int32(64));
+    OATPP_ASSERT(dto->i32 == 64);
+
+    i32->set(dto.get(), nullptr);
+    OATPP_ASSERT(dto->i32 == nullptr);
+    OATPP_ASSERT(!i32->get(dto.get()));
+    OATPP_ASSERT(!i32->getView(dto.get()));
+
+    bool thrown = false;
+    try {
+      i32->set(dto.get(), oatpp::String("bad type"));
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    /* operator[] rejects inline fields - they have no ObjectWrapper to reference */
+    thrown = false;
+    try {
+      dto["i32"];
+    } catch (const std::runtime_error& e) {
+      OATPP_LOGD(TAG, "error='%s'", e.what());
+      thrown = std::string(e.what()).find("'i32' is Inline<T>") != std::string::npos;
+    }
+    OATPP_ASSERT(thrown);
+
+    dto["boxed"] = oatpp::Int32(1);
+    OATPP_ASSERT(dto->boxed == 1);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "test TypeResolver...");
+
+    auto dto = PointDto::createShared();
+    dto->f64 = 0.5;
+
+    oatpp::data::mapping::TypeResolver::Cache cache;
+    oatpp::data::mapping::TypeResolver tr;
+
+    auto value = tr.resolveObjectPropertyValue(dto, {"float-64"}, cache);
+    OATPP_ASSERT(value.getValueType() == oatpp::Float64::Class::getType());
+    OATPP_ASSERT(value.cast<oatpp::Float64>() == 0.5);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "test json mapping...");
+
+    oatpp::parser::json::mapping::ObjectMapper mapper;
+
+    auto dto = PointDto::createShared();
+    dto->i8 = -8;
+    dto->u16 = 16;
+    dto->u64 = 18446744073709551615ULL;
+    dto->f32 = 0.25f;
+    dto->f64 = 0.125;
+    dto->flag = false;
+    dto->boxed = 100;
+    dto->values = {1, nullptr, 3};
+
+    auto json = mapper.writeToString(dto);
+    OATPP_LOGD(TAG, "json='%s'", json->c_str());
+    OATPP_ASSERT(json == oatpp::String(R"({"i8":-8,"u16":16,"i32":32,"u64":18446744073709551615,"f32":0.25,"float-64":0.125,"flag":false,"boxed":100,"values":[1,null,3]})"));
+
+    auto clone = mapper.readFromString<oatpp::Object<PointDto>>(json);
+    OATPP_ASSERT(clone == dto);
+    OATPP_ASSERT(clone->values->size() == 3);
+    OATPP_ASSERT(clone->values[0] == 1);
+    OATPP_ASSERT(clone->values[1] == nullptr);
+    OATPP_ASSERT(clone->values[2] == 3);
+
+    oatpp::data::stream::BufferInputStream stream(json);
+    auto streamed = mapper.readFromStream<oatpp::Object<PointDto>>(&stream);
+    OATPP_ASSERT(streamed == dto);
+    OATPP_ASSERT(mapper.writeToString(streamed) == json);
+
+    auto nulls = mapper.readFromString<oatpp::Object<PointDto>>(R"({"i32":null,"flag":true,"float-64":1e3})");
+    OATPP_ASSERT(nulls->i32 == nullptr);
+    OATPP_ASSERT(nulls->flag == true);
+    OATPP_ASSERT(nulls->f64 == 1000.0);
+
+    bool thrown = false;
+    try {
+      mapper.readFromString<oatpp::Object<PointDto>>(R"({"flag":1})");
+    } catch (const oatpp::parser::ParsingError&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+}
+
+}}}}}}
@@ -30,6 +30,38 @@
 
 namespace oatpp { namespace test { namespace core { namespace data { namespace stream {
 
+namespace {
+
+/*
+ * Stream accepting at most 3 bytes per write - to test partial vectored writes.
+ */
+class SlowOutputStream : public oatpp::data::stream::ConsistentOutputStream {
+public:
+
+  oatpp::data::stream::BufferOutputStream buffer;
+  v_int32 writesCount = 0;
+
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+    writesCount ++;
+    return buffer.write(data, count > 3 ? 3 : count, action);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+  oatpp::data::stream::Context& getOutputStreamContext() override {
+    return buffer.getOutputStreamContext();
+  }
+
+};
+
+}
+
 void BufferStreamTest::onRun() {
 
   typedef oatpp::data::stream::BufferOutputStream BufferOutputStream;
@@ -144,6 +176,53 @@ void BufferStreamTest::onRun() {
 
   }
 
+  {
+
+    BufferOutputStream stream;
+
+    oatpp::data::stream::IOVector vectors[4] = {
+      {"Hello", 5},
+      {nullptr, 0},
+      {" ", 1},
+      {"World!", 6}
+    };
+
+    oatpp::data::stream::InlineWriteVectorData writeData(vectors, 4);
+    OATPP_ASSERT(writeData.getBytesLeft() == 12);
+
+    auto res = stream.writevExactSizeDataSimple(writeData);
+    OATPP_ASSERT(res == 12);
+    OATPP_ASSERT(writeData.count == 0);
+    OATPP_ASSERT(stream.toString() == "Hello World!");
+
+  }
+
+  {
+
+    SlowOutputStream stream;
+
+    oatpp::data::stream::IOVector vectors[3] = {
+      {"Hello", 5},
+      {" ", 1},
+      {"World!", 6}
+    };
+
+    oatpp::data::stream::InlineWriteVectorData writeData(vectors, 3);
+
+    async::Action action;
+    auto res = stream.writev(writeData, action);
+    OATPP_ASSERT(res == 3);
+    OATPP_ASSERT(writeData.count == 3);
+    OATPP_ASSERT(writeData.vectors->size == 2);
+
+    res = stream.writevExactSizeDataSimple(writeData);
+    OATPP_ASSERT(res == 9);
+    OATPP_ASSERT(writeData.count == 0);
+    OATPP_ASSERT(stream.buffer.toString() == "Hello World!");
+    OATPP_ASSERT(stream.writesCount == 5);
+
+  }
+
 }
 
-}}}}}
\ No newline at end of file
+}}}}}
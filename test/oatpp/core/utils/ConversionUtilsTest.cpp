@@ -0,0 +1,266 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ConversionUtilsTest.hpp"
+
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <cstring>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+namespace oatpp { namespace test { namespace core { namespace utils {
+
+namespace {
+
+namespace conversion = oatpp::utils::conversion;
+
+std::string formatFloat64(v_float64 value) {
+  v_char8 buffer[100];
+  auto size = conversion::float64ToCharSequence(value, buffer, 100);
+  return std::string((const char*) buffer, size);
+}
+
+std::string formatFloat32(v_float32 value) {
+  v_char8 buffer[100];
+  auto size = conversion::float32ToCharSequence(value, buffer, 100);
+  return std::string((const char*) buffer, size);
+}
+
+v_float64 parseFloat64(const std::string& text) {
+  v_float64 result;
+  OATPP_ASSERT(conversion::parseFloat64(text.data(), text.size(), result) == (v_buff_size) text.size());
+  return result;
+}
+
+v_float32 parseFloat32(const std::string& text) {
+  v_float32 result;
+  OATPP_ASSERT(conversion::parseFloat32(text.data(), text.size(), result) == (v_buff_size) text.size());
+  return result;
+}
+
+/*
+ * Number of significant digits - leading and trailing zeros are not counted.
+ */
+v_int32 countDigits(const std::string& text) {
+  std::string digits;
+  for(char c : text) {
+    if(c == 'e') break;
+    if(c >= '0' && c <= '9') digits.push_back(c);
+  }
+  auto first = digits.find_first_not_of('0');
+  auto last = digits.find_last_not_of('0');
+  return first == std::string::npos ? 0 : (v_int32)(last - first + 1);
+}
+
+/*
+ * Number of significant digits of the shortest "%.<precision>g" representation that reads back to the same value.
+ */
+v_int32 shortestPrintfDigits(v_float64 value) {
+  char buffer[64];
+  for(v_int32 precision = 1; precision < 17; precision ++) {
+    snprintf(buffer, 64, "%.*g", precision, value);
+    if(std::strtod(buffer, nullptr) == value) {
+      return precision;
+    }
+  }
+  return 17;
+}
+
+v_int32 shortestPrintfDigits(v_float32 value) {
+  char buffer[64];
+  for(v_int32 precision = 1; precision < 9; precision ++) {
+    snprintf(buffer, 64, "%.*g", precision, (double) value);
+    if(std::strtof(buffer, nullptr) == value) {
+      return precision;
+    }
+  }
+  return 9;
+}
+
+bool sameBits(v_float64 a, v_float64 b) {
+  return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+}
+
+void ConversionUtilsTest::onRun() {
+
+  {
+    OATPP_LOGI(TAG, "Test integers...");
+
+    OATPP_ASSERT(conversion::int32ToStr(0) == "0");
+    OATPP_ASSERT(conversion::int32ToStr(7) == "7");
+    OATPP_ASSERT(conversion::int32ToStr(-42) == "-42");
+    OATPP_ASSERT(conversion::int32ToStr(2147483647) == "2147483647");
+    OATPP_ASSERT(conversion::int32ToStr(-2147483647 - 1) == "-2147483648");
+    OATPP_ASSERT(conversion::uint32ToStr(4294967295U) == "4294967295");
+    OATPP_ASSERT(conversion::int64ToStr(INT64_MIN) == "-9223372036854775808");
+    OATPP_ASSERT(conversion::int64ToStr(INT64_MAX) == "9223372036854775807");
+    OATPP_ASSERT(conversion::uint64ToStr(UINT64_MAX) == "18446744073709551615");
+
+    v_char8 buffer[4];
+    OATPP_ASSERT(conversion::int32ToCharSequence(123456, buffer, 4) == 6);
+    OATPP_ASSERT(std::strcmp((const char*) buffer, "123") == 0);
+
+    std::mt19937_64 random(1);
+    for(v_int32 i = 0; i < 100000; i ++) {
+      v_int64 value = (v_int64) (random() >> (random() % 64));
+      if(i % 2 == 1) value = -value;
+      bool success;
+      OATPP_ASSERT(conversion::strToInt64(conversion::int64ToStr(value), success) == value && success);
+      char expected[32];
+      snprintf(expected, 32, "%lld", (long long) value);
+      OATPP_ASSERT(conversion::int64ToStr(value) == expected);
+    }
+
+    bool success;
+    OATPP_ASSERT(conversion::strToInt64("  +15", success) == 15 && success);
+    OATPP_ASSERT(conversion::strToInt64("99999999999999999999", success) == INT64_MAX && success);
+    OATPP_ASSERT(conversion::strToInt64("-99999999999999999999", success) == INT64_MIN && success);
+    OATPP_ASSERT(conversion::strToUInt64("18446744073709551616", success) == UINT64_MAX && success);
+    OATPP_ASSERT(conversion::strToUInt32("-1", success) == 4294967295U && success);
+    conversion::strToInt32("12a", success);
+    OATPP_ASSERT(!success);
+
+    v_int64 value;
+    OATPP_ASSERT(conversion::parseInt64("-", 1, value) == 0);
+    OATPP_ASSERT(conversion::parseInt64("123", 2, value) == 2 && value == 12);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test float formatting...");
+
+    OATPP_ASSERT(formatFloat64(0.0) == "0");
+    OATPP_ASSERT(formatFloat64(-0.0) == "-0");
+    OATPP_ASSERT(formatFloat64(1.0) == "1");
+    OATPP_ASSERT(formatFloat64(-2.5) == "-2.5");
+    OATPP_ASSERT(formatFloat64(0.1) == "0.1");
+    OATPP_ASSERT(formatFloat64(0.1 + 0.2) == "0.30000000000000004");
+    OATPP_ASSERT(formatFloat64(100) == "100");
+    OATPP_ASSERT(formatFloat64(1e15) == "1000000000000000");
+    OATPP_ASSERT(formatFloat64(1e16) == "1e+16");
+    OATPP_ASSERT(formatFloat64(1.5e300) == "1.5e+300");
+    OATPP_ASSERT(formatFloat64(0.0001) == "0.0001");
+    OATPP_ASSERT(formatFloat64(0.00001) == "1e-05");
+    OATPP_ASSERT(formatFloat64(5e-324) == "5e-324");
+    OATPP_ASSERT(formatFloat64(1.7976931348623157e308) == "1.7976931348623157e+308");
+    OATPP_ASSERT(formatFloat64(std::numeric_limits<v_float64>::infinity()) == "inf");
+    OATPP_ASSERT(formatFloat64(-std::numeric_limits<v_float64>::infinity()) == "-inf");
+    OATPP_ASSERT(formatFloat64(std::numeric_limits<v_float64>::quiet_NaN()) == "nan");
+
+    OATPP_ASSERT(formatFloat32(0.32f) == "0.32");
+    OATPP_ASSERT(formatFloat32(16777216.0f) == "16777216");
+    OATPP_ASSERT(formatFloat32(1e-45f) == "1e-45");
+    OATPP_ASSERT(formatFloat32(3.4028235e38f) == "3.4028235e+38");
+
+    OATPP_ASSERT(conversion::float64ToStr(0.5, "%.3f") == "0.500");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test float parsing...");
+
+    OATPP_ASSERT(parseFloat64("0") == 0.0);
+    OATPP_ASSERT(sameBits(parseFloat64("-0"), -0.0));
+    OATPP_ASSERT(parseFloat64("1.5") == 1.5);
+    OATPP_ASSERT(parseFloat64("-1.5E3") == -1500.0);
+    OATPP_ASSERT(parseFloat64(".25") == 0.25);
+    OATPP_ASSERT(parseFloat64("1.") == 1.0);
+    OATPP_ASSERT(parseFloat64("9007199254740993") == 9007199254740992.0);
+    OATPP_ASSERT(parseFloat64("2.2250738585072011e-308") == 2.2250738585072011e-308);
+    OATPP_ASSERT(parseFloat64("4.9406564584124654e-324") == 5e-324);
+    OATPP_ASSERT(parseFloat64("1e-400") == 0.0);
+    OATPP_ASSERT(parseFloat64("1e400") == std::numeric_limits<v_float64>::infinity());
+    OATPP_ASSERT(parseFloat64("0.1000000000000000055511151231257827021181583404541015625") == 0.1);
+    OATPP_ASSERT(parseFloat64("179769313486231580793728971405303415079934132710037826936173778980444968292764750946649017977587207096330286416692887910946555547851940402630657488671505820681908902000708383676273854845817711531764475730270069855571366959622842914819860834936475292719074168444365510704342711559699508093042880177904174497791.9999999999999999999999999999999999999999999999999999999999999999999999") == 1.7976931348623157e308);
+    OATPP_ASSERT(parseFloat32("0.32") == 0.32f);
+    OATPP_ASSERT(parseFloat32("1.00000017881393432617187499") == 1.0000001f);
+    OATPP_ASSERT(parseFloat32("7.038531e-26") == 7.038531e-26f);
+
+    v_float64 result;
+    OATPP_ASSERT(conversion::parseFloat64("12.5,", 5, result) == 4 && result == 12.5);
+    OATPP_ASSERT(conversion::parseFloat64("1e+", 3, result) == 1 && result == 1.0);
+    OATPP_ASSERT(conversion::parseFloat64("-", 1, result) == 0);
+    OATPP_ASSERT(conversion::parseFloat64(".", 1, result) == 0);
+    OATPP_ASSERT(conversion::parseFloat64("inf", 3, result) == 3 && result == std::numeric_limits<v_float64>::infinity());
+
+    bool success;
+    OATPP_ASSERT(conversion::strToFloat64("3.25", success) == 3.25 && success);
+    conversion::strToFloat64("3.25x", success);
+    OATPP_ASSERT(!success);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test float64 round-trip...");
+
+    std::mt19937_64 random(2);
+    for(v_int32 i = 0; i < 200000; i ++) {
+      v_uint64 bits = random();
+      v_float64 value;
+      std::memcpy(&value, &bits, sizeof(value));
+      if(value != value || value - value != 0) continue;
+      auto text = formatFloat64(value);
+      OATPP_ASSERT(sameBits(parseFloat64(text), value));
+      OATPP_ASSERT(std::strtod(text.c_str(), nullptr) == value);
+      if(i % 16 == 0) {
+        OATPP_ASSERT(countDigits(text) <= shortestPrintfDigits(value));
+      }
+      char exact[64];
+      snprintf(exact, 64, "%.17g", value);
+      OATPP_ASSERT(sameBits(parseFloat64(exact), value));
+    }
+
+    for(v_int32 i = 0; i < 200000; i ++) {
+      v_float64 value = (v_float64)(random() % 100000000) / 1000.0;
+      auto text = formatFloat64(value);
+      OATPP_ASSERT(parseFloat64(text) == value);
+      OATPP_ASSERT(countDigits(text) <= shortestPrintfDigits(value));
+    }
+  }
+
+  {
+    OATPP_LOGI(TAG, "Test float32 round-trip...");
+
+    std::mt19937 random(3);
+    for(v_int32 i = 0; i < 200000; i ++) {
+      v_uint32 bits = random();
+      v_float32 value;
+      std::memcpy(&value, &bits, sizeof(value));
+      if(value != value || value - value != 0) continue;
+      auto text = formatFloat32(value);
+      OATPP_ASSERT(parseFloat32(text) == value);
+      OATPP_ASSERT(std::strtof(text.c_str(), nullptr) == value);
+      if(i % 16 == 0) {
+        OATPP_ASSERT(countDigits(text) <= shortestPrintfDigits(value));
+      }
+      char exact[64];
+      snprintf(exact, 64, "%.9g", (double) value);
+      OATPP_ASSERT(parseFloat32(exact) == value);
+    }
+  }
+
+}
+
+}}}}
@@ -0,0 +1,229 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "MultiAcceptorServerTest.hpp"
+
+#include "oatpp/web/server/AsyncHttpConnectionHandler.hpp"
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+
+#include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/network/tcp/client/ConnectionProvider.hpp"
+#include "oatpp/network/Server.hpp"
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace test { namespace network {
+
+namespace {
+
+const char* const REQUEST =
+  "GET /hello HTTP/1.1\r\n"
+  "Connection: close\r\n"
+  "\r\n";
+
+class Handler : public oatpp::web::server::HttpRequestHandler {
+public:
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest>& request) override {
+    return oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(Status::CODE_200, "Hello");
+  }
+
+  oatpp::async::CoroutineStarterForResult<const std::shared_ptr<OutgoingResponse>&>
+  handleAsync(const std::shared_ptr<IncomingRequest>& request) override {
+
+    class HandlerCoroutine : public oatpp::async::CoroutineWithResult<HandlerCoroutine, const std::shared_ptr<OutgoingResponse>&> {
+    public:
+      Action act() override {
+        return _return(oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(Status::CODE_200, "Hello"));
+      }
+    };
+
+    return HandlerCoroutine::startForResult();
+
+  }
+
+};
+
+/* Counts connections accepted by each acceptor */
+class CountingHandler : public oatpp::network::ConnectionHandler {
+private:
+  std::shared_ptr<oatpp::network::ConnectionHandler> m_handler;
+public:
+  std::atomic<v_int32> count;
+public:
+
+  CountingHandler(const std::shared_ptr<oatpp::network::ConnectionHandler>& handler)
+    : m_handler(handler)
+    , count(0)
+  {}
+
+  void handleConnection(const provider::ResourceHandle<data::stream::IOStream>& connection,
+                        const std::shared_ptr<const ParameterMap>& params) override
+  {
+    count ++;
+    m_handler->handleConnection(connection, params);
+  }
+
+  void stop() override {
+    m_handler->stop();
+  }
+
+};
+
+void runClients(v_uint16 port, v_int32 connectionsCount) {
+
+  auto clientProvider = oatpp::network::tcp::client::ConnectionProvider::createShared({"localhost", port});
+
+  for(v_int32 i = 0; i < connectionsCount; i ++) {
+
+    auto connection = clientProvider->get();
+    OATPP_ASSERT(connection);
+    connection.object->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+    connection.object->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+
+    connection.object->writeExactSizeDataSimple(REQUEST, std::strlen(REQUEST));
+
+    oatpp::data::stream::BufferOutputStream response;
+    v_char8 buffer[256];
+    while(true) {
+      auto res = connection.object->readSimple(buffer, 256);
+      if(res <= 0) {
+        break;
+      }
+      response.writeSimple(buffer, res);
+    }
+
+    auto text = response.toString();
+    OATPP_ASSERT(text->find("HTTP/1.1 200 OK") == 0);
+    OATPP_ASSERT(text->find("\r\n\r\nHello") != std::string::npos);
+
+  }
+
+}
+
+void checkServer(oatpp::network::Server& server,
+                 const std::vector<std::shared_ptr<CountingHandler>>& handlers,
+                 v_uint16 port)
+{
+
+  std::thread serverThread([&server] {
+    server.run();
+  });
+
+  const v_int32 connectionsCount = 200;
+  runClients(port, connectionsCount);
+
+  server.stop();
+  serverThread.join();
+
+  v_int32 total = 0;
+  v_int32 busyAcceptors = 0;
+  for(auto& handler : handlers) {
+    total += handler->count.load();
+    if(handler->count.load() > 0) {
+      busyAcceptors ++;
+    }
+    handler->stop();
+  }
+
+  OATPP_LOGD("MultiAcceptorServerTest", "acceptors=%d, busy acceptors=%d", server.getAcceptorsCount(), busyAcceptors);
+  OATPP_ASSERT(total == connectionsCount);
+  OATPP_ASSERT(busyAcceptors > 1);
+
+}
+
+}
+
+void MultiAcceptorServerTest::onRun() {
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  router->route("GET", "/hello", std::make_shared<Handler>());
+
+  const v_int32 acceptorsCount = 4;
+
+  {
+
+    OATPP_LOGI(TAG, "Simple API. One connection handler shared between acceptors.");
+
+    oatpp::network::tcp::server::ConnectionProvider::Config config;
+    config.reusePort = true;
+
+    std::vector<std::shared_ptr<oatpp::network::ConnectionProvider>> providers;
+    std::vector<std::shared_ptr<oatpp::network::ConnectionHandler>> handlers;
+    std::vector<std::shared_ptr<CountingHandler>> countingHandlers;
+
+    auto connectionHandler = oatpp::web::server::HttpConnectionHandler::createShared(router);
+    for(v_int32 i = 0; i < acceptorsCount; i ++) {
+      providers.push_back(oatpp::network::tcp::server::ConnectionProvider::createShared({"localhost", m_port}, config));
+      auto handler = std::make_shared<CountingHandler>(connectionHandler);
+      countingHandlers.push_back(handler);
+      handlers.push_back(handler);
+    }
+
+    oatpp::network::Server server(providers, handlers);
+    checkServer(server, countingHandlers, m_port);
+
+  }
+
+  {
+
+    OATPP_LOGI(TAG, "Async API. Each acceptor has its own executor.");
+
+    oatpp::network::tcp::server::ConnectionProvider::Config config;
+    config.reusePort = true;
+    config.acceptedConnectionsIOMode = oatpp::data::stream::IOMode::ASYNCHRONOUS;
+
+    std::vector<std::shared_ptr<oatpp::network::ConnectionProvider>> providers;
+    std::vector<std::shared_ptr<oatpp::network::ConnectionHandler>> handlers;
+    std::vector<std::shared_ptr<CountingHandler>> countingHandlers;
+    std::vector<std::shared_ptr<oatpp::async::Executor>> executors;
+
+    for(v_int32 i = 0; i < acceptorsCount; i ++) {
+      auto executor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+      executors.push_back(executor);
+      providers.push_back(oatpp::network::tcp::server::ConnectionProvider::createShared({"localhost", m_port}, config));
+      auto handler = std::make_shared<CountingHandler>(oatpp::web::server::AsyncHttpConnectionHandler::createShared(router, executor));
+      countingHandlers.push_back(handler);
+      handlers.push_back(handler);
+    }
+
+    oatpp::network::Server server(providers, handlers);
+    checkServer(server, countingHandlers, m_port);
+
+    for(auto& executor : executors) {
+      executor->waitTasksFinished();
+      executor->stop();
+      executor->join();
+    }
+
+  }
+
+#endif
+
+}
+
+}}}
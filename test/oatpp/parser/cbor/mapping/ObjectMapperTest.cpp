@@ -0,0 +1,396 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ObjectMapperTest.hpp"
+
+#include "oatpp/parser/cbor/mapping/ObjectMapper.hpp"
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace oatpp { namespace test { namespace parser { namespace cbor { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+ENUM(Color, v_int32,
+  VALUE(RED, 1, "red"),
+  VALUE(GREEN, 2, "green")
+)
+
+class InnerDto : public oatpp::DTO {
+
+  DTO_INIT(InnerDto, DTO)
+
+  DTO_FIELD(String, name);
+  DTO_FIELD(Int32, value);
+
+};
+
+class TestDto : public oatpp::DTO {
+
+  DTO_INIT(TestDto, DTO)
+
+  DTO_FIELD(String, str);
+  DTO_FIELD(Int8, i8);
+  DTO_FIELD(UInt8, u8);
+  DTO_FIELD(Int16, i16);
+  DTO_FIELD(UInt16, u16);
+  DTO_FIELD(Int32, i32);
+  DTO_FIELD(UInt32, u32);
+  DTO_FIELD(Int64, i64);
+  DTO_FIELD(UInt64, u64);
+  DTO_FIELD(Float32, f32);
+  DTO_FIELD(Float64, f64);
+  DTO_FIELD(Boolean, flag);
+  DTO_FIELD(Inline<Int32>, inlineI32);
+  DTO_FIELD(Enum<Color>::AsString, color);
+  DTO_FIELD(Enum<Color>::AsNumber, colorNumber);
+  DTO_FIELD(Object<InnerDto>, inner);
+  DTO_FIELD(List<Object<InnerDto>>, list);
+  DTO_FIELD(Vector<Inline<Float64>>, series);
+  DTO_FIELD(Fields<String>, fields);
+  DTO_FIELD(UnorderedFields<Int32>, unorderedFields);
+  DTO_FIELD(UnorderedSet<String>, set);
+  DTO_FIELD(Any, any);
+  DTO_FIELD(String, nullStr);
+
+};
+
+class SmallDto : public oatpp::DTO {
+
+  DTO_INIT(SmallDto, DTO)
+
+  DTO_FIELD(Int32, i32);
+  DTO_FIELD(String, str);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+oatpp::String toHex(const oatpp::String& data) {
+  static const char* digits = "0123456789abcdef";
+  std::string result;
+  for(auto c : *data) {
+    result.push_back(digits[((v_uint8) c) >> 4]);
+    result.push_back(digits[((v_uint8) c) & 0x0f]);
+  }
+  return result;
+}
+
+oatpp::String fromHex(const char* hex) {
+  std::string result;
+  for(v_buff_size i = 0; hex[i] != 0 && hex[i + 1] != 0; i += 2) {
+    result.push_back((char) std::stoi(std::string(hex + i, 2), nullptr, 16));
+  }
+  return result;
+}
+
+oatpp::Object<TestDto> createTestDto() {
+
+  auto dto = TestDto::createShared();
+
+  dto->str = "Hello CBOR \xe2\x9c\x93";
+  dto->i8 = -128;
+  dto->u8 = 255;
+  dto->i16 = -32768;
+  dto->u16 = 65535;
+  dto->i32 = std::numeric_limits<v_int32>::min();
+  dto->u32 = std::numeric_limits<v_uint32>::max();
+  dto->i64 = std::numeric_limits<v_int64>::min();
+  dto->u64 = std::numeric_limits<v_uint64>::max();
+  dto->f32 = 0.1f;
+  dto->f64 = 0.1;
+  dto->flag = false;
+  dto->inlineI32 = 42;
+  dto->color = Color::GREEN;
+  dto->colorNumber = Color::RED;
+
+  dto->inner = InnerDto::createShared();
+  dto->inner->name = "inner";
+  dto->inner->value = 1;
+
+  dto->list = oatpp::List<oatpp::Object<InnerDto>>::createShared();
+  for(v_int32 i = 0; i < 30; i ++) {
+    auto item = InnerDto::createShared();
+    item->name = "item-" + std::to_string(i);
+    item->value = i * 1000;
+    dto->list->push_back(item);
+  }
+
+  dto->series = {1.5, nullptr, -2.25, 1e300};
+  dto->fields = {{"k1", "v1"}, {"k2", nullptr}};
+  dto->unorderedFields = {{"a", 1}, {"b", -1}};
+  dto->set = {"x", "y"};
+  dto->any = oatpp::List<oatpp::Int32>({1, 2, 3});
+
+  return dto;
+
+}
+
+void checkTestDto(const oatpp::Object<TestDto>& dto) {
+
+  OATPP_ASSERT(dto);
+  OATPP_ASSERT(dto->str == "Hello CBOR \xe2\x9c\x93");
+  OATPP_ASSERT(dto->i8 == -128);
+  OATPP_ASSERT(dto->u8 == 255);
+  OATPP_ASSERT(dto->i16 == -32768);
+  OATPP_ASSERT(dto->u16 == 65535);
+  OATPP_ASSERT(dto->i32 == std::numeric_limits<v_int32>::min());
+  OATPP_ASSERT(dto->u32 == std::numeric_limits<v_uint32>::max());
+  OATPP_ASSERT(dto->i64 == std::numeric_limits<v_int64>::min());
+  OATPP_ASSERT(dto->u64 == std::numeric_limits<v_uint64>::max());
+  OATPP_ASSERT(dto->f32 == 0.1f);
+  OATPP_ASSERT(dto->f64 == 0.1);
+  OATPP_ASSERT(dto->flag == false);
+  OATPP_ASSERT(dto->inlineI32.hasValue() && *dto->inlineI32 == 42);
+  OATPP_ASSERT(dto->color == Color::GREEN);
+  OATPP_ASSERT(dto->colorNumber == Color::RED);
+
+  OATPP_ASSERT(dto->inner && dto->inner->name == "inner" && dto->inner->value == 1);
+
+  OATPP_ASSERT(dto->list && dto->list->size() == 30);
+  v_int32 i = 0;
+  for(auto& item : *dto->list) {
+    OATPP_ASSERT(item->name == oatpp::String("item-" + std::to_string(i)));
+    OATPP_ASSERT(item->value == i * 1000);
+    i ++;
+  }
+
+  OATPP_ASSERT(dto->series && dto->series->size() == 4);
+  OATPP_ASSERT(*dto->series->front() == 1.5);
+  OATPP_ASSERT(!dto->series[1].hasValue());
+  OATPP_ASSERT(*dto->series[2] == -2.25);
+  OATPP_ASSERT(*dto->series[3] == 1e300);
+
+  OATPP_ASSERT(dto->fields && dto->fields->size() == 2);
+  OATPP_ASSERT(dto->fields->front().first == "k1" && dto->fields->front().second == "v1");
+  OATPP_ASSERT(dto->fields->back().first == "k2" && dto->fields->back().second == nullptr);
+
+  OATPP_ASSERT(dto->unorderedFields && dto->unorderedFields->size() == 2);
+  OATPP_ASSERT(dto->unorderedFields["a"] == 1);
+  OATPP_ASSERT(dto->unorderedFields["b"] == -1);
+
+  OATPP_ASSERT(dto->set && dto->set->size() == 2);
+  OATPP_ASSERT(dto->set->find("x") != dto->set->end());
+  OATPP_ASSERT(dto->set->find("y") != dto->set->end());
+
+  OATPP_ASSERT(dto->any.getStoredType() == oatpp::List<oatpp::Any>::Class::getType());
+  auto anyList = dto->any.retrieve<oatpp::List<oatpp::Any>>();
+  OATPP_ASSERT(anyList->size() == 3);
+  OATPP_ASSERT(anyList->front().retrieve<oatpp::UInt64>() == 1);
+  OATPP_ASSERT(anyList->back().retrieve<oatpp::UInt64>() == 3);
+
+  OATPP_ASSERT(dto->nullStr == nullptr);
+
+}
+
+template<class Wrapper>
+void checkEncoding(const oatpp::parser::cbor::mapping::ObjectMapper& mapper, const Wrapper& value, const char* expectedHex) {
+  auto encoded = toHex(mapper.writeToString(value));
+  if(encoded != expectedHex) {
+    OATPP_LOGE("cbor::ObjectMapperTest", "expected '%s', got '%s'", expectedHex, encoded->c_str());
+  }
+  OATPP_ASSERT(encoded == expectedHex);
+}
+
+template<class Wrapper>
+bool readFails(const oatpp::parser::cbor::mapping::ObjectMapper& mapper, const char* hex) {
+  try {
+    mapper.readFromString<Wrapper>(fromHex(hex));
+  } catch (const oatpp::parser::ParsingError&) {
+    return true;
+  }
+  return false;
+}
+
+}
+
+void ObjectMapperTest::onRun() {
+
+  oatpp::parser::cbor::mapping::ObjectMapper mapper;
+
+  OATPP_ASSERT(std::string(mapper.getInfo().http_content_type) == "application/cbor");
+
+  {
+    OATPP_LOGI(TAG, "RFC 8949 Appendix A - encoding...");
+
+    checkEncoding(mapper, oatpp::UInt64((v_uint64) 0), "00");
+    checkEncoding(mapper, oatpp::UInt64(23), "17");
+    checkEncoding(mapper, oatpp::UInt64(24), "1818");
+    checkEncoding(mapper, oatpp::UInt64(100), "1864");
+    checkEncoding(mapper, oatpp::UInt64(1000), "1903e8");
+    checkEncoding(mapper, oatpp::UInt64(1000000), "1a000f4240");
+    checkEncoding(mapper, oatpp::UInt64(1000000000000), "1b000000e8d4a51000");
+    checkEncoding(mapper, oatpp::UInt64(std::numeric_limits<v_uint64>::max()), "1bffffffffffffffff");
+    checkEncoding(mapper, oatpp::Int64(std::numeric_limits<v_int64>::min()), "3b7fffffffffffffff");
+    checkEncoding(mapper, oatpp::Int32(-1), "20");
+    checkEncoding(mapper, oatpp::Int32(-10), "29");
+    checkEncoding(mapper, oatpp::Int8(-100), "3863");
+    checkEncoding(mapper, oatpp::Int16(-1000), "3903e7");
+
+    checkEncoding(mapper, oatpp::Float64(1.1), "fb3ff199999999999a");
+    checkEncoding(mapper, oatpp::Float64(100000.0), "fa47c35000");
+    checkEncoding(mapper, oatpp::Float64(3.4028234663852886e+38), "fa7f7fffff");
+    checkEncoding(mapper, oatpp::Float64(1.0e+300), "fb7e37e43c8800759c");
+    checkEncoding(mapper, oatpp::Float64(-4.1), "fbc010666666666666");
+    checkEncoding(mapper, oatpp::Float32(1.5f), "fa3fc00000");
+
+    checkEncoding(mapper, oatpp::Boolean(false), "f4");
+    checkEncoding(mapper, oatpp::Boolean(true), "f5");
+    checkEncoding(mapper, oatpp::String(nullptr), "f6");
+
+    checkEncoding(mapper, oatpp::String(""), "60");
+    checkEncoding(mapper, oatpp::String("a"), "6161");
+    checkEncoding(mapper, oatpp::String("IETF"), "6449455446");
+    checkEncoding(mapper, oatpp::String("\xc3\xbc"), "62c3bc");
+
+    checkEncoding(mapper, oatpp::List<oatpp::Int32>::createShared(), "80");
+    checkEncoding(mapper, oatpp::List<oatpp::Int32>({1, 2, 3}), "83010203");
+    checkEncoding(mapper, oatpp::Fields<oatpp::Int32>({{"a", 1}, {"b", 2}}), "a2616101616202");
+  }
+
+  {
+    OATPP_LOGI(TAG, "RFC 8949 Appendix A - decoding...");
+
+    OATPP_ASSERT(mapper.readFromString<oatpp::UInt64>(fromHex("1bffffffffffffffff")) == std::numeric_limits<v_uint64>::max());
+    OATPP_ASSERT(mapper.readFromString<oatpp::Int64>(fromHex("3903e7")) == -1000);
+
+    OATPP_ASSERT(mapper.readFromString<oatpp::Float64>(fromHex("f93c00")) == 1.0);
+    OATPP_ASSERT(mapper.readFromString<oatpp::Float64>(fromHex("f97bff")) == 65504.0);
+    OATPP_ASSERT(mapper.readFromString<oatpp::Float64>(fromHex("f9c400")) == -4.0);
+    OATPP_ASSERT(mapper.readFromString<oatpp::Float64>(fromHex("f90001")) == 5.960464477539063e-8);
+    OATPP_ASSERT(std::isinf(*mapper.readFromString<oatpp::Float64>(fromHex("f97c00"))));
+    OATPP_ASSERT(mapper.readFromString<oatpp::Float64>(fromHex("fb3ff199999999999a")) == 1.1);
+    OATPP_ASSERT(mapper.readFromString<oatpp::Float64>(fromHex("1864")) == 100.0);
+    OATPP_ASSERT(mapper.readFromString<oatpp::Float32>(fromHex("fa47c35000")) == 100000.0f);
+
+    // tags are ignored - tag 1 (epoch-based date/time)
+    OATPP_ASSERT(mapper.readFromString<oatpp::Int64>(fromHex("c11a514b67b0")) == 1363896240);
+
+    // indefinite-length string
+    OATPP_ASSERT(mapper.readFromString<oatpp::String>(fromHex("7f657374726561646d696e67ff")) == "streaming");
+
+    // [_ 1, [2, 3], [_ 4, 5]]
+    auto list = mapper.readFromString<oatpp::List<oatpp::Any>>(fromHex("9f018202039f0405ffff"));
+    OATPP_ASSERT(list->size() == 3);
+    OATPP_ASSERT(list->front().retrieve<oatpp::UInt64>() == 1);
+    OATPP_ASSERT(list[1].retrieve<oatpp::List<oatpp::Any>>()->size() == 2);
+    OATPP_ASSERT(list->back().retrieve<oatpp::List<oatpp::Any>>()->size() == 2);
+    OATPP_ASSERT(list->back().retrieve<oatpp::List<oatpp::Any>>()->back().retrieve<oatpp::UInt64>() == 5);
+
+    // {_ "a": 1, "b": [_ 2, 3]}
+    auto fields = mapper.readFromString<oatpp::Fields<oatpp::Any>>(fromHex("bf61610161629f0203ffff"));
+    OATPP_ASSERT(fields->size() == 2);
+    OATPP_ASSERT(fields["a"].retrieve<oatpp::UInt64>() == 1);
+    OATPP_ASSERT(fields["b"].retrieve<oatpp::List<oatpp::Any>>()->size() == 2);
+  }
+
+  {
+    OATPP_LOGI(TAG, "DTO round trip...");
+
+    auto dto = createTestDto();
+    auto data = mapper.writeToString(dto);
+    checkTestDto(mapper.readFromString<oatpp::Object<TestDto>>(data));
+
+    oatpp::parser::json::mapping::ObjectMapper jsonMapper;
+    auto json = jsonMapper.writeToString(dto);
+    OATPP_LOGD(TAG, "cbor size=%d, json size=%d", data->size(), json->size());
+    OATPP_ASSERT(data->size() < json->size());
+  }
+
+  {
+    OATPP_LOGI(TAG, "DTO round trip skipping null fields...");
+
+    auto serializerConfig = oatpp::parser::cbor::mapping::Serializer::Config::createShared();
+    serializerConfig->includeNullFields = false;
+    auto deserializerConfig = oatpp::parser::cbor::mapping::Deserializer::Config::createShared();
+    oatpp::parser::cbor::mapping::ObjectMapper skippingMapper(serializerConfig, deserializerConfig);
+
+    auto dto = createTestDto();
+    auto data = skippingMapper.writeToString(dto);
+    OATPP_ASSERT(skippingMapper.writeToString(TestDto::createShared()) == fromHex("bfff"));
+
+    auto result = mapper.readFromString<oatpp::Object<TestDto>>(data);
+    OATPP_ASSERT(result->series->size() == 3);
+    OATPP_ASSERT(result->fields->size() == 1);
+    result->series = dto->series;
+    result->fields = dto->fields;
+    checkTestDto(result);
+
+    checkEncoding(skippingMapper, oatpp::Fields<oatpp::Int32>({{"a", 1}, {"b", nullptr}}), "bf616101ff");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Unknown fields...");
+
+    oatpp::Fields<oatpp::Any> map = {
+      {"extra0", oatpp::String("abc")},
+      {"i32", oatpp::Int32(5)},
+      {"extra1", oatpp::List<oatpp::Any>({oatpp::Float64(1.1), oatpp::Fields<oatpp::Any>({{"x", oatpp::Boolean(true)}})})},
+      {"str", oatpp::String("s")}
+    };
+    auto data = mapper.writeToString(map);
+
+    auto dto = mapper.readFromString<oatpp::Object<SmallDto>>(data);
+    OATPP_ASSERT(dto->i32 == 5);
+    OATPP_ASSERT(dto->str == "s");
+
+    auto deserializerConfig = oatpp::parser::cbor::mapping::Deserializer::Config::createShared();
+    deserializerConfig->allowUnknownFields = false;
+    oatpp::parser::cbor::mapping::ObjectMapper strictMapper(oatpp::parser::cbor::mapping::Serializer::Config::createShared(), deserializerConfig);
+
+    bool failed = false;
+    try {
+      strictMapper.readFromString<oatpp::Object<SmallDto>>(data);
+    } catch (const oatpp::parser::ParsingError& e) {
+      failed = e.getCode() == oatpp::parser::cbor::mapping::Deserializer::ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD;
+    }
+    OATPP_ASSERT(failed);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Errors...");
+
+    OATPP_ASSERT(readFails<oatpp::Int32>(mapper, ""));
+    OATPP_ASSERT(readFails<oatpp::Int32>(mapper, "19"));           // truncated argument
+    OATPP_ASSERT(readFails<oatpp::Int32>(mapper, "6161"));         // string instead of integer
+    OATPP_ASSERT(readFails<oatpp::UInt32>(mapper, "20"));          // negative integer
+    OATPP_ASSERT(readFails<oatpp::Int32>(mapper, "1c"));           // reserved additional information
+    OATPP_ASSERT(readFails<oatpp::String>(mapper, "6561"));        // truncated string
+    OATPP_ASSERT(readFails<oatpp::List<oatpp::Int32>>(mapper, "830102"));   // truncated array
+    OATPP_ASSERT(readFails<oatpp::List<oatpp::Int32>>(mapper, "9f0102"));   // missing break
+    OATPP_ASSERT(readFails<oatpp::Fields<oatpp::Int32>>(mapper, "a10101")); // non-string key
+    OATPP_ASSERT(readFails<oatpp::Object<SmallDto>>(mapper, "a26369333201"));       // truncated object
+    OATPP_ASSERT(readFails<oatpp::Object<SmallDto>>(mapper, "a1616199999999"));    // truncated unknown field
+    OATPP_ASSERT(readFails<oatpp::Object<SmallDto>>(mapper, "83010203"));           // array instead of map
+  }
+
+}
+
+}}}}}
@@ -0,0 +1,117 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "UtilsTest.hpp"
+
+#include "oatpp/parser/json/Utils.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace test { namespace parser { namespace json {
+
+namespace {
+
+typedef oatpp::parser::json::Utils Utils;
+
+oatpp::String escape(const std::string& str, v_uint32 flags = Utils::FLAG_ESCAPE_ALL) {
+
+  auto result = Utils::escapeString(str.data(), str.size(), flags);
+
+  oatpp::data::stream::BufferOutputStream stream;
+  Utils::escapeStringToStream(&stream, str.data(), str.size(), flags);
+  OATPP_ASSERT(stream.toString() == result);
+
+  return result;
+
+}
+
+oatpp::String unescape(const oatpp::String& str) {
+  v_int64 errorCode;
+  v_buff_size errorPosition;
+  auto result = Utils::unescapeString(str->data(), str->size(), errorCode, errorPosition);
+  OATPP_ASSERT(errorCode == 0);
+  auto stdResult = Utils::unescapeStringToStdString(str->data(), str->size(), errorCode, errorPosition);
+  OATPP_ASSERT(errorCode == 0);
+  OATPP_ASSERT(result == stdResult);
+  return result;
+}
+
+}
+
+void UtilsTest::onRun() {
+
+  OATPP_LOGI(TAG, "Escape...");
+
+  OATPP_ASSERT(escape("") == "");
+  OATPP_ASSERT(escape("plain text") == "plain text");
+  OATPP_ASSERT(escape("a\"b\\c/d") == "a\\\"b\\\\c\\/d");
+  OATPP_ASSERT(escape("a/b", 0) == "a/b");
+  OATPP_ASSERT(escape("\b\f\n\r\t") == "\\b\\f\\n\\r\\t");
+  OATPP_ASSERT(escape(std::string("\x01\x1F", 2)) == "\\u0001\\u001F");
+  OATPP_ASSERT(escape("\xD0\x96") == "\\u0416");
+  OATPP_ASSERT(escape("\xF0\x9F\x98\x80") == "\\uD83D\\uDE00");
+  OATPP_ASSERT(escape("ab\xD0") == "ab??????");
+
+  OATPP_LOGI(TAG, "Escape at every position of long strings...");
+
+  const char* specials[] = {"\"", "\\", "/", "\n", "\x01", "\xD0\x96"};
+  const char* escaped[] = {"\\\"", "\\\\", "\\/", "\\n", "\\u0001", "\\u0416"};
+
+  for(v_int32 s = 0; s < 6; s ++) {
+    for(v_int32 pos = 0; pos < 70; pos ++) {
+
+      std::string text(pos, 'x');
+      text += specials[s];
+      text += std::string(70 - pos, 'y');
+
+      std::string expected(pos, 'x');
+      expected += escaped[s];
+      expected += std::string(70 - pos, 'y');
+
+      auto result = escape(text);
+      OATPP_ASSERT(result == expected);
+      OATPP_ASSERT(unescape(result) == text);
+
+    }
+  }
+
+  OATPP_LOGI(TAG, "Unescape...");
+
+  OATPP_ASSERT(unescape("plain text") == "plain text");
+  OATPP_ASSERT(unescape("a\\\"b\\\\c\\/d") == "a\"b\\c/d");
+  OATPP_ASSERT(unescape("\\u0416 \\uD83D\\uDE00") == "\xD0\x96 \xF0\x9F\x98\x80");
+
+  {
+    v_int64 errorCode;
+    v_buff_size errorPosition;
+    const char* invalid = "abcdef\\x";
+    Utils::unescapeString(invalid, 8, errorCode, errorPosition);
+    OATPP_ASSERT(errorCode == Utils::ERROR_CODE_INVALID_ESCAPED_CHAR);
+    OATPP_ASSERT(errorPosition == 6);
+  }
+
+  OATPP_LOGI(TAG, "OK");
+
+}
+
+}}}}
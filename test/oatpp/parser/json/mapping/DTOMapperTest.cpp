@@ -104,6 +104,15 @@ class TestAnyNested : public oatpp::DTO {
   DTO_FIELD(String, f2) = "Field_2";
 
 };
+
+class TestEscapedNames : public oatpp::DTO {
+
+  DTO_INIT(TestEscapedNames, DTO)
+
+  DTO_FIELD(Int32, f1, "a/b") = 1;
+  DTO_FIELD(Int32, f2, "q\"t") = 2;
+
+};
   
 #include OATPP_CODEGEN_END(DTO)
   
@@ -299,6 +308,22 @@ void DTOMapperTest::onRun(){
 
   }
 
+  {
+
+    auto plainMapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+    auto obj = TestEscapedNames::createShared();
+
+    auto json = plainMapper->writeToString(obj);
+    OATPP_LOGV(TAG, "escaped names json='%s'", json->c_str());
+    OATPP_ASSERT(json == "{\"a\\/b\":1,\"q\\\"t\":2}");
+
+    plainMapper->getSerializer()->getConfig()->escapeFlags = 0;
+    json = plainMapper->writeToString(obj);
+    OATPP_LOGV(TAG, "escaped names json='%s'", json->c_str());
+    OATPP_ASSERT(json == "{\"a/b\":1,\"q\\\"t\":2}");
+
+  }
+
 }
   
 #include OATPP_CODEGEN_END(DTO)
@@ -85,6 +85,18 @@ class AnyDto : public oatpp::DTO {
 
 };
 
+class FieldsOrderDto : public oatpp::DTO {
+
+  DTO_INIT(FieldsOrderDto, DTO)
+
+  DTO_FIELD(Int32, a);
+  DTO_FIELD(Int32, ab);
+  DTO_FIELD(Int32, abc);
+  DTO_FIELD(String, quoted, "q\"t");
+  DTO_FIELD(Int32, b);
+
+};
+
 #include OATPP_CODEGEN_END(DTO)
   
 }
@@ -240,6 +252,29 @@ void DeserializerTest::onRun(){
     OATPP_ASSERT(dto->any.retrieve<Int64>() == -1234567890);
   }
 
+  OATPP_LOGD(TAG, "Fields lookup")
+  for(v_int32 i = 0; i < 2; i ++) {
+
+    mapper->getDeserializer()->getConfig()->predictFieldsOrder = (i == 0);
+
+    auto dto = mapper->readFromString<oatpp::Object<FieldsOrderDto>>(R"({"a":1,"ab":2,"abc":3,"q\"t":"v","b":4})");
+    OATPP_ASSERT(dto);
+    OATPP_ASSERT(dto->a == 1 && dto->ab == 2 && dto->abc == 3 && dto->quoted == "v" && dto->b == 4);
+
+    dto = mapper->readFromString<oatpp::Object<FieldsOrderDto>>(R"({"b":4,"unknown":0,"abc":3,"\u0061b":2,"a":1,"ac":5})");
+    OATPP_ASSERT(dto);
+    OATPP_ASSERT(dto->a == 1 && dto->ab == 2 && dto->abc == 3 && !dto->quoted && dto->b == 4);
+
+  }
+
+  mapper->getDeserializer()->getConfig()->allowUnknownFields = false;
+  {
+    oatpp::parser::Caret caret(R"({"a":1,"abcd":2})");
+    auto dto = mapper->readFromCaret<oatpp::Object<FieldsOrderDto>>(caret);
+    OATPP_ASSERT(caret.hasError());
+    OATPP_ASSERT(caret.getErrorCode() == Deserializer::ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+  }
+
 }
   
 }}}}}
@@ -0,0 +1,177 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "NumbersPerfTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include "oatpp/core/macro/codegen.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <cstdlib>
+#include <random>
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Telemetry : public oatpp::DTO {
+
+  DTO_INIT(Telemetry, DTO)
+
+  DTO_FIELD(Int64, timestamp);
+  DTO_FIELD(Float64, latitude);
+  DTO_FIELD(Float64, longitude);
+  DTO_FIELD(Float32, temperature);
+  DTO_FIELD(List<Float64>, samples);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+}
+
+void NumbersPerfTest::onRun() {
+
+  v_int32 numIterations = 1000000;
+
+  std::mt19937_64 random(1);
+  std::uniform_real_distribution<v_float64> distribution(-1000.0, 1000.0);
+
+  std::vector<v_float64> values;
+  values.reserve(1000);
+  for(v_int32 i = 0; i < 1000; i ++) {
+    values.push_back(distribution(random));
+  }
+
+  std::vector<std::string> texts;
+  texts.reserve(values.size());
+  for(auto value : values) {
+    v_char8 buffer[32];
+    auto size = utils::conversion::float64ToCharSequence(value, buffer, 32);
+    texts.push_back(std::string((const char*) buffer, size));
+  }
+
+  v_float64 checksum = 0;
+  v_buff_size checksize = 0;
+
+  {
+    PerformanceChecker checker("float64 format - snprintf(\"%.17g\")");
+    char buffer[32];
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      checksize += snprintf(buffer, 32, "%.17g", values[i % values.size()]);
+    }
+  }
+
+  {
+    PerformanceChecker checker("float64 format - shortest round-trip");
+    v_char8 buffer[32];
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      checksize += utils::conversion::float64ToCharSequence(values[i % values.size()], buffer, 32);
+    }
+  }
+
+  {
+    PerformanceChecker checker("float64 parse - strtod");
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      checksum += std::strtod(texts[i % texts.size()].c_str(), nullptr);
+    }
+  }
+
+  {
+    PerformanceChecker checker("float64 parse - Eisel-Lemire");
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      const auto& text = texts[i % texts.size()];
+      v_float64 value;
+      utils::conversion::parseFloat64(text.data(), text.size(), value);
+      checksum += value;
+    }
+  }
+
+  {
+    PerformanceChecker checker("int64 format - snprintf(\"%lld\")");
+    char buffer[32];
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      checksize += snprintf(buffer, 32, "%lld", (long long) (i * 7919LL));
+    }
+  }
+
+  {
+    PerformanceChecker checker("int64 format - digit pairs");
+    v_char8 buffer[32];
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      checksize += utils::conversion::int64ToCharSequence(i * 7919LL, buffer, 32);
+    }
+  }
+
+  OATPP_LOGV(TAG, "checksum=%f, checksize=%d", checksum, checksize);
+
+  auto mapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+
+  auto dto = Telemetry::createShared();
+  dto->timestamp = 1700000000000;
+  dto->latitude = 50.4501;
+  dto->longitude = 30.5234;
+  dto->temperature = 21.7f;
+  dto->samples = oatpp::List<oatpp::Float64>::createShared();
+  for(v_int32 i = 0; i < 16; i ++) {
+    dto->samples->push_back(values[i]);
+  }
+
+  auto json = mapper->writeToString(dto);
+  OATPP_LOGV(TAG, "json='%s'", json->c_str());
+
+  auto parsed = mapper->readFromString<oatpp::Object<Telemetry>>(json);
+  OATPP_ASSERT(parsed->timestamp == dto->timestamp);
+  OATPP_ASSERT(parsed->latitude == dto->latitude);
+  OATPP_ASSERT(parsed->temperature == dto->temperature);
+  for(v_int32 i = 0; i < 16; i ++) {
+    OATPP_ASSERT(parsed->samples[i] == dto->samples[i]);
+  }
+
+  v_int32 numDtoIterations = 100000;
+
+  {
+    PerformanceChecker checker("Serializer - numbers DTO");
+    for(v_int32 i = 0; i < numDtoIterations; i ++) {
+      mapper->writeToString(dto);
+    }
+  }
+
+  {
+    PerformanceChecker checker("Deserializer - numbers DTO");
+    oatpp::parser::Caret caret(json);
+    for(v_int32 i = 0; i < numDtoIterations; i ++) {
+      caret.setPosition(0);
+      mapper->readFromCaret<oatpp::Object<Telemetry>>(caret);
+    }
+  }
+
+}
+
+}}}}}
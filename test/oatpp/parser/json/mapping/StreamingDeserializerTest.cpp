@@ -0,0 +1,250 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "StreamingDeserializerTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+typedef oatpp::parser::json::mapping::Deserializer Deserializer;
+
+ENUM(Color, v_int32,
+  VALUE(RED, 1, "red"),
+  VALUE(GREEN, 2, "green")
+);
+
+class ItemDto : public oatpp::DTO {
+
+  DTO_INIT(ItemDto, DTO)
+
+  DTO_FIELD(String, name);
+  DTO_FIELD(Float64, price);
+  DTO_FIELD(List<Int32>, tags);
+
+};
+
+class TypeADto : public oatpp::DTO {
+
+  DTO_INIT(TypeADto, DTO)
+
+  DTO_FIELD(String, fieldA);
+
+};
+
+class RootDto : public oatpp::DTO {
+
+  DTO_INIT(RootDto, DTO)
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(String, title);
+  DTO_FIELD(String, quoted, "q\"t");
+  DTO_FIELD(Boolean, flag);
+  DTO_FIELD(Enum<Color>::AsString, color);
+  DTO_FIELD(Object<ItemDto>, item);
+  DTO_FIELD(List<Object<ItemDto>>, items);
+  DTO_FIELD(Fields<List<Float32>>, map);
+  DTO_FIELD(Vector<Fields<String>>, nested);
+  DTO_FIELD(Any, any);
+  DTO_FIELD(String, type);
+  DTO_FIELD(Any, polymorph);
+
+  DTO_FIELD_TYPE_SELECTOR(polymorph) {
+    if(type == "A") return Object<TypeADto>::Class::getType();
+    if(type == "int") return Int32::Class::getType();
+    return Void::Class::getType();
+  }
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+const char* const JSON_DOC =
+  "{\n"
+  "  \"polymorph\": {\"fieldA\": \"value \\\"A\\\" {}[]\"},\n"
+  "  \"id\": -1234567890123,\n"
+  "  \"title\": \"Title with \\\\ escapes \\u0041 \\n and \\\"quotes\\\"\",\n"
+  "  \"q\\\"t\": \"quoted key\",\n"
+  "  \"unknown\": {\"a\": [1, 2, {\"b\": \"}]\"}], \"c\": null},\n"
+  "  \"flag\": true,\n"
+  "  \"color\": \"green\",\n"
+  "  \"item\": {\"name\": \"item-0\", \"price\": 1.25e-3, \"tags\": [1, -2, 300000]},\n"
+  "  \"items\": [{\"name\": \"item-1\", \"price\": 0.1}, null, {\"tags\": []}, {}],\n"
+  "  \"\\u006dap\": {\"k1\": [1.5, -2.25e10], \"k\\u0032\": [], \"k3\": null},\n"
+  "  \"nested\": [{\"a\": \"b\"}, {}, {\"c\": null}],\n"
+  "  \"any\": {\"x\": [1, \"two\", 3.5, false, null]},\n"
+  "  \"type\": \"A\"\n"
+  "}";
+
+oatpp::Void readChunked(oatpp::parser::json::mapping::ObjectMapper* mapper,
+                        const oatpp::data::mapping::type::Type* type,
+                        const oatpp::String& json,
+                        v_buff_size chunkSize,
+                        oatpp::String& errorMessage)
+{
+  auto reader = mapper->createReader(type);
+  const char* data = json->data();
+  v_buff_size size = json->size();
+  v_buff_size pos = 0;
+  while(pos < size) {
+    v_buff_size count = std::min(chunkSize, size - pos);
+    OATPP_ASSERT(reader->writeSimple(data + pos, count) == count);
+    pos += count;
+  }
+  auto result = reader->finish();
+  errorMessage = reader->hasError() ? reader->getErrorMessage() : nullptr;
+  return result;
+}
+
+template<class Wrapper>
+void checkSame(const std::shared_ptr<oatpp::parser::json::mapping::ObjectMapper>& mapper, const oatpp::String& json) {
+  auto expected = mapper->writeToString(mapper->readFromString<Wrapper>(json));
+  for(v_buff_size chunkSize = 1; chunkSize <= (v_buff_size) json->size(); chunkSize ++) {
+    oatpp::String error;
+    auto result = readChunked(mapper.get(), Wrapper::Class::getType(), json, chunkSize, error);
+    OATPP_ASSERT(!error);
+    OATPP_ASSERT(mapper->writeToString(result) == expected);
+  }
+}
+
+void checkError(const std::shared_ptr<oatpp::parser::json::mapping::ObjectMapper>& mapper,
+                const oatpp::data::mapping::type::Type* type,
+                const oatpp::String& json)
+{
+  for(v_buff_size chunkSize = 1; chunkSize <= (v_buff_size) json->size() + 1; chunkSize ++) {
+    oatpp::String error;
+    auto result = readChunked(mapper.get(), type, json, chunkSize, error);
+    OATPP_ASSERT(error);
+    OATPP_ASSERT(!result);
+  }
+}
+
+}
+
+void StreamingDeserializerTest::onRun() {
+
+  auto mapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+
+  OATPP_LOGD(TAG, "Document - all chunk sizes")
+  {
+    checkSame<oatpp::Object<RootDto>>(mapper, JSON_DOC);
+
+    oatpp::String error;
+    auto dto = readChunked(mapper.get(), oatpp::Object<RootDto>::Class::getType(), JSON_DOC, 7, error)
+      .cast<oatpp::Object<RootDto>>();
+    OATPP_ASSERT(dto);
+    OATPP_ASSERT(dto->id == -1234567890123);
+    OATPP_ASSERT(dto->title == "Title with \\ escapes A \n and \"quotes\"");
+    OATPP_ASSERT(dto->quoted == "quoted key");
+    OATPP_ASSERT(dto->flag == true);
+    OATPP_ASSERT(dto->color == Color::GREEN);
+    OATPP_ASSERT(dto->item->tags->size() == 3 && dto->item->tags[2] == 300000);
+    OATPP_ASSERT(dto->items->size() == 4 && dto->items[1] == nullptr);
+    OATPP_ASSERT(dto->map->size() == 3 && dto->map["k2"]->size() == 0 && dto->map["k3"] == nullptr);
+    OATPP_ASSERT(dto->nested->size() == 3);
+    OATPP_ASSERT(dto->polymorph.getStoredType() == oatpp::Object<TypeADto>::Class::getType());
+    OATPP_ASSERT(dto->polymorph.retrieve<oatpp::Object<TypeADto>>()->fieldA == "value \"A\" {}[]");
+  }
+
+  OATPP_LOGD(TAG, "Top-level values")
+  {
+    checkSame<oatpp::List<oatpp::Int32>>(mapper, "[1, 2, 3]");
+    checkSame<oatpp::List<oatpp::Int32>>(mapper, "[ ]");
+    checkSame<oatpp::Fields<oatpp::Any>>(mapper, R"({"a":1,"b":[true,"x"],"c":{"d":null}})");
+    checkSame<oatpp::Float64>(mapper, "-1.0000000000000002e-300");
+    checkSame<oatpp::String>(mapper, R"("abc\"def")");
+    checkSame<oatpp::Any>(mapper, R"([{"a":[1,2]},"b"])");
+
+    oatpp::String error;
+    auto result = readChunked(mapper.get(), oatpp::Object<RootDto>::Class::getType(), "null", 1, error);
+    OATPP_ASSERT(!error);
+    OATPP_ASSERT(!result);
+  }
+
+  OATPP_LOGD(TAG, "Polymorph with type selector field after")
+  {
+    checkSame<oatpp::Object<RootDto>>(mapper, R"({"polymorph":12,"type":"int"})");
+  }
+
+  OATPP_LOGD(TAG, "Fields order prediction off")
+  {
+    mapper->getDeserializer()->getConfig()->predictFieldsOrder = false;
+    checkSame<oatpp::Object<RootDto>>(mapper, JSON_DOC);
+    mapper->getDeserializer()->getConfig()->predictFieldsOrder = true;
+  }
+
+  OATPP_LOGD(TAG, "Errors")
+  {
+    checkError(mapper, oatpp::Object<RootDto>::Class::getType(), "");
+    checkError(mapper, oatpp::Object<RootDto>::Class::getType(), R"({"id":1)");
+    checkError(mapper, oatpp::Object<RootDto>::Class::getType(), R"({"id" 1})");
+    checkError(mapper, oatpp::Object<RootDto>::Class::getType(), R"({"id":"str"})");
+    checkError(mapper, oatpp::Object<RootDto>::Class::getType(), R"({"title":"unterminated)");
+    checkError(mapper, oatpp::Object<RootDto>::Class::getType(), R"({"unknown":{"a":1)");
+    checkError(mapper, oatpp::Object<RootDto>::Class::getType(), R"({"items":[{}, {})");
+    checkError(mapper, oatpp::Object<RootDto>::Class::getType(), R"({"color":"blue"})");
+    checkError(mapper, oatpp::List<oatpp::Int32>::Class::getType(), R"([1, 2, x])");
+  }
+
+  OATPP_LOGD(TAG, "Unknown fields not allowed")
+  {
+    mapper->getDeserializer()->getConfig()->allowUnknownFields = false;
+    auto reader = mapper->createReader(oatpp::Object<RootDto>::Class::getType());
+    reader->writeSimple(R"({"id":1,"idx":2})");
+    auto result = reader->finish();
+    OATPP_ASSERT(!result);
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == Deserializer::ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+    mapper->getDeserializer()->getConfig()->allowUnknownFields = true;
+  }
+
+  OATPP_LOGD(TAG, "readFromStream")
+  {
+    oatpp::String doc = JSON_DOC;
+    oatpp::data::stream::BufferInputStream stream(doc);
+    auto dto = mapper->readFromStream<oatpp::Object<RootDto>>(&stream);
+    OATPP_ASSERT(dto);
+    OATPP_ASSERT(mapper->writeToString(dto) == mapper->writeToString(mapper->readFromString<oatpp::Object<RootDto>>(JSON_DOC)));
+
+    oatpp::String badDoc = R"({"id":)";
+    oatpp::data::stream::BufferInputStream badStream(badDoc);
+    bool thrown = false;
+    try {
+      mapper->readFromStream<oatpp::Object<RootDto>>(&badStream);
+    } catch (const oatpp::parser::ParsingError&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+}
+
+}}}}}
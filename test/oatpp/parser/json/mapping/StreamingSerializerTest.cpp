@@ -0,0 +1,243 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "StreamingSerializerTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/web/protocol/http/outgoing/DtoBody.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+ENUM(Color, v_int32,
+  VALUE(RED, 1, "red"),
+  VALUE(GREEN, 2, "green")
+);
+
+class RowDto : public oatpp::DTO {
+
+  DTO_INIT(RowDto, DTO)
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(String, name);
+  DTO_FIELD(Float64, value);
+  DTO_FIELD(List<String>, tags);
+
+};
+
+class TypeADto : public oatpp::DTO {
+
+  DTO_INIT(TypeADto, DTO)
+
+  DTO_FIELD(String, fieldA) = "a \"quoted\" value";
+
+};
+
+class TableDto : public oatpp::DTO {
+
+  DTO_INIT(TableDto, DTO)
+
+  DTO_FIELD(String, title, "table \"title\"");
+  DTO_FIELD(Enum<Color>::AsString, color);
+  DTO_FIELD(Boolean, flag);
+  DTO_FIELD(String, nothing);
+  DTO_FIELD(List<Object<RowDto>>, rows);
+  DTO_FIELD(Fields<Vector<Int32>>, map);
+  DTO_FIELD(UnorderedSet<String>, set);
+  DTO_FIELD(Any, any);
+  DTO_FIELD(String, type);
+  DTO_FIELD(Any, polymorph);
+
+  DTO_FIELD_TYPE_SELECTOR(polymorph) {
+    if(type == "A") return Object<TypeADto>::Class::getType();
+    return String::Class::getType();
+  }
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+oatpp::Object<TableDto> createTable(v_int32 rowsCount) {
+
+  auto table = TableDto::createShared();
+  table->color = Color::GREEN;
+  table->flag = false;
+  table->rows = {};
+  for(v_int32 i = 0; i < rowsCount; i ++) {
+    auto row = RowDto::createShared();
+    row->id = i;
+    row->name = "row_" + oatpp::utils::conversion::int32ToStdStr(i);
+    row->value = i * 0.5;
+    if(i % 3 == 0) {
+      row->tags = {"a", nullptr, "c\n"};
+    }
+    table->rows->push_back(row);
+  }
+  table->rows->push_back(nullptr);
+  table->map = {{"k1", {1, 2, 3}}, {"k\"2", {}}, {"k3", nullptr}};
+  table->set = {"only"};
+  table->any = oatpp::List<oatpp::Any>({oatpp::Any(oatpp::String("str")), oatpp::Any(oatpp::Int32(1)), oatpp::Any(table->map)});
+  table->type = "A";
+  table->polymorph = TypeADto::createShared();
+
+  return table;
+
+}
+
+oatpp::String readAll(oatpp::data::stream::ReadCallback* callback, v_buff_size chunkSize) {
+  oatpp::data::stream::BufferOutputStream stream;
+  std::unique_ptr<v_char8[]> buffer(new v_char8[chunkSize]);
+  while(true) {
+    auto res = callback->readSimple(buffer.get(), chunkSize);
+    if(res <= 0) {
+      break;
+    }
+    OATPP_ASSERT(res <= chunkSize);
+    stream.writeSimple(buffer.get(), res);
+  }
+  return stream.toString();
+}
+
+void checkSame(const std::shared_ptr<oatpp::parser::json::mapping::ObjectMapper>& mapper, const oatpp::Void& dto) {
+  auto expected = mapper->writeToString(dto);
+  for(v_buff_size chunkSize : {1, 2, 3, 7, 16, 100, 4096}) {
+    auto writer = mapper->createWriter(dto);
+    OATPP_ASSERT(readAll(writer.get(), chunkSize) == expected);
+  }
+}
+
+}
+
+void StreamingSerializerTest::onRun() {
+
+  auto mapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+
+  OATPP_LOGD(TAG, "Same output as Serializer")
+  {
+    auto table = createTable(10);
+    checkSame(mapper, table);
+    checkSame(mapper, table->rows);
+    checkSame(mapper, table->map);
+    checkSame(mapper, table->any);
+    checkSame(mapper, oatpp::Object<TableDto>(nullptr));
+    checkSame(mapper, oatpp::String("plain \"string\""));
+    checkSame(mapper, oatpp::Float64(0.1));
+    checkSame(mapper, oatpp::List<oatpp::Int32>({}));
+  }
+
+  OATPP_LOGD(TAG, "Null values")
+  {
+    checkSame(mapper, oatpp::List<oatpp::Enum<Color>::AsString>({Color::RED, nullptr}));
+    checkSame(mapper, oatpp::Fields<oatpp::Enum<Color>::AsNumber>({{"color", nullptr}}));
+
+    /* NotNull constraint is checked for null values the same way Serializer does */
+    oatpp::Fields<oatpp::Enum<Color>::AsString::NotNull> map = {{"color", nullptr}};
+    oatpp::List<oatpp::Enum<Color>::AsNumber::NotNull> list = {Color::GREEN, nullptr};
+
+    for(const oatpp::Void& dto : {oatpp::Void(map), oatpp::Void(list)}) {
+
+      bool serializerError = false;
+      try {
+        mapper->writeToString(dto);
+      } catch (const std::runtime_error&) {
+        serializerError = true;
+      }
+
+      bool writerError = false;
+      try {
+        readAll(mapper->createWriter(dto).get(), 16);
+      } catch (const std::runtime_error&) {
+        writerError = true;
+      }
+
+      OATPP_ASSERT(serializerError);
+      OATPP_ASSERT(writerError);
+
+    }
+  }
+
+  OATPP_LOGD(TAG, "Config")
+  {
+    auto table = createTable(10);
+    auto config = mapper->getSerializer()->getConfig();
+
+    config->includeNullFields = false;
+    checkSame(mapper, table);
+
+    config->alwaysIncludeNullCollectionElements = true;
+    checkSame(mapper, table);
+    config->alwaysIncludeNullCollectionElements = false;
+    config->includeNullFields = true;
+
+    config->useBeautifier = true;
+    checkSame(mapper, table);
+    config->useBeautifier = false;
+  }
+
+  OATPP_LOGD(TAG, "Bounded buffering")
+  {
+    auto table = createTable(10000);
+    auto expected = mapper->writeToString(table);
+    auto writer = mapper->createWriter(table);
+    oatpp::data::stream::BufferOutputStream stream;
+    v_char8 buffer[1024];
+    while(true) {
+      auto res = writer->readSimple(buffer, 1024);
+      if(res <= 0) {
+        break;
+      }
+      stream.writeSimple(buffer, res);
+    }
+    OATPP_ASSERT(stream.toString() == expected);
+    OATPP_LOGD(TAG, "Serialized %d bytes in chunks of 1024", (v_int32) expected->size());
+  }
+
+  OATPP_LOGD(TAG, "DtoBody")
+  {
+    typedef oatpp::web::protocol::http::outgoing::DtoBody DtoBody;
+
+    auto table = createTable(100);
+    auto expected = mapper->writeToString(table);
+
+    auto body = DtoBody::createShared(mapper->createWriter(table), "application/json");
+    OATPP_ASSERT(body->getKnownSize() == (v_int64) expected->size());
+    OATPP_ASSERT(oatpp::String((const char*) body->getKnownData(), body->getKnownSize()) == expected);
+    OATPP_ASSERT(readAll(body.get(), 333) == expected);
+
+    body = DtoBody::createShared(mapper->createWriter(table), "application/json", 1000);
+    OATPP_ASSERT(body->getKnownSize() == -1);
+    OATPP_ASSERT(body->getKnownData() == nullptr);
+    OATPP_ASSERT(readAll(body.get(), 333) == expected);
+  }
+
+}
+
+}}}}}
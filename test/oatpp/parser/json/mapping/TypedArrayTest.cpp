@@ -0,0 +1,255 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "TypedArrayTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <random>
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class SeriesDto : public oatpp::DTO {
+
+  DTO_INIT(SeriesDto, DTO)
+
+  DTO_FIELD(Vector<Int8>, i8);
+  DTO_FIELD(Vector<UInt8>, u8);
+  DTO_FIELD(Vector<Int16>, i16);
+  DTO_FIELD(Vector<UInt16>, u16);
+  DTO_FIELD(Vector<Int32>, i32);
+  DTO_FIELD(Vector<UInt32>, u32);
+  DTO_FIELD(Vector<Int64>, i64);
+  DTO_FIELD(Vector<UInt64>, u64);
+  DTO_FIELD(Vector<Float32>, f32);
+  DTO_FIELD(Vector<Float64>, f64);
+  DTO_FIELD(Vector<Boolean>, flags);
+  DTO_FIELD(Vector<Inline<Float64>>, inlineF64);
+  DTO_FIELD(Vector<Inline<Int64>>, inlineI64);
+
+};
+
+/* Same fields but serialized through the generic collection path */
+class SeriesListDto : public oatpp::DTO {
+
+  DTO_INIT(SeriesListDto, DTO)
+
+  DTO_FIELD(List<Int8>, i8);
+  DTO_FIELD(List<UInt8>, u8);
+  DTO_FIELD(List<Int16>, i16);
+  DTO_FIELD(List<UInt16>, u16);
+  DTO_FIELD(List<Int32>, i32);
+  DTO_FIELD(List<UInt32>, u32);
+  DTO_FIELD(List<Int64>, i64);
+  DTO_FIELD(List<UInt64>, u64);
+  DTO_FIELD(List<Float32>, f32);
+  DTO_FIELD(List<Float64>, f64);
+  DTO_FIELD(List<Boolean>, flags);
+  DTO_FIELD(List<Float64>, inlineF64);
+  DTO_FIELD(List<Int64>, inlineI64);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+const char* const SERIES_JSON =
+  R"({"i8":[-128,127,null],"u8":[0,255],"i16":[-32768,32767],"u16":[65535],)"
+  R"("i32":[-2147483648,2147483647,0],"u32":[4294967295],"i64":[-9223372036854775807,9223372036854775807],)"
+  R"("u64":[18446744073709551615],"f32":[0.5,-1.25],"f64":[0.1,1e300,-2.5,null],"flags":[true,false,null],)"
+  R"("inlineF64":[3.14, null ,2.718],"inlineI64":[])"
+  R"(})";
+
+oatpp::String readAll(oatpp::data::stream::ReadCallback* callback, v_buff_size chunkSize) {
+  oatpp::data::stream::BufferOutputStream stream;
+  std::unique_ptr<v_char8[]> buffer(new v_char8[chunkSize]);
+  while(true) {
+    auto res = callback->readSimple(buffer.get(), chunkSize);
+    if(res <= 0) {
+      break;
+    }
+    stream.writeSimple(buffer.get(), res);
+  }
+  return stream.toString();
+}
+
+void serializeQuoted(oatpp::parser::json::mapping::Serializer* serializer,
+                     oatpp::data::stream::ConsistentOutputStream* stream,
+                     const oatpp::Void& polymorph)
+{
+  (void) serializer;
+  stream->writeCharSimple('"');
+  stream->writeAsString(* static_cast<v_int32*>(polymorph.get()));
+  stream->writeCharSimple('"');
+}
+
+}
+
+void TypedArrayTest::onRun() {
+
+  auto mapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+
+  {
+    OATPP_LOGI(TAG, "compare with generic collection path...");
+
+    auto series = mapper->readFromString<oatpp::Object<SeriesDto>>(SERIES_JSON);
+    auto seriesList = mapper->readFromString<oatpp::Object<SeriesListDto>>(SERIES_JSON);
+
+    OATPP_ASSERT(series->i8->size() == 3);
+    OATPP_ASSERT(series->i8[0] == -128 && series->i8[2] == nullptr);
+    OATPP_ASSERT(series->u64[0] == 18446744073709551615ULL);
+    OATPP_ASSERT(series->f64[1] == 1e300);
+    OATPP_ASSERT(series->flags[0] == true && series->flags[2] == nullptr);
+    OATPP_ASSERT(series->inlineF64->size() == 3);
+    OATPP_ASSERT(series->inlineF64[1] == nullptr);
+    OATPP_ASSERT(series->inlineF64[2] == 2.718);
+    OATPP_ASSERT(series->inlineI64->empty());
+
+    auto json = mapper->writeToString(series);
+    OATPP_LOGD(TAG, "json='%s'", json->c_str());
+    OATPP_ASSERT(json == mapper->writeToString(seriesList));
+
+    oatpp::data::stream::BufferInputStream stream(json);
+    auto streamed = mapper->readFromStream<oatpp::Object<SeriesDto>>(&stream);
+    OATPP_ASSERT(mapper->writeToString(streamed) == json);
+
+    auto writer = mapper->createWriter(series);
+    OATPP_ASSERT(readAll(writer.get(), 7) == json);
+
+    mapper->getSerializer()->getConfig()->includeNullFields = false;
+    json = mapper->writeToString(series);
+    OATPP_LOGD(TAG, "json='%s'", json->c_str());
+    OATPP_ASSERT(json == mapper->writeToString(seriesList));
+    OATPP_ASSERT(readAll(mapper->createWriter(series).get(), 7) == json);
+    mapper->getSerializer()->getConfig()->includeNullFields = true;
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "errors...");
+
+    const char* const docs[] = {
+      R"({"i32":[1,"2"]})",
+      R"({"i32":[1,2)",
+      R"({"flags":[yes]})",
+      R"({"inlineF64":[1.0,x]})"
+    };
+
+    for(auto doc : docs) {
+
+      bool thrown = false;
+      try {
+        mapper->readFromString<oatpp::Object<SeriesDto>>(doc);
+      } catch (const oatpp::parser::ParsingError&) {
+        thrown = true;
+      }
+      OATPP_ASSERT(thrown);
+
+      oatpp::String text = doc;
+      oatpp::data::stream::BufferInputStream stream(text);
+      thrown = false;
+      try {
+        mapper->readFromStream<oatpp::Object<SeriesDto>>(&stream);
+      } catch (const oatpp::parser::ParsingError&) {
+        thrown = true;
+      }
+      OATPP_ASSERT(thrown);
+
+    }
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "large arrays...");
+
+    const v_int32 count = 100000;
+    std::mt19937_64 random(1);
+    std::uniform_real_distribution<v_float64> distribution(-1000.0, 1000.0);
+
+    auto series = SeriesDto::createShared();
+    series->f64 = {};
+    series->inlineF64 = {};
+    series->f64->reserve(count);
+    series->inlineF64->reserve(count);
+    for(v_int32 i = 0; i < count; i ++) {
+      auto value = distribution(random);
+      series->f64->push_back(value);
+      series->inlineF64->push_back(value);
+    }
+
+    oatpp::String json;
+    {
+      oatpp::test::PerformanceChecker checker("serialize 2x10^5 numbers");
+      json = mapper->writeToString(series);
+    }
+    OATPP_ASSERT(readAll(mapper->createWriter(series).get(), 4096) == json);
+
+    oatpp::Object<SeriesDto> clone;
+    {
+      oatpp::test::PerformanceChecker checker("deserialize 2x10^5 numbers");
+      clone = mapper->readFromString<oatpp::Object<SeriesDto>>(json);
+    }
+    OATPP_ASSERT(clone->f64->size() == count);
+    OATPP_ASSERT(clone->inlineF64->size() == count);
+    for(v_int32 i = 0; i < count; i ++) {
+      OATPP_ASSERT(clone->f64[i] == *series->f64[i]);
+      OATPP_ASSERT(clone->inlineF64[i] == *series->inlineF64[i]);
+    }
+
+    oatpp::data::stream::BufferInputStream stream(json);
+    auto streamed = mapper->readFromStream<oatpp::Object<SeriesDto>>(&stream);
+    OATPP_ASSERT(mapper->writeToString(streamed) == json);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "custom item method disables fast path...");
+
+    auto customMapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+    customMapper->getSerializer()->getConfig()->includeNullFields = false;
+    customMapper->getSerializer()->setSerializerMethod(oatpp::Int32::Class::CLASS_ID, &serializeQuoted);
+
+    auto series = SeriesDto::createShared();
+    series->i32 = {1, 2};
+    auto json = customMapper->writeToString(series);
+    OATPP_ASSERT(json == oatpp::String(R"({"i32":["1","2"]})"));
+    OATPP_ASSERT(readAll(customMapper->createWriter(series).get(), 3) == json);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+}
+
+}}}}}
@@ -38,6 +38,7 @@
 #include "oatpp/web/server/HttpRouter.hpp"
 
 #include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/parser/cbor/mapping/ObjectMapper.hpp"
 
 #include "oatpp/network/tcp/server/ConnectionProvider.hpp"
 #include "oatpp/network/tcp/client/ConnectionProvider.hpp"
@@ -61,10 +62,12 @@ typedef oatpp::web::protocol::http::outgoing::MultipartBody MultipartBody;
 class TestComponent {
 private:
   v_uint16 m_port;
+  bool m_useWorkerPool;
 public:
 
-  TestComponent(v_uint16 port)
+  TestComponent(v_uint16 port, bool useWorkerPool)
     : m_port(port)
+    , m_useWorkerPool(useWorkerPool)
   {}
 
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([] {
@@ -90,8 +93,13 @@ public:
     return oatpp::web::server::HttpRouter::createShared();
   }());
 
-  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([] {
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([this] {
     OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router);
+    if(m_useWorkerPool) {
+      auto workerPoolConfig = std::make_shared<oatpp::web::server::HttpWorkerPool::Config>();
+      workerPoolConfig->workersCount = 4;
+      return oatpp::web::server::HttpConnectionHandler::createShared(router, workerPoolConfig);
+    }
     return oatpp::web::server::HttpConnectionHandler::createShared(router);
   }());
 
@@ -138,11 +146,14 @@ std::shared_ptr<PartList> createMultipart(const std::unordered_map<oatpp::String
   
 void FullTest::onRun() {
 
-  TestComponent component(m_port);
+  TestComponent component(m_port, m_useWorkerPool);
 
   oatpp::test::web::ClientServerTestRunner runner;
 
-  runner.addController(app::Controller::createShared());
+  auto controller = app::Controller::createShared();
+  controller->getContentMappers()->putMapper(oatpp::parser::cbor::mapping::ObjectMapper::createShared());
+
+  runner.addController(controller);
   runner.addController(app::ControllerWithInterceptors::createShared());
   runner.addController(app::ControllerWithErrorHandler::createShared());
   runner.addController(app::DefaultBasicAuthorizationController::createShared());
@@ -156,6 +167,7 @@ void FullTest::onRun() {
 
     auto requestExecutor = oatpp::web::client::HttpRequestExecutor::createShared(clientConnectionProvider);
     auto client = app::Client::createShared(requestExecutor, objectMapper);
+    auto cborClient = app::Client::createShared(requestExecutor, oatpp::parser::cbor::mapping::ObjectMapper::createShared());
 
     auto connection = client->getConnection();
     OATPP_ASSERT(connection);
@@ -313,6 +325,19 @@ void FullTest::onRun() {
         OATPP_ASSERT(dtoOut->testValueInt == i);
       }
 
+      { // test POST with dto body - mapper is selected by Content-Type
+        auto dtoIn = app::TestDto::createShared();
+        dtoIn->testValueInt = i;
+        dtoIn->testValue = "cbor";
+        auto response = cborClient->postBodyDto(dtoIn, connection);
+        OATPP_ASSERT(response->getStatusCode() == 200);
+        OATPP_ASSERT(response->getHeader("Content-Type") == "application/json");
+        auto dtoOut = response->readBodyToDto<oatpp::Object<app::TestDto>>(objectMapper.get());
+        OATPP_ASSERT(dtoOut);
+        OATPP_ASSERT(dtoOut->testValueInt == i);
+        OATPP_ASSERT(dtoOut->testValue == "cbor");
+      }
+
       { // test Enum as String
 
         OATPP_ASSERT(oatpp::Enum<app::AllowedPathParams>::getEntries().size() == 2);
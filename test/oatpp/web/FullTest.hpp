@@ -33,12 +33,14 @@ class FullTest : public UnitTest {
 private:
   v_uint16 m_port;
   v_int32 m_iterationsPerStep;
+  bool m_useWorkerPool;
 public:
   
-  FullTest(v_uint16 port, v_int32 iterationsPerStep)
+  FullTest(v_uint16 port, v_int32 iterationsPerStep, bool useWorkerPool = false)
     : UnitTest("TEST[web::FullTest]")
     , m_port(port)
     , m_iterationsPerStep(iterationsPerStep)
+    , m_useWorkerPool(useWorkerPool)
   {}
 
   void onRun() override;
@@ -50,10 +50,12 @@ namespace {
 class TestComponent {
 private:
   v_uint16 m_port;
+  bool m_useWorkerPool;
 public:
 
-  TestComponent(v_uint16 port)
+  TestComponent(v_uint16 port, bool useWorkerPool)
     : m_port(port)
+    , m_useWorkerPool(useWorkerPool)
   {}
 
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([] {
@@ -79,8 +81,13 @@ public:
     return oatpp::web::server::HttpRouter::createShared();
   }());
 
-  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([] {
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ConnectionHandler>, serverConnectionHandler)([this] {
     OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router);
+    if(m_useWorkerPool) {
+      auto workerPoolConfig = std::make_shared<oatpp::web::server::HttpWorkerPool::Config>();
+      workerPoolConfig->workersCount = 4;
+      return oatpp::web::server::HttpConnectionHandler::createShared(router, workerPoolConfig);
+    }
     return oatpp::web::server::HttpConnectionHandler::createShared(router);
   }());
 
@@ -123,7 +130,7 @@ const char* const SAMPLE_OUT =
 
 void PipelineTest::onRun() {
 
-  TestComponent component(m_port);
+  TestComponent component(m_port, m_useWorkerPool);
 
   oatpp::test::web::ClientServerTestRunner runner;
 
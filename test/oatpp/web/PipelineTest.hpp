@@ -33,12 +33,14 @@ class PipelineTest : public UnitTest {
 private:
   v_uint16 m_port;
   v_int32 m_pipelineSize;
+  bool m_useWorkerPool;
 public:
 
-  PipelineTest(v_uint16 port, v_int32 pipelineSize)
+  PipelineTest(v_uint16 port, v_int32 pipelineSize, bool useWorkerPool = false)
     : UnitTest("TEST[web::PipelineTest]")
     , m_port(port)
     , m_pipelineSize(pipelineSize)
+    , m_useWorkerPool(useWorkerPool)
   {}
 
   void onRun() override;
@@ -0,0 +1,80 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ContentMappersTest.hpp"
+
+#include "oatpp/web/mime/ContentMappers.hpp"
+#include "oatpp/parser/cbor/mapping/ObjectMapper.hpp"
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace mime {
+
+void ContentMappersTest::onRun() {
+
+  auto jsonMapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+  auto cborMapper = oatpp::parser::cbor::mapping::ObjectMapper::createShared();
+
+  {
+    OATPP_LOGI(TAG, "Empty...");
+    oatpp::web::mime::ContentMappers mappers;
+    OATPP_ASSERT(mappers.getDefaultMapper() == nullptr);
+    OATPP_ASSERT(mappers.selectMapperForContent("application/json") == nullptr);
+    OATPP_ASSERT(mappers.getMapper("application/json") == nullptr);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Select by content type...");
+
+    auto mappers = oatpp::web::mime::ContentMappers::createShared(jsonMapper);
+    mappers->putMapper(cborMapper);
+
+    OATPP_ASSERT(mappers->getDefaultMapper() == jsonMapper);
+    OATPP_ASSERT(mappers->getMapper("application/json") == jsonMapper);
+    OATPP_ASSERT(mappers->getMapper("application/cbor") == cborMapper);
+    OATPP_ASSERT(mappers->getMapper("text/plain") == nullptr);
+    OATPP_ASSERT(mappers->getMapper(nullptr) == nullptr);
+
+    OATPP_ASSERT(mappers->selectMapperForContent(nullptr) == jsonMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("") == jsonMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("application/json") == jsonMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("application/cbor") == cborMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("Application/CBOR") == cborMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent(" application/cbor ;charset=utf-8") == cborMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("application/json; charset=utf-8") == jsonMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("application/cbor-seq") == jsonMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("text/plain") == jsonMapper);
+
+    mappers->setDefaultMapper(cborMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("text/plain") == cborMapper);
+    OATPP_ASSERT(mappers->selectMapperForContent("application/json") == jsonMapper);
+
+    mappers->clear();
+    OATPP_ASSERT(mappers->getDefaultMapper() == nullptr);
+    OATPP_ASSERT(mappers->selectMapperForContent("application/cbor") == nullptr);
+  }
+
+}
+
+}}}}
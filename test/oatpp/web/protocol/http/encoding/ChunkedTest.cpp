@@ -29,6 +29,45 @@
 
 namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace encoding {
 
+namespace {
+
+class SlowReadCallback : public oatpp::data::stream::ReadCallback {
+public:
+
+  oatpp::data::stream::BufferInputStream stream;
+
+  SlowReadCallback(const oatpp::String& data)
+    : stream(data)
+  {}
+
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override {
+    return stream.read(buffer, count > 3 ? 3 : count, action);
+  }
+
+};
+
+oatpp::String decode(const oatpp::String& encoded, v_io_size& transferred) {
+  oatpp::data::stream::BufferInputStream inStream(encoded);
+  oatpp::data::stream::BufferOutputStream outStream;
+  oatpp::web::protocol::http::encoding::DecoderChunked decoder;
+  v_char8 buffer[64];
+  transferred = oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer, 64, &decoder);
+  return outStream.toString();
+}
+
+bool decodeFails(const oatpp::String& encoded) {
+  try {
+    v_io_size transferred;
+    decode(encoded, transferred);
+  } catch (const std::runtime_error& e) {
+    OATPP_LOGD("ChunkedTest", "decode error - %s", e.what());
+    return true;
+  }
+  return false;
+}
+
+}
+
 void ChunkedTest::onRun() {
 
   oatpp::String data = "Hello World!!!";
@@ -119,6 +158,89 @@ void ChunkedTest::onRun() {
     OATPP_ASSERT(result == data);
   }
 
+  { // Chunk framing
+    v_char8 header[oatpp::web::protocol::http::encoding::EncoderChunked::MAX_CHUNK_HEADER_SIZE];
+    auto size = oatpp::web::protocol::http::encoding::EncoderChunked::writeChunkHeader(header, 0x1A2B, false);
+    OATPP_ASSERT(oatpp::String((const char*) header, size) == "\r\n1A2B\r\n");
+    size = oatpp::web::protocol::http::encoding::EncoderChunked::writeChunkHeader(header, 0, true);
+    OATPP_ASSERT(oatpp::String((const char*) header, size) == "0\r\n\r\n");
+  }
+
+  { // Vectored transfer with prefix
+    oatpp::data::stream::BufferInputStream inStream(data);
+    oatpp::data::stream::BufferOutputStream outStream;
+
+    const v_int32 bufferSize = 5;
+    v_char8 buffer[bufferSize];
+
+    auto count = oatpp::web::protocol::http::encoding::EncoderChunked::transfer(&inStream, &outStream, "HEAD\r\n", 6, buffer, bufferSize);
+    auto result = outStream.toString();
+
+    OATPP_ASSERT(count == data->size());
+    OATPP_ASSERT(result == "HEAD\r\n5\r\nHello\r\n5\r\n Worl\r\n4\r\nd!!!\r\n0\r\n\r\n");
+  }
+
+  { // Vectored transfer - empty body
+    oatpp::data::stream::BufferInputStream inStream(oatpp::String(""));
+    oatpp::data::stream::BufferOutputStream outStream;
+
+    const v_int32 bufferSize = 5;
+    v_char8 buffer[bufferSize];
+
+    auto count = oatpp::web::protocol::http::encoding::EncoderChunked::transfer(&inStream, &outStream, nullptr, 0, buffer, bufferSize);
+
+    OATPP_ASSERT(count == 0);
+    OATPP_ASSERT(outStream.toString() == "0\r\n\r\n");
+  }
+
+  { // Vectored transfer - no coalescing
+    SlowReadCallback inStream(data);
+    oatpp::data::stream::BufferOutputStream outStream;
+
+    v_char8 buffer[64];
+
+    auto count = oatpp::web::protocol::http::encoding::EncoderChunked::transfer(&inStream, &outStream, nullptr, 0, buffer, 64);
+
+    OATPP_ASSERT(count == data->size());
+    OATPP_ASSERT(outStream.toString() == "3\r\nHel\r\n3\r\nlo \r\n3\r\nWor\r\n3\r\nld!\r\n2\r\n!!\r\n0\r\n\r\n");
+  }
+
+  { // Vectored transfer - coalescing
+    SlowReadCallback inStream(data);
+    oatpp::data::stream::BufferOutputStream outStream;
+
+    v_char8 buffer[64];
+
+    oatpp::web::protocol::http::encoding::EncoderChunked::Coalescing coalescing(8);
+    auto count = oatpp::web::protocol::http::encoding::EncoderChunked::transfer(&inStream, &outStream, nullptr, 0, buffer, 64, coalescing);
+
+    OATPP_ASSERT(count == data->size());
+    OATPP_ASSERT(outStream.toString() == "9\r\nHello Wor\r\n5\r\nld!!!\r\n0\r\n\r\n");
+  }
+
+  { // Decoder - chunk extensions and trailers
+    v_io_size count;
+    oatpp::String encoded = "5;name=value\r\nHello\r\n0009\r\n World!!!\r\n0\r\nTrailer: value\r\n\r\n";
+    auto result = decode(encoded, count);
+    OATPP_ASSERT(result == data);
+    OATPP_ASSERT(count == encoded->size());
+  }
+
+  { // Decoder - does not read past the end of body
+    oatpp::data::stream::BufferInputStream inStream(oatpp::String("5\r\nHello\r\n0\r\n\r\nGET / HTTP/1.1"));
+    oatpp::data::stream::BufferOutputStream outStream;
+    oatpp::web::protocol::http::encoding::DecoderChunked decoder;
+    v_char8 buffer[64];
+    oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer, 64, &decoder);
+    OATPP_ASSERT(outStream.toString() == "Hello");
+    OATPP_ASSERT(inStream.getCurrentPosition() == 15);
+  }
+
+  { // Decoder - malformed framing
+    OATPP_ASSERT(decodeFails("X\r\nHello\r\n0\r\n\r\n"));
+    OATPP_ASSERT(decodeFails("5\r\nHelloXX0\r\n\r\n"));
+    OATPP_ASSERT(decodeFails("FFFFFFFFFFFFFFFF\r\n"));
+  }
 
 }
 
@@ -0,0 +1,393 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "FileBodyTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/FileBody.hpp"
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+#include "oatpp/network/tcp/Connection.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/async/Executor.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <unistd.h>
+#include <signal.h>
+#include <thread>
+#endif
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::FileBody FileBody;
+typedef oatpp::web::protocol::http::Headers Headers;
+typedef oatpp::web::protocol::http::Header Header;
+typedef oatpp::web::protocol::http::Status Status;
+typedef oatpp::web::protocol::http::Range Range;
+typedef oatpp::web::protocol::http::outgoing::Response Response;
+typedef oatpp::web::protocol::http::outgoing::ResponseFactory ResponseFactory;
+
+const char* const FILE_NAME = "oatpp_FileBodyTest.tmp";
+const char* const FILE_DATA = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+oatpp::String readBody(FileBody& body) {
+  oatpp::data::stream::BufferOutputStream stream;
+  v_char8 buffer[7];
+  body.transfer(&stream, buffer, 7);
+  return stream.toString();
+}
+
+oatpp::String getHeader(FileBody& body, const char* name) {
+  Headers headers;
+  body.declareHeaders(headers);
+  return headers.get(name);
+}
+
+class TransferCoroutine : public oatpp::async::Coroutine<TransferCoroutine> {
+private:
+  std::shared_ptr<FileBody> m_body;
+  std::shared_ptr<oatpp::data::stream::OutputStream> m_stream;
+  bool* m_error;
+public:
+
+  TransferCoroutine(const std::shared_ptr<FileBody>& body,
+                    const std::shared_ptr<oatpp::data::stream::OutputStream>& stream,
+                    bool* error = nullptr)
+    : m_body(body)
+    , m_stream(stream)
+    , m_error(error)
+  {}
+
+  Action act() override {
+    return FileBody::transferAsync(m_body, m_stream).next(finish());
+  }
+
+  Action handleError(Error* error) override {
+    if(m_error) {
+      *m_error = true;
+      return finish();
+    }
+    return error;
+  }
+
+};
+
+class SendCoroutine : public oatpp::async::Coroutine<SendCoroutine> {
+private:
+  std::shared_ptr<Response> m_response;
+  std::shared_ptr<oatpp::data::stream::OutputStream> m_stream;
+public:
+
+  SendCoroutine(const std::shared_ptr<Response>& response, const std::shared_ptr<oatpp::data::stream::OutputStream>& stream)
+    : m_response(response)
+    , m_stream(stream)
+  {}
+
+  Action act() override {
+    auto headersWriteBuffer = std::make_shared<oatpp::data::stream::BufferOutputStream>();
+    return Response::sendAsync(m_response, m_stream, headersWriteBuffer, nullptr).next(finish());
+  }
+
+};
+
+template<class CoroutineType, class ... Args>
+void runCoroutine(Args... args) {
+  oatpp::async::Executor executor(1, 1, 1);
+  executor.execute<CoroutineType>(args...);
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+}
+
+void checkResponse(const oatpp::String& result) {
+  OATPP_ASSERT(result->find("HTTP/1.1 206") == 0);
+  OATPP_ASSERT(result->find("Content-Range: bytes 10-15/36\r\n") != std::string::npos);
+  OATPP_ASSERT(result->find("Content-Length: 6\r\n") != std::string::npos);
+  OATPP_ASSERT(result->substr(result->size() - 10) == "\r\n\r\nabcdef");
+}
+
+#if defined(__linux__)
+
+/*
+ * Connection to one end of a socket pair. Data written to the connection is read with `readAll(otherEnd)`.
+ */
+std::shared_ptr<oatpp::network::tcp::Connection> createConnection(int& otherEnd) {
+  int fds[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+  otherEnd = fds[1];
+  return std::make_shared<oatpp::network::tcp::Connection>(fds[0]);
+}
+
+oatpp::String readAll(int fd) {
+  oatpp::data::stream::BufferOutputStream stream;
+  char buffer[256];
+  while(true) {
+    auto res = ::read(fd, buffer, 256);
+    if(res <= 0) {
+      break;
+    }
+    stream.writeSimple(buffer, res);
+  }
+  ::close(fd);
+  return stream.toString();
+}
+
+#endif
+
+}
+
+void FileBodyTest::onRun() {
+
+  {
+    std::FILE* file = std::fopen(FILE_NAME, "wb");
+    OATPP_ASSERT(file);
+    std::fwrite(FILE_DATA, 1, std::strlen(FILE_DATA), file);
+    std::fclose(file);
+  }
+
+  { // whole file
+    FileBody body(FILE_NAME, "text/plain", nullptr);
+    OATPP_ASSERT(body.getKnownSize() == 36);
+    OATPP_ASSERT(body.getFileSize() == 36);
+    OATPP_ASSERT(body.getStatus().code == 200);
+    OATPP_ASSERT(getHeader(body, Header::CONTENT_TYPE) == "text/plain");
+    OATPP_ASSERT(getHeader(body, Header::ACCEPT_RANGES) == "bytes");
+    OATPP_ASSERT(getHeader(body, Header::CONTENT_RANGE) == nullptr);
+    OATPP_ASSERT(readBody(body) == FILE_DATA);
+  }
+
+  { // closed range
+    FileBody body(FILE_NAME, nullptr, "bytes=10-15");
+    OATPP_ASSERT(body.getKnownSize() == 6);
+    OATPP_ASSERT(body.getStatus().code == 206);
+    OATPP_ASSERT(getHeader(body, Header::CONTENT_RANGE) == "bytes 10-15/36");
+    OATPP_ASSERT(readBody(body) == "abcdef");
+  }
+
+  { // open-ended range
+    FileBody body(FILE_NAME, nullptr, "bytes=30-");
+    OATPP_ASSERT(body.getStatus().code == 206);
+    OATPP_ASSERT(getHeader(body, Header::CONTENT_RANGE) == "bytes 30-35/36");
+    OATPP_ASSERT(readBody(body) == "uvwxyz");
+  }
+
+  { // suffix range
+    FileBody body(FILE_NAME, nullptr, "bytes=-3");
+    OATPP_ASSERT(body.getStatus().code == 206);
+    OATPP_ASSERT(getHeader(body, Header::CONTENT_RANGE) == "bytes 33-35/36");
+    OATPP_ASSERT(readBody(body) == "xyz");
+  }
+
+  { // end past the end of file
+    FileBody body(FILE_NAME, nullptr, "bytes=34-100");
+    OATPP_ASSERT(body.getStatus().code == 206);
+    OATPP_ASSERT(readBody(body) == "yz");
+  }
+
+  { // unsatisfiable range
+    FileBody body(FILE_NAME, nullptr, "bytes=36-40");
+    OATPP_ASSERT(body.getKnownSize() == 0);
+    OATPP_ASSERT(body.getStatus().code == 416);
+    OATPP_ASSERT(getHeader(body, Header::CONTENT_RANGE) == "bytes */36");
+    OATPP_ASSERT(readBody(body) == "");
+  }
+
+  { // multiple ranges are not supported - whole file
+    FileBody body(FILE_NAME, nullptr, "bytes=0-1,5-6");
+    OATPP_ASSERT(body.getStatus().code == 200);
+    OATPP_ASSERT(readBody(body) == FILE_DATA);
+  }
+
+  { // Range::parse - omitted bounds are -1
+    auto range = Range::parse("bytes=10-15");
+    OATPP_ASSERT(range.isValid() && range.units == "bytes" && range.start == 10 && range.end == 15);
+    range = Range::parse("bytes=30-");
+    OATPP_ASSERT(range.isValid() && range.start == 30 && range.end == -1);
+    range = Range::parse("bytes=-3");
+    OATPP_ASSERT(range.isValid() && range.start == -1 && range.end == 3);
+    range = Range::parse("bytes=0-0");
+    OATPP_ASSERT(range.isValid() && range.start == 0 && range.end == 0);
+    OATPP_ASSERT(!Range::parse("bytes").isValid());
+  }
+
+  { // transferAsync - regular stream
+    auto body = FileBody::createShared(FILE_NAME, nullptr, "bytes=10-15");
+    auto stream = std::make_shared<oatpp::data::stream::BufferOutputStream>();
+    runCoroutine<TransferCoroutine>(body, stream);
+    OATPP_ASSERT(stream->toString() == "abcdef");
+  }
+
+  { // Response::send - regular stream
+    oatpp::data::stream::BufferOutputStream stream;
+    oatpp::data::stream::BufferOutputStream headersWriteBuffer;
+    ResponseFactory::createFileResponse(FILE_NAME, "bytes=10-15")->send(&stream, &headersWriteBuffer, nullptr);
+    checkResponse(stream.toString());
+  }
+
+  { // Response::sendAsync - regular stream
+    auto stream = std::make_shared<oatpp::data::stream::BufferOutputStream>();
+    runCoroutine<SendCoroutine>(ResponseFactory::createFileResponse(FILE_NAME, "bytes=10-15"), stream);
+    checkResponse(stream->toString());
+  }
+
+#if defined(__linux__)
+  { // sendfile to socket
+    int fds[2];
+    OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+    {
+      oatpp::network::tcp::Connection connection(fds[0]);
+      FileBody body(FILE_NAME, nullptr, "bytes=5-14");
+      v_char8 buffer[16];
+      OATPP_ASSERT(body.transfer(&connection, buffer, 16) == 10);
+    }
+
+    char result[16];
+    auto res = ::read(fds[1], result, 16);
+    ::close(fds[1]);
+    OATPP_ASSERT(res == 10);
+    OATPP_ASSERT(oatpp::String(result, res) == "56789abcde");
+  }
+
+  { // transferAsync - sendfile to socket
+    int otherEnd;
+    auto connection = createConnection(otherEnd);
+    connection->setOutputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+    runCoroutine<TransferCoroutine>(FileBody::createShared(FILE_NAME, nullptr, "bytes=5-14"), connection);
+    connection.reset();
+    OATPP_ASSERT(readAll(otherEnd) == "56789abcde");
+  }
+
+  { // Response::send - sendfile to socket
+    int otherEnd;
+    auto connection = createConnection(otherEnd);
+    oatpp::data::stream::BufferOutputStream headersWriteBuffer;
+    ResponseFactory::createFileResponse(FILE_NAME, "bytes=10-15")->send(connection.get(), &headersWriteBuffer, nullptr);
+    connection.reset();
+    checkResponse(readAll(otherEnd));
+  }
+
+  { // Response::sendAsync - sendfile to socket
+    int otherEnd;
+    auto connection = createConnection(otherEnd);
+    connection->setOutputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+    runCoroutine<SendCoroutine>(ResponseFactory::createFileResponse(FILE_NAME, "bytes=10-15"), connection);
+    connection.reset();
+    checkResponse(readAll(otherEnd));
+  }
+
+  { // file truncated after the body is created - sendfile returns 0
+    const char* const truncatedFileName = "oatpp_FileBodyTest_truncated.tmp";
+    {
+      std::FILE* file = std::fopen(truncatedFileName, "wb");
+      OATPP_ASSERT(file);
+      std::fwrite(FILE_DATA, 1, std::strlen(FILE_DATA), file);
+      std::fclose(file);
+    }
+
+    FileBody body(truncatedFileName, nullptr, nullptr);
+    std::fclose(std::fopen(truncatedFileName, "wb"));
+
+    int otherEnd;
+    auto connection = createConnection(otherEnd);
+    v_char8 buffer[16];
+    bool error = false;
+    try {
+      body.transfer(connection.get(), buffer, 16);
+    } catch (const std::runtime_error&) {
+      error = true;
+    }
+    connection.reset();
+    readAll(otherEnd);
+    std::remove(truncatedFileName);
+
+    OATPP_ASSERT(error);
+  }
+
+  { // client closes the connection during the send - must not raise SIGPIPE
+    const char* const bigFileName = "oatpp_FileBodyTest_big.tmp";
+    const v_int32 bigFileSize = 4 * 1024 * 1024;
+    {
+      std::FILE* file = std::fopen(bigFileName, "wb");
+      OATPP_ASSERT(file);
+      std::string chunk(64 * 1024, 'x');
+      for(v_int32 i = 0; i < bigFileSize / (v_int32) chunk.size(); i ++) {
+        std::fwrite(chunk.data(), 1, chunk.size(), file);
+      }
+      std::fclose(file);
+    }
+
+    /* default SIGPIPE action terminates the process - make sure the test catches it */
+    struct sigaction defaultAction;
+    struct sigaction oldAction;
+    std::memset(&defaultAction, 0, sizeof(defaultAction));
+    defaultAction.sa_handler = SIG_DFL;
+    sigemptyset(&defaultAction.sa_mask);
+    sigaction(SIGPIPE, &defaultAction, &oldAction);
+
+    { // sync - peer closes after reading part of the body
+      int otherEnd;
+      auto connection = createConnection(otherEnd);
+      std::thread reader([otherEnd] {
+        char data[1024];
+        v_int64 received = 0;
+        while(received < 64 * 1024) {
+          auto res = ::read(otherEnd, data, 1024);
+          if(res <= 0) break;
+          received += res;
+        }
+        ::close(otherEnd);
+      });
+      FileBody body(bigFileName, nullptr, nullptr);
+      v_char8 buffer[16];
+      auto transferred = body.transfer(connection.get(), buffer, 16);
+      reader.join();
+      OATPP_ASSERT(transferred < bigFileSize);
+    }
+
+    { // async - peer is closed
+      int otherEnd;
+      auto connection = createConnection(otherEnd);
+      connection->setOutputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+      ::close(otherEnd);
+      bool error = false;
+      runCoroutine<TransferCoroutine>(FileBody::createShared(bigFileName, nullptr, nullptr), connection, &error);
+      OATPP_ASSERT(error);
+    }
+
+    sigaction(SIGPIPE, &oldAction, nullptr);
+    std::remove(bigFileName);
+  }
+#endif
+
+  std::remove(FILE_NAME);
+
+}
+
+}}}}}}
@@ -0,0 +1,107 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ResponseTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::ResponseFactory ResponseFactory;
+typedef oatpp::web::protocol::http::Status Status;
+
+class CountingOutputStream : public oatpp::data::stream::ConsistentOutputStream {
+public:
+
+  oatpp::data::stream::BufferOutputStream buffer;
+  v_int32 writesCount = 0;
+
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+    writesCount ++;
+    return buffer.write(data, count, action);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+  oatpp::data::stream::Context& getOutputStreamContext() override {
+    return buffer.getOutputStreamContext();
+  }
+
+};
+
+}
+
+void ResponseTest::onRun() {
+
+  const char* const EXPECTED_1 = "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nHello";
+  const char* const EXPECTED_2 = "HTTP/1.1 201 Created\r\nContent-Length: 6\r\n\r\nWorld!";
+
+  { // default - each response is put out on its own
+    CountingOutputStream stream;
+    oatpp::data::stream::BufferOutputStream headersOutBuffer;
+
+    ResponseFactory::createResponse(Status::CODE_200, "Hello")->send(&stream, &headersOutBuffer, nullptr);
+    ResponseFactory::createResponse(Status::CODE_201, "World!")->send(&stream, &headersOutBuffer, nullptr);
+
+    OATPP_ASSERT(stream.writesCount == 2);
+    OATPP_ASSERT(stream.buffer.toString() == oatpp::String(EXPECTED_1) + EXPECTED_2);
+  }
+
+  { // pipelined - first response is held and put out together with the second one
+    CountingOutputStream stream;
+    oatpp::data::stream::BufferOutputStream headersOutBuffer;
+
+    ResponseFactory::createResponse(Status::CODE_200, "Hello")->send(&stream, &headersOutBuffer, nullptr, 4096);
+    OATPP_ASSERT(stream.writesCount == 0);
+    OATPP_ASSERT(headersOutBuffer.getCurrentPosition() > 0);
+
+    ResponseFactory::createResponse(Status::CODE_201, "World!")->send(&stream, &headersOutBuffer, nullptr, 0);
+    OATPP_ASSERT(stream.writesCount == 1);
+    OATPP_ASSERT(headersOutBuffer.getCurrentPosition() == 0);
+    OATPP_ASSERT(stream.buffer.toString() == oatpp::String(EXPECTED_1) + EXPECTED_2);
+  }
+
+  { // pipelined - threshold is hit
+    CountingOutputStream stream;
+    oatpp::data::stream::BufferOutputStream headersOutBuffer;
+
+    ResponseFactory::createResponse(Status::CODE_200, "Hello")->send(&stream, &headersOutBuffer, nullptr, 16);
+    OATPP_ASSERT(stream.writesCount == 1);
+    OATPP_ASSERT(headersOutBuffer.getCurrentPosition() == 0);
+    OATPP_ASSERT(stream.buffer.toString() == EXPECTED_1);
+  }
+
+}
+
+}}}}}}
@@ -0,0 +1,151 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HeadersScannerTest.hpp"
+
+#include "oatpp/web/protocol/http/utils/HeadersScanner.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace utils {
+
+namespace {
+
+  typedef oatpp::web::protocol::http::utils::HeadersScanner HeadersScanner;
+  typedef oatpp::web::protocol::http::Headers Headers;
+  typedef oatpp::web::protocol::http::Status Status;
+
+  v_buff_size findSectionEnd(const std::string& text) {
+    auto pos = text.find("\r\n\r\n");
+    if(pos == std::string::npos) {
+      return -1;
+    }
+    return pos + 4;
+  }
+
+  void checkText(const std::string& text) {
+
+    auto expectedEnd = findSectionEnd(text);
+
+    for(v_buff_size chunkSize = 1; chunkSize <= (v_buff_size) text.size(); chunkSize ++) {
+
+      HeadersScanner scanner;
+      v_buff_size sectionEnd = -1;
+      v_buff_size offset = 0;
+
+      while(offset < (v_buff_size) text.size()) {
+        v_buff_size size = std::min<v_buff_size>(chunkSize, text.size() - offset);
+        auto res = scanner.scan((const v_char8*) text.data() + offset, size);
+        if(res >= 0) {
+          sectionEnd = offset + res;
+          break;
+        }
+        offset += size;
+      }
+
+      OATPP_ASSERT(sectionEnd == expectedEnd);
+      OATPP_ASSERT(scanner.isDone() == (expectedEnd >= 0));
+
+      if(sectionEnd < 0) {
+        continue;
+      }
+
+      auto headersText = std::make_shared<std::string>(text);
+
+      oatpp::parser::Caret caret1(headersText->data(), headersText->size());
+      caret1.findRN();
+      caret1.skipRN();
+      oatpp::parser::Caret caret2(headersText->data(), headersText->size());
+      caret2.setPosition(caret1.getPosition());
+
+      Headers headers1;
+      Headers headers2;
+      Status status1;
+      Status status2;
+
+      oatpp::web::protocol::http::Parser::parseHeaders(headers1, headersText, caret1, status1);
+      scanner.parseHeaders(headers2, headersText, caret2, status2);
+
+      OATPP_ASSERT(status1.code == status2.code);
+      if(status1.code == 0) {
+        OATPP_ASSERT(caret1.getPosition() == caret2.getPosition());
+        OATPP_ASSERT(headers1.getSize() == headers2.getSize());
+        auto it1 = headers1.getAll_Unsafe().begin();
+        auto it2 = headers2.getAll_Unsafe().begin();
+        while(it1 != headers1.getAll_Unsafe().end()) {
+          OATPP_ASSERT(it1->first == it2->first);
+          OATPP_ASSERT(it1->second == it2->second);
+          it1 ++;
+          it2 ++;
+        }
+      }
+
+    }
+
+  }
+
+}
+
+void HeadersScannerTest::onRun() {
+
+  checkText("GET / HTTP/1.1\r\n\r\n");
+  checkText("GET / HTTP/1.1\r\nHost: localhost\r\n\r\nbody");
+  checkText("GET / HTTP/1.1\r\nHost:localhost\r\n  X-Header  :   value with spaces \r\nEmpty:\r\n\r\n");
+  checkText("GET / HTTP/1.1\r\nA: 1\r\nA: 2\r\nB: \r\n3\r\n\r\n");
+  checkText("GET / HTTP/1.1\r\nA: 1\r\nBad\r\nC: 3\r\n\r\n");
+  checkText("GET / HTTP/1.1\r\nA 1\r\n\r\n");
+  checkText("GET / HTTP/1.1\r\nA: \n1\r\r\n\n\r\n\r\n");
+  checkText("GET / HTTP/1.1\r\nA: 1\r\nB: 2\r\n");
+  checkText("GET / HTTP/1.1\r\nA: 1\r\n\r");
+  checkText("GET / HTTP/1.1\r\n: value\r\n\r\n");
+  checkText("GET / HTTP/1.1\r\nA: 1\r\n   : value\r\n\r\n");
+
+  { // empty header name is rejected
+    std::string text = "GET / HTTP/1.1\r\nA: 1\r\n: value\r\n\r\n";
+    HeadersScanner scanner;
+    OATPP_ASSERT(scanner.scan((const v_char8*) text.data(), text.size()) == (v_buff_size) text.size());
+
+    auto headersText = std::make_shared<std::string>(text);
+    oatpp::parser::Caret caret(headersText->data(), headersText->size());
+    caret.findRN();
+    caret.skipRN();
+
+    Headers headers;
+    Status status;
+    scanner.parseHeaders(headers, headersText, caret, status);
+    OATPP_ASSERT(status.code == 431);
+  }
+
+  {
+    oatpp::data::stream::BufferOutputStream stream;
+    stream << "GET / HTTP/1.1\r\n";
+    for(v_int32 i = 0; i < HeadersScanner::MAX_INDEXED_LINES * 2; i++) {
+      stream << "X-Header-" << i << ": value-" << i << "\r\n";
+    }
+    stream << "\r\n";
+    checkText(stream.toString()->c_str());
+  }
+
+}
+
+}}}}}}
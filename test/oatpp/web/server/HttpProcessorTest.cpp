@@ -0,0 +1,421 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HttpProcessorTest.hpp"
+
+#include "oatpp/web/server/AsyncHttpConnectionHandler.hpp"
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+
+#include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/client/ConnectionProvider.hpp"
+#include "oatpp/network/Server.hpp"
+#include "oatpp/network/tcp/Connection.hpp"
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace test { namespace web { namespace server {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::Response OutgoingResponse;
+typedef oatpp::web::protocol::http::Status Status;
+
+const char* const RESPONSE_BODY = "Hello World!!!";
+
+/* Buffers of a connection given back to the pool while it's hibernated - headers-in, headers-out and in-stream memory */
+const v_buff_size CONNECTION_BUFFERS = 3;
+
+class HelloHandler : public oatpp::web::server::HttpRequestHandler {
+public:
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest>& request) override {
+    (void) request;
+    return ResponseFactory::createResponse(Status::CODE_200, RESPONSE_BODY);
+  }
+
+  oatpp::async::CoroutineStarterForResult<const std::shared_ptr<OutgoingResponse>&>
+  handleAsync(const std::shared_ptr<IncomingRequest>& request) override {
+
+    class HelloCoroutine : public oatpp::async::CoroutineWithResult<HelloCoroutine, const std::shared_ptr<OutgoingResponse>&> {
+    public:
+
+      Action act() override {
+        return _return(ResponseFactory::createResponse(Status::CODE_200, RESPONSE_BODY));
+      }
+
+    };
+
+    (void) request;
+    return HelloCoroutine::startForResult();
+
+  }
+
+};
+
+class TestServer {
+private:
+  std::shared_ptr<oatpp::network::virtual_::Interface> m_interface;
+  std::shared_ptr<oatpp::network::ServerConnectionProvider> m_connectionProvider;
+  std::shared_ptr<oatpp::web::server::HttpProcessor::Components> m_components;
+  std::shared_ptr<oatpp::async::Executor> m_executor;
+  std::shared_ptr<oatpp::network::ConnectionHandler> m_connectionHandler;
+  std::shared_ptr<oatpp::network::Server> m_server;
+  std::thread m_thread;
+public:
+
+  TestServer(bool async)
+    : m_interface(oatpp::network::virtual_::Interface::obtainShared("HttpProcessorTest"))
+    , m_connectionProvider(oatpp::network::virtual_::server::ConnectionProvider::createShared(m_interface))
+  {
+
+    auto router = oatpp::web::server::HttpRouter::createShared();
+    router->route("GET", "/", std::make_shared<HelloHandler>());
+
+    m_components = std::make_shared<oatpp::web::server::HttpProcessor::Components>(router);
+
+    if(async) {
+      m_executor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+      m_connectionHandler = std::make_shared<oatpp::web::server::AsyncHttpConnectionHandler>(m_components, m_executor);
+    } else {
+      m_connectionHandler = std::make_shared<oatpp::web::server::HttpConnectionHandler>(m_components);
+    }
+
+    m_server = oatpp::network::Server::createShared(m_connectionProvider, m_connectionHandler);
+
+    m_thread = std::thread([this]{
+      m_server->run();
+    });
+
+  }
+
+  ~TestServer() {
+    m_server->stop();
+    m_connectionHandler->stop();
+    m_connectionProvider->stop();
+    m_thread.join();
+    if(m_executor) {
+      m_executor->waitTasksFinished();
+      m_executor->stop();
+      m_executor->join();
+    }
+  }
+
+  const std::shared_ptr<oatpp::web::server::HttpProcessor::Components>& getComponents() {
+    return m_components;
+  }
+
+  const std::shared_ptr<oatpp::async::Executor>& getExecutor() {
+    return m_executor;
+  }
+
+  provider::ResourceHandle<data::stream::IOStream> connect() {
+    auto connection = oatpp::network::virtual_::client::ConnectionProvider::createShared(m_interface)->get();
+    connection.object->setInputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+    return connection;
+  }
+
+};
+
+void send(const provider::ResourceHandle<data::stream::IOStream>& connection, const char* data) {
+  connection.object->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+  connection.object->writeExactSizeDataSimple(data, std::strlen(data));
+}
+
+/* Read until the number of complete responses received reaches the expected one, or until timeout */
+v_int32 receiveResponses(const provider::ResourceHandle<data::stream::IOStream>& connection,
+                         v_int32 expectedCount,
+                         const std::chrono::milliseconds& timeout)
+{
+
+  oatpp::data::stream::BufferOutputStream received;
+  v_char8 buffer[1024];
+
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  v_int32 count = 0;
+
+  while(count < expectedCount && std::chrono::steady_clock::now() < deadline) {
+
+    async::Action action;
+    auto res = connection.object->read(buffer, sizeof(buffer), action);
+
+    if(res > 0) {
+      received.writeSimple(buffer, res);
+      auto data = received.toString();
+      count = 0;
+      for(auto pos = data->find(RESPONSE_BODY); pos != std::string::npos; pos = data->find(RESPONSE_BODY, pos + 1)) {
+        count ++;
+      }
+    } else if(res == IOError::RETRY_READ) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } else {
+      break;
+    }
+
+  }
+
+  return count;
+
+}
+
+void testPipeline(bool async) {
+
+  TestServer server(async);
+
+  {
+    /* complete pipelined requests */
+    auto connection = server.connect();
+    send(connection,
+         "GET / HTTP/1.1\r\nHost: x\r\n\r\n"
+         "GET / HTTP/1.1\r\nHost: x\r\n\r\n"
+         "GET / HTTP/1.1\r\nHost: x\r\n\r\n");
+    OATPP_ASSERT(receiveResponses(connection, 3, std::chrono::seconds(2)) == 3);
+    connection.invalidator->invalidate(connection.object);
+  }
+
+  {
+    /* only part of the next request head is buffered - the first response must not be held */
+    auto connection = server.connect();
+    send(connection, "GET / HTTP/1.1\r\nHost: x\r\n\r\nGET / HT");
+    OATPP_ASSERT(receiveResponses(connection, 1, std::chrono::seconds(2)) == 1);
+    send(connection, "TP/1.1\r\nHost: x\r\n\r\n");
+    OATPP_ASSERT(receiveResponses(connection, 1, std::chrono::seconds(2)) == 1);
+    connection.invalidator->invalidate(connection.object);
+  }
+
+  {
+    /* stray CRLF after the request */
+    auto connection = server.connect();
+    send(connection, "GET / HTTP/1.1\r\nHost: x\r\n\r\n\r\n");
+    OATPP_ASSERT(receiveResponses(connection, 1, std::chrono::seconds(2)) == 1);
+    connection.invalidator->invalidate(connection.object);
+  }
+
+}
+
+/* Wait until the condition is true, or until timeout */
+template<class F>
+bool waitFor(F condition, const std::chrono::milliseconds& timeout) {
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  while(!condition()) {
+    if(std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+void testHibernation() {
+
+  {
+    /* idle -> hibernate -> first byte -> parse */
+    TestServer server(true);
+    auto pool = server.getComponents()->bufferPool;
+
+    auto connection = server.connect();
+    send(connection, "GET / HTTP/1.1\r\nHost: x\r\n\r\n");
+    OATPP_ASSERT(receiveResponses(connection, 1, std::chrono::seconds(2)) == 1);
+    OATPP_ASSERT(waitFor([&pool] { return pool->getPooledCount() == CONNECTION_BUFFERS; }, std::chrono::seconds(2)));
+
+    send(connection, "G");
+    OATPP_ASSERT(waitFor([&pool] { return pool->getPooledCount() == 0; }, std::chrono::seconds(2)));
+
+    send(connection, "ET / HTTP/1.1\r\nHost: x\r\n\r\n");
+    OATPP_ASSERT(receiveResponses(connection, 1, std::chrono::seconds(2)) == 1);
+    OATPP_ASSERT(waitFor([&pool] { return pool->getPooledCount() == CONNECTION_BUFFERS; }, std::chrono::seconds(2)));
+
+    connection.invalidator->invalidate(connection.object);
+  }
+
+  {
+    /* client closes the connection while it's hibernated */
+    TestServer server(true);
+    auto pool = server.getComponents()->bufferPool;
+    auto executor = server.getExecutor();
+
+    auto connection = server.connect();
+    send(connection, "GET / HTTP/1.1\r\nHost: x\r\n\r\n");
+    OATPP_ASSERT(receiveResponses(connection, 1, std::chrono::seconds(2)) == 1);
+    OATPP_ASSERT(waitFor([&pool] { return pool->getPooledCount() == CONNECTION_BUFFERS; }, std::chrono::seconds(2)));
+    OATPP_ASSERT(executor->getTasksCount() == 1);
+
+    connection.invalidator->invalidate(connection.object);
+    OATPP_ASSERT(waitFor([&executor] { return executor->getTasksCount() == 0; }, std::chrono::seconds(2)));
+    OATPP_ASSERT(pool->getPooledCount() == CONNECTION_BUFFERS);
+  }
+
+}
+
+#if defined(__linux__)
+
+const char* const SHORT_REQUEST = "GET / HTTP/1.1\r\nHost: x\r\n\r\n";
+
+/* Reads everything the socket has, but gives it out one request at a time - like TLS gives out one record */
+class InternallyBufferedStream : public oatpp::data::stream::IOStream {
+private:
+  std::shared_ptr<oatpp::network::tcp::Connection> m_connection;
+  std::string m_buffer;
+public:
+
+  InternallyBufferedStream(const std::shared_ptr<oatpp::network::tcp::Connection>& connection)
+    : m_connection(connection)
+  {}
+
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override {
+    if(m_buffer.empty()) {
+      char data[1024];
+      auto res = m_connection->read(data, sizeof(data), action);
+      if(res <= 0) {
+        return res;
+      }
+      m_buffer.append(data, (size_t) res);
+    }
+    auto size = std::min<v_buff_size>({count, (v_buff_size) m_buffer.size(), (v_buff_size) std::strlen(SHORT_REQUEST)});
+    std::memcpy(buffer, m_buffer.data(), (size_t) size);
+    m_buffer.erase(0, (size_t) size);
+    return size;
+  }
+
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+    return m_connection->write(data, count, action);
+  }
+
+  void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    m_connection->setInputStreamIOMode(ioMode);
+  }
+
+  oatpp::data::stream::IOMode getInputStreamIOMode() override {
+    return m_connection->getInputStreamIOMode();
+  }
+
+  oatpp::data::stream::Context& getInputStreamContext() override {
+    return m_connection->getInputStreamContext();
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    m_connection->setOutputStreamIOMode(ioMode);
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return m_connection->getOutputStreamIOMode();
+  }
+
+  oatpp::data::stream::Context& getOutputStreamContext() override {
+    return m_connection->getOutputStreamContext();
+  }
+
+};
+
+class NoopTaskListener : public oatpp::web::server::HttpProcessor::TaskProcessingListener {
+public:
+  void onTaskStart(const provider::ResourceHandle<data::stream::IOStream>& connection) override { (void) connection; }
+  void onTaskEnd(const provider::ResourceHandle<data::stream::IOStream>& connection) override { (void) connection; }
+};
+
+/* Count responses available on the client end without blocking */
+v_int32 countResponses(int fd, std::string& received) {
+  char data[1024];
+  while(true) {
+    auto res = ::recv(fd, data, sizeof(data), MSG_DONTWAIT);
+    if(res <= 0) break;
+    received.append(data, (size_t) res);
+  }
+  v_int32 count = 0;
+  for(auto pos = received.find(RESPONSE_BODY); pos != std::string::npos; pos = received.find(RESPONSE_BODY, pos + 1)) {
+    count ++;
+  }
+  return count;
+}
+
+void testTaskIterate() {
+
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  router->route("GET", "/", std::make_shared<HelloHandler>());
+  auto components = std::make_shared<oatpp::web::server::HttpProcessor::Components>(router);
+
+  int fds[2];
+  OATPP_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+  auto stream = std::make_shared<InternallyBufferedStream>(std::make_shared<oatpp::network::tcp::Connection>(fds[0]));
+  stream->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+  stream->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+
+  NoopTaskListener listener;
+  std::string received;
+
+  {
+    oatpp::web::server::HttpProcessor::Task task(components, {stream, nullptr}, &listener);
+    v_io_handle ioHandle;
+
+    OATPP_ASSERT(::write(fds[1], SHORT_REQUEST, std::strlen(SHORT_REQUEST)) > 0);
+    OATPP_ASSERT(task.iterate(ioHandle) == oatpp::web::server::HttpProcessor::ConnectionState::ALIVE);
+    OATPP_ASSERT(ioHandle == fds[0]);
+    OATPP_ASSERT(countResponses(fds[1], received) == 1);
+
+    /* Both requests are taken off the socket at once - the second one is in the stream, not in the socket */
+    std::string requests = std::string(SHORT_REQUEST) + SHORT_REQUEST;
+    OATPP_ASSERT(::write(fds[1], requests.data(), requests.size()) > 0);
+    OATPP_ASSERT(task.iterate(ioHandle) == oatpp::web::server::HttpProcessor::ConnectionState::ALIVE);
+    OATPP_ASSERT(countResponses(fds[1], received) == 3);
+  }
+
+  ::close(fds[1]);
+
+}
+
+#endif
+
+}
+
+void HttpProcessorTest::onRun() {
+
+  OATPP_LOGI(TAG, "Pipeline, simple API...");
+  testPipeline(false);
+  OATPP_LOGI(TAG, "OK");
+
+  OATPP_LOGI(TAG, "Pipeline, async API...");
+  testPipeline(true);
+  OATPP_LOGI(TAG, "OK");
+
+  OATPP_LOGI(TAG, "Hibernation of idle connections...");
+  testHibernation();
+  OATPP_LOGI(TAG, "OK");
+
+#if defined(__linux__)
+  OATPP_LOGI(TAG, "Task re-probes the stream before parking...");
+  testTaskIterate();
+  OATPP_LOGI(TAG, "OK");
+#endif
+
+}
+
+}}}}
@@ -0,0 +1,219 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PatternTreeTest.hpp"
+
+#include "oatpp/web/url/mapping/Router.hpp"
+#include "oatpp/web/url/mapping/TreeRouter.hpp"
+
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace url { namespace mapping {
+
+namespace {
+
+typedef oatpp::web::url::mapping::Router<v_int32> ListRouter;
+typedef oatpp::web::url::mapping::TreeRouter<v_int32> TreeRouter;
+
+bool routesEqual(ListRouter::Route& a, TreeRouter::Route& b) {
+
+  if(a.isValid() != b.isValid()) {
+    return false;
+  }
+
+  if(!a.isValid()) {
+    return true;
+  }
+
+  if(a.getEndpoint() != b.getEndpoint()) {
+    return false;
+  }
+
+  if(a.getMatchMap().getTail() != b.getMatchMap().getTail()) {
+    return false;
+  }
+
+  auto& varsA = a.getMatchMap().getVariables();
+  auto& varsB = b.getMatchMap().getVariables();
+
+  if(varsA.size() != varsB.size()) {
+    return false;
+  }
+
+  for(auto& pair : varsA) {
+    auto it = varsB.find(pair.first);
+    if(it == varsB.end() || it->second != pair.second) {
+      return false;
+    }
+  }
+
+  return true;
+
+}
+
+void checkSameRoutes(const char* tag, const std::vector<const char*>& patterns, const std::vector<const char*>& urls) {
+
+  ListRouter listRouter;
+  TreeRouter treeRouter;
+
+  for(size_t i = 0; i < patterns.size(); i ++) {
+    listRouter.route(patterns[i], (v_int32) i);
+    treeRouter.route(patterns[i], (v_int32) i);
+  }
+
+  for(auto url : urls) {
+    auto a = listRouter.getRoute(url);
+    auto b = treeRouter.getRoute(url);
+    if(!routesEqual(a, b)) {
+      OATPP_LOGE(tag, "Routes differ for url '%s'. list=%d, tree=%d", url,
+                 a.isValid() ? a.getEndpoint() : -1, b.isValid() ? b.getEndpoint() : -1);
+      OATPP_ASSERT(false);
+    }
+  }
+
+}
+
+}
+
+void PatternTreeTest::onRun() {
+
+  std::vector<const char*> urls = {
+    "", "/", "//", "a", "/a", "/a/", "a/b", "/a/b", "/a/b/", "//a//b//", "/a/b/c", "/a/b/c/d",
+    "/a?q=1", "/a/?q=1", "/a/b?q=1", "/a/b/c?q=1", "/a?q=1/b", "/a/b?q=1/c", "/a?b", "/a?b/c",
+    "/users", "/users/", "/users/me", "/users/10", "/users/10/", "/users/10/posts", "/users/10/posts/20",
+    "/users/me/posts", "/users/10?x", "/users/10?x/posts", "/users/?", "/users/10/posts?x=y",
+    "/files/path/to/file.txt", "/files", "/files/", "/files?x", "/static/css/main.css", "/x/y/z",
+    "/ints/1", "/ints/1/*", "ints/all/10", "//ints//all//10//"
+  };
+
+  {
+    OATPP_LOGI(TAG, "Case 1 - static and variable parts");
+    checkSameRoutes(TAG, {
+      "/", "/a", "/a/b", "/a/{x}", "/{x}/b", "/{x}/{y}", "/a/b/c", "/users/me", "/users/{userId}",
+      "/users/{userId}/posts", "/users/{userId}/posts/{postId}", "/ints/1", "ints/all/{value}"
+    }, urls);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Case 2 - registration order matters");
+    checkSameRoutes(TAG, {
+      "/users/{userId}", "/users/me", "/{x}/{y}", "/a/b", "/{x}", "/a", "/{x}/posts", "/users/{id}/posts"
+    }, urls);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Case 3 - wildcards");
+    checkSameRoutes(TAG, {
+      "/files/*", "/a/*", "/users/{userId}/*", "/a/b", "/static/*", "*", "/{x}/*"
+    }, urls);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Case 4 - wildcard first");
+    checkSameRoutes(TAG, {
+      "*", "/a", "/a/b", "/{x}"
+    }, urls);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Case 5 - query strings");
+    checkSameRoutes(TAG, {
+      "/a/{x}/c", "/a/{x}", "/a/b/*", "/a/b", "/a/*", "/users/{id}/posts", "/users/{id}", "/a?q=1", "/{v}/b"
+    }, urls);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Case 6 - duplicates and empty variables");
+    checkSameRoutes(TAG, {
+      "/a/{}", "/a/{x}/{x}", "/a/{y}", "/a/b", "/a/b", "/{a}/{b}/{c}/{d}"
+    }, urls);
+  }
+
+  {
+
+    OATPP_LOGI(TAG, "Case 7 - 1000 routes");
+
+    ListRouter listRouter;
+    TreeRouter treeRouter;
+
+    v_int32 endpointsCount = 1000;
+
+    for(v_int32 i = 0; i < endpointsCount; i ++) {
+      oatpp::String pattern;
+      switch(i % 4) {
+        case 0: pattern = "/api/v1/resource" + oatpp::utils::conversion::int32ToStr(i) + "/{id}"; break;
+        case 1: pattern = "/api/v1/resource" + oatpp::utils::conversion::int32ToStr(i) + "/{id}/items/{itemId}"; break;
+        case 2: pattern = "/api/v1/resource" + oatpp::utils::conversion::int32ToStr(i); break;
+        default: pattern = "/api/v2/{tenant}/resource" + oatpp::utils::conversion::int32ToStr(i) + "/*"; break;
+      }
+      listRouter.route(pattern, i);
+      treeRouter.route(pattern, i);
+    }
+
+    std::vector<oatpp::String> requests;
+    for(v_int32 i = 0; i < endpointsCount; i += 10) {
+      oatpp::String url;
+      switch(i % 4) {
+        case 0: url = "/api/v1/resource" + oatpp::utils::conversion::int32ToStr(i) + "/123"; break;
+        case 1: url = "/api/v1/resource" + oatpp::utils::conversion::int32ToStr(i) + "/123/items/456"; break;
+        case 2: url = "/api/v1/resource" + oatpp::utils::conversion::int32ToStr(i) + "?a=b"; break;
+        default: url = "/api/v2/tenant/resource" + oatpp::utils::conversion::int32ToStr(i) + "/some/tail"; break;
+      }
+      requests.push_back(url);
+    }
+
+    for(auto& url : requests) {
+      auto a = listRouter.getRoute(url);
+      auto b = treeRouter.getRoute(url);
+      OATPP_ASSERT(a.isValid());
+      OATPP_ASSERT(routesEqual(a, b));
+    }
+
+    v_int32 numIterations = 100;
+
+    {
+      PerformanceChecker checker("Router - 1000 routes");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        for(auto& url : requests) {
+          listRouter.getRoute(url);
+        }
+      }
+    }
+
+    {
+      PerformanceChecker checker("TreeRouter - 1000 routes");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        for(auto& url : requests) {
+          treeRouter.getRoute(url);
+        }
+      }
+    }
+
+  }
+
+}
+
+}}}}}